@@ -0,0 +1,357 @@
+#include "harness.hpp"
+
+#include "ndml/hierarchy.hpp"
+#include "ndml/parallel.hpp"
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <span>
+#include <string>
+
+namespace ndml::bench
+{
+namespace
+{
+/// Number of points in point transform workloads.
+constexpr std::size_t point_count = 1'000'000;
+
+/// Number of transforms in transform composition workloads.
+constexpr std::size_t transform_count = 100'000;
+
+/// Number of rays in ray intersection workloads.
+constexpr std::size_t ray_count = 100'000;
+
+/**
+ * @brief Batch workload body applying @p f to respective elements of two input arrays.
+ *
+ * Unlike micro-benchmarks, a single operation processes all @p count elements,
+ * so the result reflects memory traffic as well as arithmetic.
+ */
+template <typename L, typename R, typename BinaryFn>
+auto batch(std::size_t count, std::size_t lhs_count, BinaryFn f) -> benchmark::body_type
+{
+	using result_type = decltype(f(std::declval<L const&>(), std::declval<R const&>()));
+
+	return [f, count, lhs = samples<L>(lhs_count), rhs = samples<R>(count), out = std::vector<result_type>(count)](std::size_t iterations) mutable {
+		for (std::size_t i = 0; i < iterations; ++i)
+		{
+			for (std::size_t j = 0; j < count; ++j)
+			{
+				out[j] = f(lhs[j % lhs.size()], rhs[j]);
+			}
+
+			do_not_optimize(out.data());
+		}
+	};
+}
+
+/**
+ * @brief Batch workload body applying a single transform to all @p count elements of an input array via the span API.
+ */
+template <typename L, typename R>
+auto span_batch(std::size_t count) -> benchmark::body_type
+{
+	return [t = random_of(std::type_identity<L>{}), in = samples<R>(count), out = std::vector<R>(count)](std::size_t iterations) mutable {
+		for (std::size_t i = 0; i < iterations; ++i)
+		{
+			do_not_optimize(transform(t, in, out).data());
+		}
+	};
+}
+
+/**
+ * @brief Batch workload body applying a single transform to all @p count elements of structure of arrays via the span API.
+ */
+template <typename L, typename R>
+auto soa_batch(std::size_t count) -> benchmark::body_type
+{
+	using value_type = typename R::value_type;
+
+	std::array<std::vector<value_type>, R::size()> in;
+	for (auto& component : in)
+	{
+		component.resize(count);
+		std::ranges::generate(component, random_value<value_type>);
+	}
+
+	auto out = in;
+
+	return [t = random_of(std::type_identity<L>{}), in = std::move(in), out = std::move(out)](std::size_t iterations) mutable {
+		std::array<std::span<value_type const>, R::size()> src;
+		std::array<std::span<value_type>, R::size()>       dst;
+		for (std::size_t k = 0; k < R::size(); ++k)
+		{
+			src[k] = in[k];
+			dst[k] = out[k];
+		}
+
+		for (std::size_t i = 0; i < iterations; ++i)
+		{
+			transform(t, src, dst);
+			do_not_optimize(dst[0].data());
+		}
+	};
+}
+
+/**
+ * @brief Batch workload body interpolating between all @p count keyframe pairs via @p f, each by its own parameter.
+ */
+template <typename T, typename InterpolateFn>
+auto keyframe_batch(std::size_t count, InterpolateFn f) -> benchmark::body_type
+{
+	std::vector<T> t(count);
+	std::ranges::generate(t, [] { return (random_value<T>() + T{1}) / T{2}; });
+
+	return [f, from = samples<quat<T>>(count), to = samples<quat<T>>(count), t = std::move(t), out = std::vector<quat<T>>(count)](std::size_t iterations) mutable {
+		for (std::size_t i = 0; i < iterations; ++i)
+		{
+			do_not_optimize(f(from, to, t, out).data());
+		}
+	};
+}
+
+/**
+ * @brief Batch workload body classifying all @p count bounds in structure of arrays form against a view frustum.
+ *
+ * Centers are spread around the frustum so that bounds are outside of it, intersect it, and are inside of it in comparable numbers.
+ * The bounds are boxes if @p Boxes is true, and spheres otherwise.
+ */
+template <typename T, bool Boxes>
+auto cull_batch(std::size_t count) -> benchmark::body_type
+{
+	frustum<T> const f{perspective(T{1}, T{1}, T{1}, T{10}) * look_at(vec<3, T>{T{0}, T{0}, T{5}}, vec<3, T>{}, vec<3, T>{T{0}, T{1}, T{0}})};
+
+	std::array<std::vector<T>, 3> centers;
+	std::array<std::vector<T>, 3> extents;
+	for (std::size_t k = 0; k < 3; ++k)
+	{
+		centers[k].resize(count);
+		extents[k].resize(count);
+		std::ranges::generate(centers[k], [] { return random_value<T>() * T{6}; });
+		std::ranges::generate(extents[k], [] { return random_value<T>() + T{1}; });
+	}
+
+	return [f, centers = std::move(centers), extents = std::move(extents), out = std::vector<containment>(count)](std::size_t iterations) mutable {
+		std::array<std::span<T const>, 3> const c{centers[0], centers[1], centers[2]};
+		std::array<std::span<T const>, 3> const e{extents[0], extents[1], extents[2]};
+
+		for (std::size_t i = 0; i < iterations; ++i)
+		{
+			if constexpr (Boxes)
+			{
+				do_not_optimize(classify(f, c, e, out).data());
+			}
+			else
+			{
+				do_not_optimize(classify(f, c, e[0], out).data());
+			}
+		}
+	};
+}
+
+/**
+ * @brief Batch workload body finding the nearest intersections of @p count rays with a set of triangles.
+ *
+ * Rays are tested in packets of @p W, or one by one with scalar queries if @p W is 1,
+ * and aimed at a grid of triangles so that roughly half of them hit one.
+ */
+template <typename T, std::size_t W>
+auto ray_triangle_batch(std::size_t count) -> benchmark::body_type
+{
+	constexpr std::size_t triangle_count = 16;
+
+	std::vector<triangle<T>> triangles;
+	for (std::size_t i = 0; i < triangle_count; ++i)
+	{
+		vec<3, T> const a{random_value<T>() * T{4}, random_value<T>() * T{4}, T{1} + random_value<T>()};
+		triangles.emplace_back(a, a + vec<3, T>{T{2}, T{0}, T{0}}, a + vec<3, T>{T{0}, T{2}, T{0}});
+	}
+
+	std::vector<ray<T>> rays;
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		rays.emplace_back(vec<3, T>{random_value<T>() * T{4}, random_value<T>() * T{4}, T{-5}}, vec<3, T>{T{0}, T{0}, T{1}});
+	}
+
+	return [triangles = std::move(triangles), rays = std::move(rays)](std::size_t iterations) {
+		for (std::size_t i = 0; i < iterations; ++i)
+		{
+			for (std::size_t r = 0; r + W <= rays.size(); r += W)
+			{
+				if constexpr (W == 1)
+				{
+					auto nearest = std::numeric_limits<T>::infinity();
+					for (auto const& t : triangles)
+					{
+						if (auto const hit = intersection(rays[r], t); hit && hit->distance < nearest)
+						{
+							nearest = hit->distance;
+						}
+					}
+					do_not_optimize(nearest);
+				}
+				else
+				{
+					ray_packet<T, W> const packet{std::span<ray<T> const, W>{rays.data() + r, W}};
+					triangle_hit_packet<T, W> hits;
+					for (auto const& t : triangles)
+					{
+						do_not_optimize(intersect(packet, t, hits));
+					}
+					do_not_optimize(hits.distance.data());
+				}
+			}
+		}
+	};
+}
+
+/**
+ * @brief Batch workload body converting @p count elements from @p From to @p To, and back.
+ *
+ * Each iteration performs both conversions, as one of the types is usually single precision.
+ */
+template <typename From, typename To>
+auto convert_batch(std::size_t count) -> benchmark::body_type
+{
+	std::vector<From> in(count);
+	std::ranges::generate(in, [] { return static_cast<From>(random_value<float>() * 100.0f); });
+
+	return [in = std::move(in), out = std::vector<To>(count), back = std::vector<From>(count)](std::size_t iterations) mutable {
+		for (std::size_t i = 0; i < iterations; ++i)
+		{
+			do_not_optimize(convert<From, To>(in, out).data());
+			do_not_optimize(convert<To, From>(out, back).data());
+		}
+	};
+}
+
+/**
+ * @brief Pool shared by parallel workloads, running on all hardware threads.
+ */
+auto shared_pool() -> std::shared_ptr<parallel::pool>
+{
+	static auto const p = std::make_shared<parallel::pool>();
+	return p;
+}
+
+/**
+ * @brief Batch workload body applying a single transform to all @p count elements of an input array across the threads of a pool.
+ */
+template <typename L, typename R>
+auto parallel_batch(std::size_t count) -> benchmark::body_type
+{
+	return [p = shared_pool(), t = random_of(std::type_identity<L>{}), in = samples<R>(count), out = std::vector<R>(count)](std::size_t iterations) mutable {
+		for (std::size_t i = 0; i < iterations; ++i)
+		{
+			do_not_optimize(parallel::transform(*p, t, in, out).data());
+		}
+	};
+}
+
+/**
+ * @brief Batch workload body reducing all @p count elements of an input array via @p f across the threads of a pool.
+ */
+template <typename V, typename ReduceFn>
+auto parallel_reduce_batch(std::size_t count, ReduceFn f) -> benchmark::body_type
+{
+	return [p = shared_pool(), f, in = samples<V>(count)](std::size_t iterations) {
+		for (std::size_t i = 0; i < iterations; ++i)
+		{
+			do_not_optimize(f(*p, std::span<V const>{in}));
+		}
+	};
+}
+
+/**
+ * @brief Batch workload body setting the local transformations of every @p stride -th node of a hierarchy of @p count nodes and updating it.
+ *
+ * Each node is a root or a child of a random preceding node, so that the hierarchy is a forest of shallow trees.
+ */
+template <typename M>
+auto hierarchy_batch(std::size_t count, std::size_t stride) -> benchmark::body_type
+{
+	hierarchy<M> h;
+	h.reserve(count);
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		auto const parent = i % 8 == 0 ? hierarchy<M>::no_parent : static_cast<std::size_t>((random_value<double>() + 1.0) / 2.0 * static_cast<double>(i)) % i;
+		h.add(random_of(std::type_identity<M>{}), parent);
+	}
+
+	h.update();
+
+	return [h = std::move(h), locals = samples<M>(count), stride](std::size_t iterations) mutable {
+		for (std::size_t i = 0; i < iterations; ++i)
+		{
+			for (std::size_t node = i % stride; node < h.size(); node += stride)
+			{
+				h.set_local(node, locals[node]);
+			}
+
+			do_not_optimize(h.update());
+		}
+	};
+}
+
+template <typename T>
+auto register_batch(std::vector<benchmark>& benchmarks) -> void
+{
+	auto const suffix = std::string{"/"} + type_name<T>();
+
+	auto const mul = [](auto const& lhs, auto const& rhs) { return lhs * rhs; };
+
+	benchmarks.push_back({"batch/transform/mat4*vec4" + suffix, point_count, batch<mat<4, 4, T>, vec<4, T>>(point_count, 1, mul)});
+	benchmarks.push_back({"batch/transform/quat*vec3" + suffix, point_count, batch<quat<T>, vec<3, T>>(point_count, 1, mul)});
+	benchmarks.push_back({"batch/transform_span/mat4*vec4" + suffix, point_count, span_batch<mat<4, 4, T>, vec<4, T>>(point_count)});
+	benchmarks.push_back({"batch/transform_span/quat*vec3" + suffix, point_count, span_batch<quat<T>, vec<3, T>>(point_count)});
+	benchmarks.push_back({"batch/transform_soa/mat4*vec4" + suffix, point_count, soa_batch<mat<4, 4, T>, vec<4, T>>(point_count)});
+	benchmarks.push_back({"batch/transform_soa/quat*vec3" + suffix, point_count, soa_batch<quat<T>, vec<3, T>>(point_count)});
+	benchmarks.push_back({"batch/transform/affine3*aabb" + suffix, point_count, batch<affine<3, T>, aabb<T>>(point_count, 1, mul)});
+	benchmarks.push_back({"batch/cull_soa/aabb" + suffix, point_count, cull_batch<T, true>(point_count)});
+	benchmarks.push_back({"batch/cull_soa/sphere" + suffix, point_count, cull_batch<T, false>(point_count)});
+	benchmarks.push_back({"batch/ray_triangle/scalar" + suffix, ray_count, ray_triangle_batch<T, 1>(ray_count)});
+	benchmarks.push_back({"batch/ray_triangle/packet4" + suffix, ray_count, ray_triangle_batch<T, 4>(ray_count)});
+	benchmarks.push_back({"batch/ray_triangle/packet8" + suffix, ray_count, ray_triangle_batch<T, 8>(ray_count)});
+	benchmarks.push_back({"batch/parallel/transform/mat4*vec4" + suffix, point_count, parallel_batch<mat<4, 4, T>, vec<4, T>>(point_count)});
+	benchmarks.push_back({"batch/parallel/sum/vec3" + suffix, point_count, parallel_reduce_batch<vec<3, T>>(point_count, [](auto& p, auto in) { return parallel::sum<vec<3, T>>(p, in); })});
+	benchmarks.push_back({"batch/parallel/bounds/vec3" + suffix, point_count, parallel_reduce_batch<vec<3, T>>(point_count, [](auto& p, auto in) { return parallel::bounds<T>(p, in); })});
+	benchmarks.push_back({"batch/parallel/scatter/vec3" + suffix, point_count, parallel_reduce_batch<vec<3, T>>(point_count, [](auto& p, auto in) {
+		return parallel::transform_reduce<vec<3, T>>(p, in, mat<3, 3, T>{}, std::plus<>{}, [](auto const& v) { return outer_product(v, v); });
+	})});
+	benchmarks.push_back({"batch/hierarchy/full/mat4" + suffix, transform_count, hierarchy_batch<mat<4, 4, T>>(transform_count, 1)});
+	benchmarks.push_back({"batch/hierarchy/sparse/mat4" + suffix, transform_count, hierarchy_batch<mat<4, 4, T>>(transform_count, 100)});
+	benchmarks.push_back({"batch/hierarchy/full/affine3" + suffix, transform_count, hierarchy_batch<affine<3, T>>(transform_count, 1)});
+	benchmarks.push_back({"batch/hierarchy/sparse/affine3" + suffix, transform_count, hierarchy_batch<affine<3, T>>(transform_count, 100)});
+	benchmarks.push_back({"batch/nlerp" + suffix, point_count, keyframe_batch<T>(point_count, [](auto const& from, auto const& to, auto const& t, auto& out) {
+		return nlerp<T>(from, to, t, out);
+	})});
+	benchmarks.push_back({"batch/slerp" + suffix, point_count, keyframe_batch<T>(point_count, [](auto const& from, auto const& to, auto const& t, auto& out) {
+		return slerp<T>(from, to, t, out);
+	})});
+	benchmarks.push_back({"batch/slerp_fast" + suffix, point_count, keyframe_batch<T>(point_count, [](auto const& from, auto const& to, auto const& t, auto& out) {
+		return slerp<T>(from, to, t, out, math::fast);
+	})});
+	benchmarks.push_back({"batch/compose/mat4*mat4" + suffix, transform_count, batch<mat<4, 4, T>, mat<4, 4, T>>(transform_count, transform_count, mul)});
+	benchmarks.push_back({"batch/compose/affine3*affine3" + suffix, transform_count, batch<affine<3, T>, affine<3, T>>(transform_count, transform_count, mul)});
+	benchmarks.push_back({"batch/compose/quat*quat" + suffix, transform_count, batch<quat<T>, quat<T>>(transform_count, transform_count, mul)});
+	benchmarks.push_back({"batch/compose/dual_quat*dual_quat" + suffix, transform_count, batch<dual_quat<T>, dual_quat<T>>(transform_count, transform_count, mul)});
+}
+}
+
+auto register_batch(std::vector<benchmark>& benchmarks) -> void
+{
+	register_batch<float>(benchmarks);
+	register_batch<double>(benchmarks);
+
+	benchmarks.push_back({"batch/convert/float<->double", point_count, convert_batch<float, double>(point_count)});
+#if defined(__STDCPP_FLOAT16_T__)
+	benchmarks.push_back({"batch/convert/float<->float16", point_count, convert_batch<float, std::float16_t>(point_count)});
+#endif
+#if defined(__STDCPP_BFLOAT16_T__)
+	benchmarks.push_back({"batch/convert/float<->bfloat16", point_count, convert_batch<float, std::bfloat16_t>(point_count)});
+#endif
+}
+}
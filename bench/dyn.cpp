@@ -0,0 +1,86 @@
+#include "harness.hpp"
+
+#include "ndml/dyn.hpp"
+
+#include <memory_resource>
+#include <string>
+
+namespace ndml::bench
+{
+namespace
+{
+/**
+ * @brief Random square matrix of @p n rows, diagonally dominant so that it is well-conditioned.
+ */
+template <typename T>
+auto random_dyn_mat(std::size_t n) -> dyn_mat<T>
+{
+	dyn_mat<T> m(n, n);
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		for (std::size_t j = 0; j < n; ++j)
+		{
+			m[i, j] = random_value<T>();
+		}
+
+		m[i, i] += static_cast<T>(2 * n);
+	}
+
+	return m;
+}
+
+template <typename T>
+auto register_dyn(std::vector<benchmark>& benchmarks, std::size_t n) -> void
+{
+	auto const suffix = "/" + std::to_string(n) + "/" + type_name<T>();
+
+	benchmarks.push_back({"dyn/mul" + suffix, 1, [lhs = random_dyn_mat<T>(n), rhs = random_dyn_mat<T>(n)](std::size_t iterations) {
+		for (std::size_t i = 0; i < iterations; ++i)
+		{
+			do_not_optimize((lhs * rhs).data());
+		}
+	}});
+
+	benchmarks.push_back({"dyn/mul_into" + suffix, 1, [lhs = random_dyn_mat<T>(n), rhs = random_dyn_mat<T>(n), out = dyn_mat<T>(n, n)](std::size_t iterations) mutable {
+		for (std::size_t i = 0; i < iterations; ++i)
+		{
+			multiply<T>(lhs, rhs, out);
+			do_not_optimize(out.data());
+		}
+	}});
+
+	benchmarks.push_back({"dyn/mul_arena" + suffix, 1, [n, lhs = random_dyn_mat<T>(n), rhs = random_dyn_mat<T>(n)](std::size_t iterations) {
+		std::pmr::monotonic_buffer_resource arena{n * n * sizeof(T) * 2};
+
+		for (std::size_t i = 0; i < iterations; ++i)
+		{
+			pmr::dyn_mat<T> out(n, n, &arena);
+			multiply<T>(lhs, rhs, out);
+			do_not_optimize(out.data());
+
+			arena.release();
+		}
+	}});
+
+	benchmarks.push_back({"dyn/inverse" + suffix, 1, [m = random_dyn_mat<T>(n)](std::size_t iterations) {
+		for (std::size_t i = 0; i < iterations; ++i)
+		{
+			do_not_optimize(inverse(m).data());
+		}
+	}});
+}
+
+template <typename T>
+auto register_dyn(std::vector<benchmark>& benchmarks) -> void
+{
+	register_dyn<T>(benchmarks, 16);
+	register_dyn<T>(benchmarks, 128);
+}
+}
+
+auto register_dyn(std::vector<benchmark>& benchmarks) -> void
+{
+	register_dyn<float>(benchmarks);
+	register_dyn<double>(benchmarks);
+}
+}
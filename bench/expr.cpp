@@ -0,0 +1,41 @@
+#include "harness.hpp"
+
+#include "ndml/expr.hpp"
+
+#include <string>
+
+namespace ndml::bench
+{
+namespace
+{
+/**
+ * @brief Registers eager and lazy evaluation of @f$ a s + b t - a @f$ for operands of type @p V.
+ */
+template <typename V>
+auto register_expr(std::vector<benchmark>& benchmarks, std::string const& suffix) -> void
+{
+	using value_type = expr::shape<V>::value_type;
+
+	auto const s = static_cast<value_type>(2);
+	auto const t = static_cast<value_type>(3);
+
+	benchmarks.push_back({"expr/axpby_eager" + suffix, 1, binary<V, V>([s, t](auto const& a, auto const& b) { return V{a * s + b * t - a}; })});
+	benchmarks.push_back({"expr/axpby_lazy" + suffix, 1, binary<V, V>([s, t](auto const& a, auto const& b) { return V{expr::lazy(a) * s + expr::lazy(b) * t - a}; })});
+}
+
+template <typename T>
+auto register_expr(std::vector<benchmark>& benchmarks) -> void
+{
+	register_expr<vec<3, T>>(benchmarks, std::string{"/vec3/"} + type_name<T>());
+	register_expr<vec<4, T>>(benchmarks, std::string{"/vec4/"} + type_name<T>());
+	register_expr<mat<3, 3, T>>(benchmarks, std::string{"/mat3/"} + type_name<T>());
+	register_expr<mat<4, 4, T>>(benchmarks, std::string{"/mat4/"} + type_name<T>());
+}
+}
+
+auto register_expr(std::vector<benchmark>& benchmarks) -> void
+{
+	register_expr<float>(benchmarks);
+	register_expr<double>(benchmarks);
+}
+}
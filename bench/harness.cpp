@@ -0,0 +1,47 @@
+#include "harness.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace ndml::bench
+{
+auto run(benchmark const& b, options const& opts) -> result
+{
+	using clock = std::chrono::steady_clock;
+
+	auto const measure = [&b](std::size_t iterations) {
+		auto const start = clock::now();
+		b.body(iterations);
+		return clock::now() - start;
+	};
+
+	std::size_t iterations = 1;
+	while (measure(iterations) < opts.min_time && iterations < std::numeric_limits<std::size_t>::max() / 2)
+	{
+		iterations *= 2;
+	}
+
+	auto best = clock::duration::max();
+	for (std::size_t i = 0; i < std::max<std::size_t>(opts.repetitions, 1); ++i)
+	{
+		best = std::min(best, measure(iterations));
+	}
+
+	auto const ns = std::chrono::duration<double, std::nano>(best).count();
+
+	result r;
+	r.name             = b.name;
+	r.iterations       = iterations;
+	r.items            = b.items;
+	r.ns_per_op        = ns / static_cast<double>(iterations);
+	r.items_per_second = static_cast<double>(iterations * b.items) / ns * 1e9;
+
+	return r;
+}
+
+auto engine() -> std::mt19937_64&
+{
+	static std::mt19937_64 e{0x6e646d6c};
+	return e;
+}
+}
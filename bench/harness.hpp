@@ -0,0 +1,372 @@
+#ifndef NDML_BENCH_HARNESS_HPP
+#define NDML_BENCH_HARNESS_HPP
+
+#include "ndml/affine.hpp"
+#include "ndml/dual_quat.hpp"
+#include "ndml/geometry.hpp"
+#include "ndml/mat.hpp"
+#include "ndml/math.hpp"
+#include "ndml/quat.hpp"
+#include "ndml/vec.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace ndml::bench
+{
+/**
+ * @brief Benchmark description.
+ *
+ * A benchmark body is invoked with the number of operations it has to perform,
+ * whereas @c items is the number of elements processed by a single operation, e.g. points in a batch.
+ */
+struct benchmark
+{
+	using body_type = std::function<void(std::size_t)>;
+
+	/// Slash-separated benchmark name, e.g. @c vec/dot/3/float.
+	std::string name;
+
+	/// Number of items processed per operation.
+	std::size_t items{1};
+
+	/// Benchmark body.
+	body_type body;
+};
+
+/**
+ * @brief Benchmark measurement.
+ */
+struct result
+{
+	/// Benchmark name.
+	std::string name;
+
+	/// Number of operations performed in the fastest repetition.
+	std::size_t iterations{};
+
+	/// Number of items processed per operation.
+	std::size_t items{};
+
+	/// Nanoseconds per operation in the fastest repetition.
+	double ns_per_op{};
+
+	/// Items processed per second in the fastest repetition.
+	double items_per_second{};
+};
+
+/**
+ * @brief Benchmark run options.
+ */
+struct options
+{
+	/// Minimal duration of a single repetition.
+	std::chrono::nanoseconds min_time{std::chrono::milliseconds{50}};
+
+	/// Number of repetitions, the fastest of which is reported.
+	std::size_t repetitions{5};
+};
+
+/**
+ * @brief Number of distinct inputs micro-benchmarks cycle through.
+ *
+ * This is a power of two so that input selection is a single mask operation.
+ */
+inline constexpr std::size_t sample_count = 256;
+
+/**
+ * @brief Prevents the compiler from optimising away @p value.
+ */
+template <typename T>
+inline auto do_not_optimize(T const& value) noexcept -> void
+{
+#if defined(__GNUC__) || defined(__clang__)
+	asm volatile("" : : "r,m"(value) : "memory");
+#else
+	static void const* volatile sink;
+	sink = &value;
+	std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+/**
+ * @brief Measures a benchmark.
+ *
+ * The number of operations is doubled until a repetition lasts at least @c options::min_time,
+ * then the fastest of @c options::repetitions repetitions is reported.
+ */
+[[nodiscard]]
+auto run(benchmark const& b, options const& opts) -> result;
+
+/**
+ * @brief Pseudo-random engine used for all benchmark inputs.
+ *
+ * It is seeded with a constant so that every run works on identical data.
+ */
+[[nodiscard]]
+auto engine() -> std::mt19937_64&;
+
+/**
+ * @brief Random scalar.
+ *
+ * Floating-point values are drawn from @f$ [-1, 1] @f$, integral values from @f$ [-8, 8] @f$.
+ */
+template <typename T>
+[[nodiscard]]
+auto random_value() -> T
+{
+	if constexpr (std::is_floating_point_v<T>)
+	{
+		return std::uniform_real_distribution<T>{T{-1}, T{1}}(engine());
+	}
+	else
+	{
+		return static_cast<T>(std::uniform_int_distribution<int>{-8, 8}(engine()));
+	}
+}
+
+/**
+ * @brief Random vector with components given by @c random_value.
+ */
+template <std::size_t N, typename T>
+[[nodiscard]]
+auto random_vec() -> vec<N, T>
+{
+	vec<N, T> v;
+	for (std::size_t i = 0; i < N; ++i)
+	{
+		v[i] = random_value<T>();
+	}
+
+	return v;
+}
+
+/**
+ * @brief Random, diagonally dominant matrix.
+ *
+ * Diagonal dominance keeps the matrix invertible so that decompositions work on representative data.
+ */
+template <std::size_t R, std::size_t C, typename T>
+[[nodiscard]]
+auto random_mat() -> mat<R, C, T>
+{
+	mat<R, C, T> m;
+	for (std::size_t i = 0; i < C; ++i)
+	{
+		m[i] = random_vec<R, T>();
+		if (i < R)
+		{
+			m[i, i] += static_cast<T>(R + C);
+		}
+	}
+
+	return m;
+}
+
+/**
+ * @brief Random versor.
+ */
+template <typename T>
+[[nodiscard]]
+auto random_quat() -> quat<T>
+{
+	return normal(random_vec<4, T>() + vec<4, T>{T{0}, T{0}, T{0}, T{2}});
+}
+
+/**
+ * @brief Random unit dual quaternion.
+ */
+template <typename T>
+[[nodiscard]]
+auto random_dual_quat() -> dual_quat<T>
+{
+	return dual_versor(random_quat<T>(), random_vec<3, T>());
+}
+
+/**
+ * @brief Random axis-aligned bounding box.
+ */
+template <typename T>
+[[nodiscard]]
+auto random_aabb() -> aabb<T>
+{
+	auto const c = random_vec<3, T>();
+	auto const e = (random_vec<3, T>() + vec<3, T>{T{1}, T{1}, T{1}}) / T{4};
+
+	return {c - e, c + e};
+}
+
+/**
+ * @brief Random value of vector, matrix, symmetric matrix, affine transformation, quaternion, dual quaternion, or axis-aligned bounding box type.
+ *
+ * The overload is selected by a type tag so that @c samples can be written once for all types.
+ */
+template <std::size_t N, typename T>
+[[nodiscard]]
+auto random_of(std::type_identity<vec<N, T>>) -> vec<N, T>
+{
+	return random_vec<N, T>();
+}
+
+template <std::size_t R, std::size_t C, typename T>
+[[nodiscard]]
+auto random_of(std::type_identity<mat<R, C, T>>) -> mat<R, C, T>
+{
+	return random_mat<R, C, T>();
+}
+
+template <std::size_t N, typename T>
+[[nodiscard]]
+auto random_of(std::type_identity<sym_mat<N, T>>) -> sym_mat<N, T>
+{
+	// the upper triangle of a diagonally dominant matrix, which is positive-definite
+	return sym_mat<N, T>{random_mat<N, N, T>()};
+}
+
+template <std::size_t N, typename T>
+[[nodiscard]]
+auto random_of(std::type_identity<affine<N, T>>) -> affine<N, T>
+{
+	return affine<N, T>{random_mat<N + 1, N + 1, T>()};
+}
+
+template <typename T>
+[[nodiscard]]
+auto random_of(std::type_identity<quat<T>>) -> quat<T>
+{
+	return random_quat<T>();
+}
+
+template <typename T>
+[[nodiscard]]
+auto random_of(std::type_identity<dual_quat<T>>) -> dual_quat<T>
+{
+	return random_dual_quat<T>();
+}
+
+template <typename T>
+[[nodiscard]]
+auto random_of(std::type_identity<aabb<T>>) -> aabb<T>
+{
+	return random_aabb<T>();
+}
+
+/**
+ * @brief Random inputs shared by all benchmarks operating on type @p V.
+ *
+ * @param count number of inputs
+ */
+template <typename V>
+[[nodiscard]]
+auto samples(std::size_t count = sample_count) -> std::vector<V>
+{
+	std::vector<V> s(count);
+	for (auto& v : s)
+	{
+		v = random_of(std::type_identity<V>{});
+	}
+
+	return s;
+}
+
+/**
+ * @brief Micro-benchmark body of a unary operation.
+ *
+ * The body cycles through @c sample_count inputs of type @p V, applying @p f to each.
+ */
+template <typename V, typename UnaryFn>
+[[nodiscard]]
+auto unary(UnaryFn f) -> benchmark::body_type
+{
+	return [f, in = samples<V>()](std::size_t iterations) {
+		for (std::size_t i = 0; i < iterations; ++i)
+		{
+			do_not_optimize(f(in[i & (sample_count - 1)]));
+		}
+	};
+}
+
+/**
+ * @brief Micro-benchmark body of a binary operation.
+ *
+ * The body cycles through @c sample_count pairs of inputs of types @p L and @p R, applying @p f to each.
+ */
+template <typename L, typename R, typename BinaryFn>
+[[nodiscard]]
+auto binary(BinaryFn f) -> benchmark::body_type
+{
+	return [f, lhs = samples<L>(), rhs = samples<R>()](std::size_t iterations) {
+		for (std::size_t i = 0; i < iterations; ++i)
+		{
+			do_not_optimize(f(lhs[i & (sample_count - 1)], rhs[(i + 1) & (sample_count - 1)]));
+		}
+	};
+}
+
+/**
+ * @brief Name of an element type, as used in benchmark names.
+ */
+template <typename T>
+[[nodiscard]]
+constexpr auto type_name() noexcept -> char const*
+{
+	if constexpr (std::is_same_v<T, float>)
+	{
+		return "float";
+	}
+	else if constexpr (std::is_same_v<T, double>)
+	{
+		return "double";
+	}
+	else if constexpr (std::is_same_v<T, int>)
+	{
+		return "int";
+	}
+	else if constexpr (std::is_same_v<T, math::q16_16>)
+	{
+		return "q16_16";
+	}
+	else
+	{
+		return "?";
+	}
+}
+
+/**
+ * @brief Registers vector micro-benchmarks.
+ */
+auto register_vec(std::vector<benchmark>& benchmarks) -> void;
+
+/**
+ * @brief Registers matrix micro-benchmarks.
+ */
+auto register_mat(std::vector<benchmark>& benchmarks) -> void;
+
+/**
+ * @brief Registers quaternion micro-benchmarks.
+ */
+auto register_quat(std::vector<benchmark>& benchmarks) -> void;
+
+/**
+ * @brief Registers batch workloads.
+ */
+auto register_batch(std::vector<benchmark>& benchmarks) -> void;
+
+/**
+ * @brief Registers comparisons of eager and lazy expression evaluation.
+ */
+auto register_expr(std::vector<benchmark>& benchmarks) -> void;
+
+/**
+ * @brief Registers runtime-sized matrix operations.
+ */
+auto register_dyn(std::vector<benchmark>& benchmarks) -> void;
+}
+
+#endif
@@ -0,0 +1,332 @@
+#include "harness.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <optional>
+#include <sstream>
+#include <string_view>
+
+namespace
+{
+using namespace ndml::bench;
+
+constexpr std::string_view usage = R"(usage: ndml_bench [options]
+
+options:
+  --filter <text>      run only benchmarks whose names contain <text>
+  --format <format>    output format: text (default), json, or csv
+  --output <path>      write results to <path> instead of the standard output
+  --min-time <ms>      minimal duration of a single repetition in milliseconds (default 50)
+  --repetitions <n>    number of repetitions, the fastest is reported (default 5)
+  --baseline <path>    compare against results previously written with --format csv
+  --tolerance <ratio>  allowed slowdown relative to the baseline (default 0.10)
+  --list               list benchmark names and exit
+  --help               show this message and exit
+)";
+
+enum class format
+{
+	text,
+	json,
+	csv,
+};
+
+struct arguments
+{
+	std::string                filter;
+	format                     fmt{format::text};
+	std::optional<std::string> output;
+	std::optional<std::string> baseline;
+	double                     tolerance{0.10};
+	bool                       list{};
+	bool                       help{};
+	options                    opts;
+};
+
+template <typename T>
+auto parse_number(std::string_view s) -> std::optional<T>
+{
+	T value{};
+
+	auto const [ptr, ec] = std::from_chars(s.data(), s.data() + s.size(), value);
+	if (ec != std::errc{} || ptr != s.data() + s.size())
+	{
+		return std::nullopt;
+	}
+
+	return value;
+}
+
+auto parse_arguments(int argc, char** argv) -> std::optional<arguments>
+{
+	arguments args;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string_view const arg{argv[i]};
+
+		if (arg == "--help")
+		{
+			args.help = true;
+			return args;
+		}
+
+		if (arg == "--list")
+		{
+			args.list = true;
+			continue;
+		}
+
+		if (i + 1 >= argc)
+		{
+			std::cerr << "missing value for " << arg << '\n' << usage;
+			return std::nullopt;
+		}
+
+		std::string_view const value{argv[++i]};
+
+		if (arg == "--filter")
+		{
+			args.filter = value;
+		}
+		else if (arg == "--format" && value == "text")
+		{
+			args.fmt = format::text;
+		}
+		else if (arg == "--format" && value == "json")
+		{
+			args.fmt = format::json;
+		}
+		else if (arg == "--format" && value == "csv")
+		{
+			args.fmt = format::csv;
+		}
+		else if (arg == "--output")
+		{
+			args.output = value;
+		}
+		else if (arg == "--baseline")
+		{
+			args.baseline = value;
+		}
+		else if (auto const ms = parse_number<unsigned>(value); arg == "--min-time" && ms)
+		{
+			args.opts.min_time = std::chrono::milliseconds{*ms};
+		}
+		else if (auto const n = parse_number<std::size_t>(value); arg == "--repetitions" && n)
+		{
+			args.opts.repetitions = *n;
+		}
+		else if (auto const t = parse_number<double>(value); arg == "--tolerance" && t)
+		{
+			args.tolerance = *t;
+		}
+		else
+		{
+			std::cerr << "invalid argument " << arg << ' ' << value << '\n' << usage;
+			return std::nullopt;
+		}
+	}
+
+	return args;
+}
+
+auto write_text(std::ostream& os, std::vector<result> const& results) -> void
+{
+	std::size_t width = 0;
+	for (auto const& r : results)
+	{
+		width = std::max(width, r.name.size());
+	}
+
+	char line[256];
+	std::snprintf(line, sizeof(line), "%-*s %14s %14s %16s\n", static_cast<int>(width), "benchmark", "iterations", "ns/op", "items/s");
+	os << line;
+
+	for (auto const& r : results)
+	{
+		std::snprintf(line, sizeof(line), "%-*s %14zu %14.3f %16.4g\n", static_cast<int>(width), r.name.c_str(), r.iterations, r.ns_per_op, r.items_per_second);
+		os << line;
+	}
+}
+
+auto write_json(std::ostream& os, std::vector<result> const& results) -> void
+{
+	os << "{\n  \"benchmarks\": [\n";
+
+	for (std::size_t i = 0; i < results.size(); ++i)
+	{
+		auto const& r = results[i];
+
+		os << "    {\"name\": \"" << r.name << "\", \"iterations\": " << r.iterations << ", \"items_per_op\": " << r.items
+		   << ", \"ns_per_op\": " << r.ns_per_op << ", \"items_per_second\": " << r.items_per_second << '}'
+		   << (i + 1 < results.size() ? ",\n" : "\n");
+	}
+
+	os << "  ]\n}\n";
+}
+
+auto write_csv(std::ostream& os, std::vector<result> const& results) -> void
+{
+	os << "name,iterations,items_per_op,ns_per_op,items_per_second\n";
+
+	for (auto const& r : results)
+	{
+		os << r.name << ',' << r.iterations << ',' << r.items << ',' << r.ns_per_op << ',' << r.items_per_second << '\n';
+	}
+}
+
+auto read_baseline(std::string const& path) -> std::optional<std::map<std::string, double, std::less<>>>
+{
+	std::ifstream is{path};
+	if (!is)
+	{
+		return std::nullopt;
+	}
+
+	std::map<std::string, double, std::less<>> baseline;
+
+	std::string line;
+	std::getline(is, line);
+
+	while (std::getline(is, line))
+	{
+		std::vector<std::string> fields;
+
+		std::istringstream ls{line};
+		for (std::string field; std::getline(ls, field, ',');)
+		{
+			fields.push_back(std::move(field));
+		}
+
+		if (fields.size() < 4)
+		{
+			continue;
+		}
+
+		if (auto const ns = parse_number<double>(fields[3]))
+		{
+			baseline.emplace(fields[0], *ns);
+		}
+	}
+
+	return baseline;
+}
+
+auto compare(std::vector<result> const& results, std::map<std::string, double, std::less<>> const& baseline, double tolerance) -> bool
+{
+	bool ok = true;
+
+	for (auto const& r : results)
+	{
+		auto const it = baseline.find(r.name);
+		if (it == baseline.end() || it->second <= 0)
+		{
+			continue;
+		}
+
+		auto const ratio = r.ns_per_op / it->second;
+		if (ratio > 1 + tolerance)
+		{
+			std::cerr << "regression: " << r.name << " " << it->second << " ns/op -> " << r.ns_per_op << " ns/op (x" << ratio << ")\n";
+			ok = false;
+		}
+	}
+
+	return ok;
+}
+}
+
+auto main(int argc, char** argv) -> int
+{
+	auto const args = parse_arguments(argc, argv);
+	if (!args)
+	{
+		return 2;
+	}
+
+	if (args->help)
+	{
+		std::cout << usage;
+		return 0;
+	}
+
+	std::vector<benchmark> benchmarks;
+	register_vec(benchmarks);
+	register_mat(benchmarks);
+	register_quat(benchmarks);
+	register_batch(benchmarks);
+	register_expr(benchmarks);
+	register_dyn(benchmarks);
+
+	std::erase_if(benchmarks, [&args](benchmark const& b) { return !b.name.contains(args->filter); });
+
+	if (args->list)
+	{
+		for (auto const& b : benchmarks)
+		{
+			std::cout << b.name << '\n';
+		}
+
+		return 0;
+	}
+
+	std::vector<result> results;
+	results.reserve(benchmarks.size());
+
+	for (auto const& b : benchmarks)
+	{
+		results.push_back(run(b, args->opts));
+
+		if (args->output || args->fmt != format::text)
+		{
+			std::cerr << b.name << '\n';
+		}
+	}
+
+	std::ofstream file;
+	if (args->output)
+	{
+		file.open(*args->output);
+		if (!file)
+		{
+			std::cerr << "cannot open " << *args->output << '\n';
+			return 2;
+		}
+	}
+
+	auto& os = args->output ? static_cast<std::ostream&>(file) : std::cout;
+
+	switch (args->fmt)
+	{
+	case format::text:
+		write_text(os, results);
+		break;
+
+	case format::json:
+		write_json(os, results);
+		break;
+
+	case format::csv:
+		write_csv(os, results);
+		break;
+	}
+
+	if (args->baseline)
+	{
+		auto const baseline = read_baseline(*args->baseline);
+		if (!baseline)
+		{
+			std::cerr << "cannot open " << *args->baseline << '\n';
+			return 2;
+		}
+
+		return compare(results, *baseline, args->tolerance) ? 0 : 1;
+	}
+
+	return 0;
+}
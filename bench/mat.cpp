@@ -0,0 +1,73 @@
+#include "harness.hpp"
+
+#include <string>
+
+namespace ndml::bench
+{
+namespace
+{
+template <std::size_t N, typename T>
+auto register_mat(std::vector<benchmark>& benchmarks) -> void
+{
+	using mat_type     = mat<N, N, T>;
+	using vec_type     = vec<N, T>;
+	using sym_mat_type = sym_mat<N, T>;
+
+	auto const suffix = "/" + std::to_string(N) + "/" + type_name<T>();
+
+	benchmarks.push_back({"mat/mul" + suffix, 1, binary<mat_type, mat_type>([](auto const& lhs, auto const& rhs) { return lhs * rhs; })});
+	benchmarks.push_back({"mat/mul_vec" + suffix, 1, binary<mat_type, vec_type>([](auto const& m, auto const& v) { return m * v; })});
+	benchmarks.push_back({"mat/add" + suffix, 1, binary<mat_type, mat_type>([](auto const& lhs, auto const& rhs) { return lhs + rhs; })});
+	benchmarks.push_back({"mat/transpose" + suffix, 1, unary<mat_type>([](auto const& m) { return transpose(m); })});
+	benchmarks.push_back({"mat/trace" + suffix, 1, unary<mat_type>([](auto const& m) { return trace(m); })});
+	benchmarks.push_back({"mat/determinant" + suffix, 1, unary<mat_type>([](auto const& m) { return determinant(m); })});
+
+	if constexpr (std::is_floating_point_v<T>)
+	{
+		benchmarks.push_back({"mat/inverse" + suffix, 1, unary<mat_type>([](auto const& m) { return inverse(m); })});
+		benchmarks.push_back({"mat/inverse_and_determinant" + suffix, 1, unary<mat_type>([](auto const& m) { return inverse_and_determinant(m); })});
+		benchmarks.push_back({"mat/lu" + suffix, 1, unary<mat_type>([](auto const& m) { return lu{m}; })});
+		benchmarks.push_back({"mat/lu_solve" + suffix, 1, unary<vec_type>([f = lu{random_mat<N, N, T>()}](auto const& b) { return f.solve(b); })});
+		benchmarks.push_back({"mat/sym_mul_vec" + suffix, 1, binary<sym_mat_type, vec_type>([](auto const& s, auto const& v) { return s * v; })});
+		benchmarks.push_back({"mat/cholesky" + suffix, 1, unary<sym_mat_type>([](auto const& s) { return cholesky{s}; })});
+		benchmarks.push_back({"mat/cholesky_solve" + suffix, 1, unary<vec_type>([f = cholesky{random_of(std::type_identity<sym_mat_type>{})}](auto const& b) { return f.solve(b); })});
+		benchmarks.push_back({"mat/eigen" + suffix, 1, unary<sym_mat_type>([](auto const& s) { return eigen{s}; })});
+	}
+}
+
+template <typename T>
+auto register_mat(std::vector<benchmark>& benchmarks) -> void
+{
+	register_mat<2, T>(benchmarks);
+	register_mat<3, T>(benchmarks);
+	register_mat<4, T>(benchmarks);
+	register_mat<6, T>(benchmarks);
+	register_mat<9, T>(benchmarks);
+
+	auto const suffix = std::string{"/"} + type_name<T>();
+
+	benchmarks.push_back({"mat/mul_wide/4x4*4x8" + suffix, 1, binary<mat<4, 4, T>, mat<4, 8, T>>([](auto const& lhs, auto const& rhs) { return lhs * rhs; })});
+
+	if constexpr (std::is_floating_point_v<T>)
+	{
+		benchmarks.push_back({"mat/affine_inverse/4" + suffix, 1, unary<mat<4, 4, T>>([](auto const& m) { return affine_inverse(m); })});
+		benchmarks.push_back({"mat/rigid_inverse/4" + suffix, 1, unary<mat<4, 4, T>>([](auto const& m) { return rigid_inverse(m); })});
+		benchmarks.push_back({"mat/rotation_axis/4" + suffix, 1, binary<vec<3, T>, vec<3, T>>([](auto const& axis, auto const& angle) { return rotation(axis, angle.x); })});
+		benchmarks.push_back({"mat/rotation_axis_fast/4" + suffix, 1, binary<vec<3, T>, vec<3, T>>([](auto const& axis, auto const& angle) { return rotation(axis, angle.x, math::fast); })});
+		benchmarks.push_back({"mat/rotation_sincos/4" + suffix, 1, binary<vec<3, T>, vec<3, T>>([](auto const& axis, auto const& sc) { return rotation(axis, sc.x, sc.y); })});
+
+		benchmarks.push_back({"affine/mul/3" + suffix, 1, binary<affine<3, T>, affine<3, T>>([](auto const& lhs, auto const& rhs) { return lhs * rhs; })});
+		benchmarks.push_back({"affine/mul_vec/3" + suffix, 1, binary<affine<3, T>, vec<3, T>>([](auto const& a, auto const& p) { return a * p; })});
+		benchmarks.push_back({"affine/inverse/3" + suffix, 1, unary<affine<3, T>>([](auto const& a) { return inverse(a); })});
+		benchmarks.push_back({"affine/rigid_inverse/3" + suffix, 1, unary<affine<3, T>>([](auto const& a) { return rigid_inverse(a); })});
+	}
+}
+}
+
+auto register_mat(std::vector<benchmark>& benchmarks) -> void
+{
+	register_mat<float>(benchmarks);
+	register_mat<double>(benchmarks);
+	register_mat<int>(benchmarks);
+}
+}
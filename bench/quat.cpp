@@ -0,0 +1,49 @@
+#include "harness.hpp"
+
+#include <array>
+#include <string>
+
+namespace ndml::bench
+{
+namespace
+{
+template <typename T>
+auto register_quat(std::vector<benchmark>& benchmarks) -> void
+{
+	using quat_type      = quat<T>;
+	using dual_quat_type = dual_quat<T>;
+	using vec_type       = vec<3, T>;
+
+	auto const suffix = std::string{"/"} + type_name<T>();
+
+	benchmarks.push_back({"quat/mul" + suffix, 1, binary<quat_type, quat_type>([](auto const& lhs, auto const& rhs) { return lhs * rhs; })});
+	benchmarks.push_back({"quat/rotate" + suffix, 1, binary<quat_type, vec_type>([](auto const& q, auto const& v) { return q * v; })});
+	benchmarks.push_back({"quat/inverse" + suffix, 1, unary<quat_type>([](auto const& q) { return inverse(q); })});
+	benchmarks.push_back({"quat/axis_angle" + suffix, 1, unary<quat_type>([](auto const& q) { return axis_angle(q); })});
+	benchmarks.push_back({"quat/rotation" + suffix, 1, unary<quat_type>([](auto const& q) { return rotation(q); })});
+	benchmarks.push_back({"quat/rotation3" + suffix, 1, unary<quat_type>([](auto const& q) { return rotation<3>(q); })});
+	benchmarks.push_back({"quat/nlerp" + suffix, 1, binary<quat_type, quat_type>([](auto const& from, auto const& to) { return nlerp(from, to, T(0.3)); })});
+	benchmarks.push_back({"quat/slerp" + suffix, 1, binary<quat_type, quat_type>([](auto const& from, auto const& to) { return slerp(from, to, T(0.3)); })});
+	benchmarks.push_back({"quat/slerp_fast" + suffix, 1, binary<quat_type, quat_type>([](auto const& from, auto const& to) { return slerp(from, to, T(0.3), math::fast); })});
+	benchmarks.push_back({"quat/versor_matrix" + suffix, 1, unary<mat<3, 3, T>>([](auto const& m) { return versor(m); })});
+	benchmarks.push_back({"quat/versor" + suffix, 1, binary<vec_type, vec_type>([](auto const& axis, auto const& angle) { return versor(axis, angle.x); })});
+	benchmarks.push_back({"quat/versor_fast" + suffix, 1, binary<vec_type, vec_type>([](auto const& axis, auto const& angle) { return versor(axis, angle.x, math::fast); })});
+
+	benchmarks.push_back({"dual_quat/mul" + suffix, 1, binary<dual_quat_type, dual_quat_type>([](auto const& lhs, auto const& rhs) { return lhs * rhs; })});
+	benchmarks.push_back({"dual_quat/transform" + suffix, 1, binary<dual_quat_type, vec_type>([](auto const& dq, auto const& p) { return dq * p; })});
+	benchmarks.push_back({"dual_quat/inverse" + suffix, 1, unary<dual_quat_type>([](auto const& dq) { return conjugate(dq); })});
+	benchmarks.push_back({"dual_quat/transformation" + suffix, 1, unary<dual_quat_type>([](auto const& dq) { return transformation(dq); })});
+	benchmarks.push_back({"dual_quat/blend2" + suffix, 1, binary<dual_quat_type, dual_quat_type>([](auto const& lhs, auto const& rhs) {
+		std::array const transforms{lhs, rhs};
+		std::array const weights{T(0.25), T(0.75)};
+		return blend<T>(transforms, weights);
+	})});
+}
+}
+
+auto register_quat(std::vector<benchmark>& benchmarks) -> void
+{
+	register_quat<float>(benchmarks);
+	register_quat<double>(benchmarks);
+}
+}
@@ -0,0 +1,54 @@
+#include "harness.hpp"
+
+#include <string>
+
+namespace ndml::bench
+{
+namespace
+{
+template <std::size_t N, typename T>
+auto register_vec(std::vector<benchmark>& benchmarks) -> void
+{
+	using vec_type = vec<N, T>;
+
+	auto const suffix = "/" + std::to_string(N) + "/" + type_name<T>();
+
+	benchmarks.push_back({"vec/add" + suffix, 1, binary<vec_type, vec_type>([](auto const& lhs, auto const& rhs) { return lhs + rhs; })});
+	benchmarks.push_back({"vec/mul" + suffix, 1, binary<vec_type, vec_type>([](auto const& lhs, auto const& rhs) { return lhs * rhs; })});
+	benchmarks.push_back({"vec/scale" + suffix, 1, unary<vec_type>([](auto const& v) { return v * static_cast<T>(3); })});
+	benchmarks.push_back({"vec/dot" + suffix, 1, binary<vec_type, vec_type>([](auto const& lhs, auto const& rhs) { return dot(lhs, rhs); })});
+	benchmarks.push_back({"vec/norm" + suffix, 1, unary<vec_type>([](auto const& v) { return norm(v); })});
+	benchmarks.push_back({"vec/equal" + suffix, 1, binary<vec_type, vec_type>([](auto const& lhs, auto const& rhs) { return lhs == rhs; })});
+	benchmarks.push_back({"vec/swizzle_reverse" + suffix, 1, unary<vec_type>([](auto const& v) { return meta::unroll<N>([&v](auto... i) { return swizzle<N - 1 - i...>(v); }); })});
+
+	if constexpr (std::is_floating_point_v<T>)
+	{
+		benchmarks.push_back({"vec/normal" + suffix, 1, unary<vec_type>([](auto const& v) { return normal(v); })});
+		benchmarks.push_back({"vec/normal_fast" + suffix, 1, unary<vec_type>([](auto const& v) { return normal(v, math::fast); })});
+		benchmarks.push_back({"vec/norm_fast" + suffix, 1, unary<vec_type>([](auto const& v) { return norm(v, math::fast); })});
+		benchmarks.push_back({"vec/projection" + suffix, 1, binary<vec_type, vec_type>([](auto const& v, auto const& axis) { return projection(v, axis); })});
+	}
+
+	if constexpr (N == 3)
+	{
+		benchmarks.push_back({"vec/cross" + suffix, 1, binary<vec_type, vec_type>([](auto const& lhs, auto const& rhs) { return cross(lhs, rhs); })});
+	}
+}
+
+template <typename T>
+auto register_vec(std::vector<benchmark>& benchmarks) -> void
+{
+	register_vec<2, T>(benchmarks);
+	register_vec<3, T>(benchmarks);
+	register_vec<4, T>(benchmarks);
+}
+}
+
+auto register_vec(std::vector<benchmark>& benchmarks) -> void
+{
+	register_vec<float>(benchmarks);
+	register_vec<double>(benchmarks);
+	register_vec<int>(benchmarks);
+	register_vec<math::q16_16>(benchmarks);
+}
+}
@@ -0,0 +1,8 @@
+#ifndef NDML_AFFINE_HPP
+#define NDML_AFFINE_HPP
+
+#include "affine/affine.hpp"
+#include "affine/operation.hpp"
+#include "affine/transform.hpp"
+
+#endif
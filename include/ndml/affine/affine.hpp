@@ -0,0 +1,75 @@
+#ifndef NDML_AFFINE_AFFINE_HPP
+#define NDML_AFFINE_AFFINE_HPP
+
+#include "ndml/mat/mat.hpp"
+#include "ndml/meta/layout.hpp"
+#include "ndml/vec/vec.hpp"
+
+#include <cstddef>
+
+namespace ndml
+{
+/**
+ * @brief Affine transformation.
+ *
+ * A transformation @f$ p \mapsto L p + t @f$ of @p N -dimensional points, stored as its linear block @f$ L @f$
+ * followed by its translation @f$ t @f$, i.e. laid out as the column-major @c mat<N, N + 1, T> of which they are the columns.
+ * Unlike @c mat<N + 1, N + 1, T>, the last row, which is always @f$ (0, \dots, 0, 1) @f$, is implied, so that
+ * composition and application do not involve it, and storage is smaller by that row.
+ *
+ * @tparam N dimension
+ * @tparam T element type
+ */
+template <std::size_t N, typename T>
+struct affine
+{
+	static_assert(N > 0);
+
+	using value_type  = T;
+	using linear_type = mat<N, N, T>;
+	using vec_type    = vec<N, T>;
+	using mat_type    = mat<N + 1, N + 1, T>;
+
+	static_assert(meta::array_layout<linear_type, T, N * N> && meta::array_layout<vec_type, T, N>, "affine transformation elements must be laid out as an array");
+
+	/**
+	 * @brief Linear block.
+	 */
+	linear_type linear;
+
+	/**
+	 * @brief Translation.
+	 */
+	vec_type translation;
+
+	/**
+	 * @brief Default constructor.
+	 *
+	 * Elements are value-initialized.
+	 */
+	constexpr affine() noexcept = default;
+
+	/**
+	 * @brief Constructor from linear block and translation.
+	 */
+	constexpr affine(linear_type linear, vec_type translation = {}) noexcept;
+
+	/**
+	 * @brief Constructor from homogeneous transformation matrix.
+	 *
+	 * This copies the upper-left @p N by @p N block and the first @p N rows of the last column of @p m,
+	 * discarding its last row, which is lossless for affine transformation matrices.
+	 */
+	constexpr explicit affine(mat_type const& m) noexcept;
+
+	/**
+	 * @brief Identity transformation.
+	 */
+	[[nodiscard]]
+	static constexpr auto identity() noexcept -> affine;
+};
+}
+
+#include "affine.inl"
+
+#endif
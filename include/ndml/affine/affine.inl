@@ -0,0 +1,31 @@
+#include <utility>
+
+namespace ndml
+{
+template <std::size_t N, typename T>
+constexpr affine<N, T>::affine(linear_type linear, vec_type translation) noexcept
+	: linear{std::move(linear)}
+	, translation{std::move(translation)}
+{
+}
+
+template <std::size_t N, typename T>
+constexpr affine<N, T>::affine(mat_type const& m) noexcept
+{
+	for (std::size_t i = 0; i < N; ++i)
+	{
+		for (std::size_t j = 0; j < N; ++j)
+		{
+			linear[i, j] = m[i, j];
+		}
+
+		translation[i] = m[N, i];
+	}
+}
+
+template <std::size_t N, typename T>
+constexpr auto affine<N, T>::identity() noexcept -> affine
+{
+	return {linear_type{T{1}}};
+}
+}
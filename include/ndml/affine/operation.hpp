@@ -0,0 +1,113 @@
+#ifndef NDML_AFFINE_OPERATION_HPP
+#define NDML_AFFINE_OPERATION_HPP
+
+#include "affine.hpp"
+
+#include "ndml/mat/operation.hpp"
+#include "ndml/vec/operation.hpp"
+
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+namespace ndml
+{
+/**
+ * @brief Comparison operator.
+ *
+ * @return whether the linear blocks and translations of @p lhs and @p rhs are equal
+ */
+template <std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto operator==(affine<N, T> const& lhs, affine<N, T> const& rhs) noexcept -> bool;
+
+/**
+ * @brief Inverse of an affine transformation.
+ *
+ * This inverts the linear block @f$ L @f$ alone, giving the transformation of linear block @f$ L^{-1} @f$ and translation @f$ -L^{-1} t @f$.
+ *
+ * @warning Behavior is undefined if the linear block of @p a is singular.
+ *
+ * @return the inverse of @p a
+ */
+template <std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto inverse(affine<N, T> const& a) noexcept -> affine<N, T>;
+
+/**
+ * @brief Inverse of a rigid transformation.
+ *
+ * This calculates the inverse of a transformation whose linear block @f$ R @f$ is orthonormal,
+ * i.e. a rotation with an optional reflection, giving the transformation of linear block @f$ R^T @f$ and translation @f$ -R^T t @f$.
+ *
+ * @return the inverse of @p a
+ */
+template <std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto rigid_inverse(affine<N, T> const& a) noexcept -> affine<N, T>;
+
+/**
+ * @brief Affine transformation composition assignment operator.
+ *
+ * Composes @p lhs with @p rhs and assigns the result to @p lhs.
+ */
+template <std::size_t N, typename T>
+constexpr auto operator*=(affine<N, T>& lhs, affine<N, T> const& rhs) noexcept -> affine<N, T>&;
+
+/**
+ * @brief Affine transformation composition operator.
+ *
+ * Calculates the transformation of linear block @f$ L_l L_r @f$ and translation @f$ L_l t_r + t_l @f$,
+ * i.e. the transformation of @p rhs followed by that of @p lhs, as is the product of their matrices.
+ */
+template <std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto operator*(affine<N, T> const& lhs, affine<N, T> const& rhs) noexcept -> affine<N, T>;
+
+/**
+ * @brief Transformation of a point.
+ *
+ * @return @f$ L p + t @f$
+ */
+template <std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto operator*(affine<N, T> const& a, vec<N, T> const& p) noexcept -> vec<N, T>;
+
+/**
+ * @brief Transformation of a homogeneous vector.
+ *
+ * As for the homogeneous transformation matrix of @p a, the first @p N components of @p v are transformed by the linear block
+ * and translated by the translation scaled by the last component, which is preserved.
+ * Thus directions, whose last component is zero, are not translated, whereas points, whose last component is one, are.
+ */
+template <std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto operator*(affine<N, T> const& a, vec<N + 1, T> const& v) noexcept -> vec<N + 1, T>;
+
+/**
+ * @brief Transformation of a direction.
+ *
+ * @return @f$ L d @f$, i.e. the direction @p d transformed without translation
+ */
+template <std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto transform_direction(affine<N, T> const& a, vec<N, T> const& d) noexcept -> vec<N, T>;
+
+/**
+ * @brief Batch transformation of points.
+ *
+ * Transforms each point of @p in by @p a and stores the results to the respective points of @p out.
+ * @p in and @p out may refer to the same points.
+ *
+ * @warning Behavior is undefined if @p out is shorter than @p in.
+ *
+ * @return the first @c in.size() points of @p out
+ */
+template <std::size_t N, typename T>
+constexpr auto transform(affine<N, T> const& a, std::type_identity_t<std::span<vec<N, T> const>> in, std::type_identity_t<std::span<vec<N, T>>> out) noexcept
+	-> std::span<vec<N, T>>;
+}
+
+#include "operation.inl"
+
+#endif
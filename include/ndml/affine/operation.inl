@@ -0,0 +1,94 @@
+#include "ndml/meta/unroll.hpp"
+
+namespace ndml
+{
+template <std::size_t N, typename T>
+constexpr auto operator==(affine<N, T> const& lhs, affine<N, T> const& rhs) noexcept -> bool
+{
+	return lhs.linear == rhs.linear && lhs.translation == rhs.translation;
+}
+
+template <std::size_t N, typename T>
+constexpr auto inverse(affine<N, T> const& a) noexcept -> affine<N, T>
+{
+	auto const linear = inverse(a.linear);
+
+	return {linear, -(linear * a.translation)};
+}
+
+template <std::size_t N, typename T>
+constexpr auto rigid_inverse(affine<N, T> const& a) noexcept -> affine<N, T>
+{
+	auto const linear = transpose(a.linear);
+
+	return {linear, -(linear * a.translation)};
+}
+
+template <std::size_t N, typename T>
+constexpr auto operator*=(affine<N, T>& lhs, affine<N, T> const& rhs) noexcept -> affine<N, T>&
+{
+	lhs = lhs * rhs;
+	return lhs;
+}
+
+template <std::size_t N, typename T>
+constexpr auto operator*(affine<N, T> const& lhs, affine<N, T> const& rhs) noexcept -> affine<N, T>
+{
+	affine<N, T> p;
+
+	// each element is accumulated in a scalar, as the columns of N elements map poorly onto vector registers
+	meta::unroll<N * (N + 1)>([&p, &lhs, &rhs](auto... k) {
+		(
+			[&] {
+				constexpr auto j = decltype(k)::value / N;
+				constexpr auto i = decltype(k)::value % N;
+
+				auto const& column = j < N ? rhs.linear[j] : rhs.translation;
+				auto&       result = j < N ? p.linear[j] : p.translation;
+
+				T acc = j < N ? T{0} : get<i>(lhs.translation);
+				meta::unroll<N>([&](auto... m) { ((acc += get<i>(lhs.linear[m]) * get<m>(column)), ...); });
+
+				get<i>(result) = acc;
+			}(),
+			...
+		);
+	});
+
+	return p;
+}
+
+template <std::size_t N, typename T>
+constexpr auto operator*(affine<N, T> const& a, vec<N, T> const& p) noexcept -> vec<N, T>
+{
+	return a.linear * p + a.translation;
+}
+
+template <std::size_t N, typename T>
+constexpr auto operator*(affine<N, T> const& a, vec<N + 1, T> const& v) noexcept -> vec<N + 1, T>
+{
+	return meta::unroll<N>([&a, &v](auto... i) {
+		auto const p = a.linear * vec<N, T>{get<i>(v)...} + get<N>(v) * a.translation;
+
+		return vec<N + 1, T>{get<i>(p)..., get<N>(v)};
+	});
+}
+
+template <std::size_t N, typename T>
+constexpr auto transform_direction(affine<N, T> const& a, vec<N, T> const& d) noexcept -> vec<N, T>
+{
+	return a.linear * d;
+}
+
+template <std::size_t N, typename T>
+constexpr auto transform(affine<N, T> const& a, std::type_identity_t<std::span<vec<N, T> const>> in, std::type_identity_t<std::span<vec<N, T>>> out) noexcept
+	-> std::span<vec<N, T>>
+{
+	for (std::size_t i = 0; i < in.size(); ++i)
+	{
+		out[i] = a * in[i];
+	}
+
+	return out.first(in.size());
+}
+}
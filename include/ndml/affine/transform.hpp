@@ -0,0 +1,86 @@
+#ifndef NDML_AFFINE_TRANSFORM_HPP
+#define NDML_AFFINE_TRANSFORM_HPP
+
+#include "affine.hpp"
+#include "operation.hpp"
+
+#include "ndml/mat/transform.hpp"
+#include "ndml/math/policy.hpp"
+
+#include <cstddef>
+
+namespace ndml
+{
+/**
+ * @brief Translation transformation.
+ *
+ * This is the affine counterpart of @ref translation.
+ *
+ * @param v translation vector
+ */
+template <std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto affine_translation(vec<N, T> const& v) noexcept -> affine<N, T>;
+
+/**
+ * @brief Scale transformation.
+ *
+ * This is the affine counterpart of @ref scale.
+ *
+ * @param v scale factors along the respective axes
+ */
+template <std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto affine_scale(vec<N, T> const& v) noexcept -> affine<N, T>;
+
+/**
+ * @brief Two-dimensional rotation transformation.
+ *
+ * This is the affine counterpart of @ref rotation of an angle.
+ *
+ * @param angle  angle in radians
+ * @param policy math policy of sine and cosine calculation
+ */
+template <typename T, math::policy P = math::default_policy>
+[[nodiscard]]
+constexpr auto affine_rotation(T const& angle, P policy = P{}) noexcept -> affine<2, T>;
+
+/**
+ * @brief Three-dimensional rotation transformation.
+ *
+ * This is the affine counterpart of @ref rotation along an axis.
+ *
+ * @param axis   normal rotation axis
+ * @param angle  angle in radians
+ * @param policy math policy of sine and cosine calculation
+ */
+template <typename T, math::policy P = math::default_policy>
+[[nodiscard]]
+constexpr auto affine_rotation(vec<3, T> const& axis, typename vec<3, T>::value_type const& angle, P policy = P{}) noexcept -> affine<3, T>;
+
+/**
+ * @brief Look-at transformation.
+ *
+ * This is the affine counterpart of @ref look_at.
+ *
+ * @param eye    sight origin
+ * @param target sight target
+ * @param up     normal sight up direction
+ */
+template <typename T>
+[[nodiscard]]
+constexpr auto affine_look_at(vec<3, T> const& eye, vec<3, T> const& target, vec<3, T> const& up) noexcept -> affine<3, T>;
+
+/**
+ * @brief Affine transformation to matrix conversion.
+ *
+ * @return the homogeneous transformation matrix of @p a, whose last row is @f$ (0, \dots, 0, 1) @f$
+ */
+template <std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto transformation(affine<N, T> const& a) noexcept -> mat<N + 1, N + 1, T>;
+}
+
+#include "transform.inl"
+
+#endif
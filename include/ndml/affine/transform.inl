@@ -0,0 +1,59 @@
+namespace ndml
+{
+template <std::size_t N, typename T>
+constexpr auto affine_translation(vec<N, T> const& v) noexcept -> affine<N, T>
+{
+	return {mat<N, N, T>{T{1}}, v};
+}
+
+template <std::size_t N, typename T>
+constexpr auto affine_scale(vec<N, T> const& v) noexcept -> affine<N, T>
+{
+	mat<N, N, T> s;
+
+	for (std::size_t i = 0; i < N; ++i)
+	{
+		s[i, i] = v[i];
+	}
+
+	return {s};
+}
+
+template <typename T, math::policy P>
+constexpr auto affine_rotation(T const& angle, P policy) noexcept -> affine<2, T>
+{
+	return affine<2, T>{rotation(angle, policy)};
+}
+
+template <typename T, math::policy P>
+constexpr auto affine_rotation(vec<3, T> const& axis, typename vec<3, T>::value_type const& angle, P policy) noexcept -> affine<3, T>
+{
+	return affine<3, T>{rotation(axis, angle, policy)};
+}
+
+template <typename T>
+constexpr auto affine_look_at(vec<3, T> const& eye, vec<3, T> const& target, vec<3, T> const& up) noexcept -> affine<3, T>
+{
+	return affine<3, T>{look_at(eye, target, up)};
+}
+
+template <std::size_t N, typename T>
+constexpr auto transformation(affine<N, T> const& a) noexcept -> mat<N + 1, N + 1, T>
+{
+	mat<N + 1, N + 1, T> m;
+
+	for (std::size_t i = 0; i < N; ++i)
+	{
+		for (std::size_t j = 0; j < N; ++j)
+		{
+			m[i, j] = a.linear[i, j];
+		}
+
+		m[N, i] = a.translation[i];
+	}
+
+	m[N, N] = T{1};
+
+	return m;
+}
+}
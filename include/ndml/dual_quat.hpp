@@ -0,0 +1,8 @@
+#ifndef NDML_DUAL_QUAT_HPP
+#define NDML_DUAL_QUAT_HPP
+
+#include "dual_quat/dual_quat.hpp"
+#include "dual_quat/operation.hpp"
+#include "dual_quat/transform.hpp"
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef NDML_DUAL_QUAT_DUAL_QUAT_HPP
+#define NDML_DUAL_QUAT_DUAL_QUAT_HPP
+
+#include "ndml/meta/layout.hpp"
+#include "ndml/quat/quat.hpp"
+
+#include <array>
+
+namespace ndml
+{
+/**
+ * @brief Dual quaternion.
+ *
+ * A dual number whose real and dual parts are quaternions, represented as @f$ r + \varepsilon d @f$,
+ * where @f$ \varepsilon^2 = 0 @f$.
+ *
+ * A unit dual quaternion, i.e. one whose real part is a versor orthogonal to its dual part, represents a rigid transformation:
+ * the real part is its rotation @f$ q @f$, and the dual part is equal to @f$ \frac 1 2 t q @f$, where @f$ t @f$ is
+ * its translation as a pure quaternion. Such transformations are composed by multiplication, as are matrices,
+ * from eight components instead of sixteen.
+ *
+ * @tparam T element type
+ */
+template <typename T>
+struct dual_quat
+{
+	using value_type = T;
+	using quat_type  = quat<T>;
+
+	static_assert(meta::array_layout<std::array<quat_type, 2>, T, 8>, "dual quaternion components must be laid out as an array");
+
+	/**
+	 * @brief Real part.
+	 */
+	quat_type real;
+
+	/**
+	 * @brief Dual part.
+	 */
+	quat_type dual;
+
+	/**
+	 * @brief Default constructor.
+	 *
+	 * Components are value-initialized.
+	 */
+	constexpr dual_quat() noexcept = default;
+
+	/**
+	 * @brief Constructor from real and dual parts.
+	 */
+	constexpr dual_quat(quat_type real, quat_type dual) noexcept;
+
+	/**
+	 * @brief Identity dual quaternion.
+	 *
+	 * @return the unit dual quaternion of no rotation and no translation
+	 */
+	[[nodiscard]]
+	static constexpr auto identity() noexcept -> dual_quat;
+};
+}
+
+#include "dual_quat.inl"
+
+#endif
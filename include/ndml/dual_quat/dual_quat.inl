@@ -0,0 +1,17 @@
+#include <utility>
+
+namespace ndml
+{
+template <typename T>
+constexpr dual_quat<T>::dual_quat(quat_type real, quat_type dual) noexcept
+	: real{std::move(real)}
+	, dual{std::move(dual)}
+{
+}
+
+template <typename T>
+constexpr auto dual_quat<T>::identity() noexcept -> dual_quat
+{
+	return {quat_type{T{0}, T{0}, T{0}, T{1}}, quat_type{}};
+}
+}
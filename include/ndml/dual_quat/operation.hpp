@@ -0,0 +1,130 @@
+#ifndef NDML_DUAL_QUAT_OPERATION_HPP
+#define NDML_DUAL_QUAT_OPERATION_HPP
+
+#include "dual_quat.hpp"
+
+#include "ndml/math/policy.hpp"
+#include "ndml/quat/operation.hpp"
+
+#include <span>
+#include <type_traits>
+
+namespace ndml
+{
+/**
+ * @brief Comparison operator.
+ *
+ * @return whether the respective parts of @p lhs and @p rhs are equal
+ */
+template <typename T>
+[[nodiscard]]
+constexpr auto operator==(dual_quat<T> const& lhs, dual_quat<T> const& rhs) noexcept -> bool;
+
+/**
+ * @brief Conjugate of a dual quaternion.
+ *
+ * This calculates the quaternion conjugates of both parts, which is the inverse of a unit dual quaternion.
+ *
+ * @return the conjugate of @p dq
+ */
+template <typename T>
+[[nodiscard]]
+constexpr auto conjugate(dual_quat<T> const& dq) noexcept -> dual_quat<T>;
+
+/**
+ * @brief Inverse of a dual quaternion.
+ *
+ * This calculates @f$ r^{-1} - \varepsilon r^{-1} d r^{-1} @f$, given real part @f$ r @f$ and dual part @f$ d @f$ of @p dq.
+ * For unit dual quaternions, @ref conjugate is equal to it and cheaper.
+ *
+ * @warning Behavior is undefined if the real part of @p dq is zero.
+ *
+ * @return the inverse of @p dq
+ */
+template <typename T>
+[[nodiscard]]
+constexpr auto inverse(dual_quat<T> const& dq) noexcept -> dual_quat<T>;
+
+/**
+ * @brief Normalization of a dual quaternion.
+ *
+ * This divides both parts by the norm of the real part, and removes the projection of the dual part onto the real one,
+ * so that the result is a unit dual quaternion, e.g. after blending or accumulating products.
+ *
+ * @tparam P math policy of the reciprocal norm calculation
+ *
+ * @warning Behavior is undefined if the real part of @p dq is zero.
+ *
+ * @return the unit dual quaternion nearest to @p dq
+ */
+template <typename T, math::policy P = math::default_policy>
+[[nodiscard]]
+constexpr auto normal(dual_quat<T> const& dq, P policy = P{}) noexcept -> dual_quat<T>;
+
+/**
+ * @brief Dual quaternion multiplication assignment operator.
+ *
+ * Calculates the product of @p lhs and @p rhs and assigns the result to @p lhs.
+ */
+template <typename T>
+constexpr auto operator*=(dual_quat<T>& lhs, dual_quat<T> const& rhs) noexcept -> dual_quat<T>&;
+
+/**
+ * @brief Dual quaternion multiplication operator.
+ *
+ * Calculates @f$ r_l r_r + \varepsilon (r_l d_r + d_l r_r) @f$, which for unit dual quaternions is the composition
+ * of the transformation of @p rhs followed by that of @p lhs, as is the product of their matrices.
+ */
+template <typename T>
+[[nodiscard]]
+constexpr auto operator*(dual_quat<T> const& lhs, dual_quat<T> const& rhs) noexcept -> dual_quat<T>;
+
+/**
+ * @brief Transformation of a point by unit dual quaternion.
+ *
+ * Rotates @p p by the real part of @p dq and translates it by the translation of @p dq.
+ */
+template <typename T>
+[[nodiscard]]
+constexpr auto operator*(dual_quat<T> const& dq, vec<3, T> const& p) noexcept -> vec<3, T>;
+
+/**
+ * @brief Transformation of a homogeneous vector by unit dual quaternion.
+ *
+ * As for a rigid transformation matrix, the first three components of @p v are rotated by the real part of @p dq
+ * and translated by the translation of @p dq scaled by the W component, which is preserved.
+ * Thus directions, whose W component is zero, are only rotated, whereas points, whose W component is one, are also translated.
+ */
+template <typename T>
+[[nodiscard]]
+constexpr auto operator*(dual_quat<T> const& dq, vec<4, T> const& v) noexcept -> vec<4, T>;
+
+/**
+ * @brief Dual quaternion linear blending.
+ *
+ * This calculates the weighted sum of @p transforms, negating those whose real part lies in the opposite hemisphere
+ * to the real part of the first one so that all of them blend along the shortest path, and normalizes it,
+ * as per L. Kavan et al., "Skinning with Dual Quaternions". Unlike blending of matrices, the result is a rigid transformation.
+ *
+ * @tparam P math policy of the normalization
+ *
+ * @param transforms unit dual quaternions, e.g. of bones influencing a vertex
+ * @param weights    respective weights, whose sum is not zero
+ * @param policy     math policy
+ *
+ * @warning Behavior is undefined if @p transforms is empty, or if @p weights is shorter than @p transforms.
+ *
+ * @return the blended unit dual quaternion
+ */
+template <typename T, math::policy P = math::default_policy>
+[[nodiscard]]
+constexpr auto blend(
+	std::type_identity_t<std::span<dual_quat<T> const>> transforms,
+	std::type_identity_t<std::span<T const>>            weights,
+	P                                                   policy = P{}
+) noexcept -> dual_quat<T>;
+}
+
+#include "operation.inl"
+
+#endif
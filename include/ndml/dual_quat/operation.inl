@@ -0,0 +1,119 @@
+#include "ndml/math/function.hpp"
+
+#include <cmath>
+
+namespace ndml
+{
+namespace detail
+{
+/**
+ * @brief Translation of a unit dual quaternion.
+ *
+ * This calculates the imaginary part of @f$ 2 d r^* @f$, given real part @f$ r @f$ and dual part @f$ d @f$ of @p dq,
+ * without calculating its real part.
+ */
+template <typename T>
+constexpr auto dual_translation(dual_quat<T> const& dq) noexcept -> vec<3, T>
+{
+	auto const real_imag = dq.real.xyz();
+	auto const dual_imag = dq.dual.xyz();
+
+	return T{2} * (dq.real.w * dual_imag - dq.dual.w * real_imag + cross(real_imag, dual_imag));
+}
+}
+
+template <typename T>
+constexpr auto operator==(dual_quat<T> const& lhs, dual_quat<T> const& rhs) noexcept -> bool
+{
+	return lhs.real == rhs.real && lhs.dual == rhs.dual;
+}
+
+template <typename T>
+constexpr auto conjugate(dual_quat<T> const& dq) noexcept -> dual_quat<T>
+{
+	return {conjugate(dq.real), conjugate(dq.dual)};
+}
+
+template <typename T>
+constexpr auto inverse(dual_quat<T> const& dq) noexcept -> dual_quat<T>
+{
+	auto const real_inverse = inverse(dq.real);
+
+	return {real_inverse, quat<T>{-(real_inverse * dq.dual * real_inverse)}};
+}
+
+template <typename T, math::policy P>
+constexpr auto normal(dual_quat<T> const& dq, P policy) noexcept -> dual_quat<T>
+{
+	auto const inv_norm = math::rsqrt(norm_squared(dq.real), policy);
+
+	quat<T> const real{dq.real * inv_norm};
+	quat<T> const dual{dq.dual * inv_norm};
+
+	return {real, quat<T>{dual - real * dot(real, dual)}};
+}
+
+template <typename T>
+constexpr auto operator*=(dual_quat<T>& lhs, dual_quat<T> const& rhs) noexcept -> dual_quat<T>&
+{
+	lhs = lhs * rhs;
+	return lhs;
+}
+
+template <typename T>
+constexpr auto operator*(dual_quat<T> const& lhs, dual_quat<T> const& rhs) noexcept -> dual_quat<T>
+{
+	auto const& a = lhs.real;
+	auto const& b = lhs.dual;
+	auto const& c = rhs.real;
+	auto const& d = rhs.dual;
+
+	// both Hamilton products of the dual part are summed per component, so that neither is materialized
+	return {
+		a * c,
+		quat<T>{
+			(a.w * d.x + a.x * d.w + a.y * d.z - a.z * d.y) + (b.w * c.x + b.x * c.w + b.y * c.z - b.z * c.y),
+			(a.w * d.y - a.x * d.z + a.y * d.w + a.z * d.x) + (b.w * c.y - b.x * c.z + b.y * c.w + b.z * c.x),
+			(a.w * d.z + a.x * d.y - a.y * d.x + a.z * d.w) + (b.w * c.z + b.x * c.y - b.y * c.x + b.z * c.w),
+			(a.w * d.w - a.x * d.x - a.y * d.y - a.z * d.z) + (b.w * c.w - b.x * c.x - b.y * c.y - b.z * c.z),
+		},
+	};
+}
+
+template <typename T>
+constexpr auto operator*(dual_quat<T> const& dq, vec<3, T> const& p) noexcept -> vec<3, T>
+{
+	return dq.real * p + detail::dual_translation(dq);
+}
+
+template <typename T>
+constexpr auto operator*(dual_quat<T> const& dq, vec<4, T> const& v) noexcept -> vec<4, T>
+{
+	auto const p = dq.real * v.xyz() + v.w * detail::dual_translation(dq);
+
+	return {p.x, p.y, p.z, v.w};
+}
+
+template <typename T, math::policy P>
+constexpr auto blend(
+	std::type_identity_t<std::span<dual_quat<T> const>> transforms,
+	std::type_identity_t<std::span<T const>>            weights,
+	P                                                   policy
+) noexcept -> dual_quat<T>
+{
+	auto const& pivot = transforms.front().real;
+
+	vec<4, T> real{};
+	vec<4, T> dual{};
+
+	for (std::size_t i = 0; i < transforms.size(); ++i)
+	{
+		auto const weight = weights[i] * std::copysign(T{1}, dot(pivot, transforms[i].real));
+
+		real += transforms[i].real * weight;
+		dual += transforms[i].dual * weight;
+	}
+
+	return normal(dual_quat<T>{real, dual}, policy);
+}
+}
@@ -0,0 +1,60 @@
+#ifndef NDML_DUAL_QUAT_TRANSFORM_HPP
+#define NDML_DUAL_QUAT_TRANSFORM_HPP
+
+#include "dual_quat.hpp"
+#include "operation.hpp"
+
+#include "ndml/mat/mat.hpp"
+#include "ndml/quat/transform.hpp"
+
+namespace ndml
+{
+/**
+ * @brief Unit dual quaternion from rotation and translation.
+ *
+ * This initializes a dual quaternion equal to @f$ q + \varepsilon \frac 1 2 t q @f$,
+ * where @f$ q @f$ is equal to @p rotation and @f$ t @f$ is equal to @p translation as a pure quaternion,
+ * i.e. the transformation rotating by @p rotation first and translating by @p translation then.
+ *
+ * @param rotation    versor of rotation
+ * @param translation translation vector
+ */
+template <typename T>
+[[nodiscard]]
+constexpr auto dual_versor(quat<T> const& rotation, vec<3, T> const& translation) noexcept -> dual_quat<T>;
+
+/**
+ * @brief Unit dual quaternion from rigid transformation matrix.
+ *
+ * This extracts the versor of the upper-left three-by-three block of @p m, as per @ref versor,
+ * and the translation of its last column.
+ *
+ * @param m rigid transformation matrix, i.e. a rotation followed by a translation
+ */
+template <typename T>
+[[nodiscard]]
+constexpr auto dual_versor(mat<4, 4, T> const& m) noexcept -> dual_quat<T>;
+
+/**
+ * @brief Translation of unit dual quaternion.
+ *
+ * @return the translation vector of @p dq, equal to the imaginary part of @f$ 2 d r^* @f$
+ */
+template <typename T>
+[[nodiscard]]
+constexpr auto translation(dual_quat<T> const& dq) noexcept -> vec<3, T>;
+
+/**
+ * @brief Unit dual quaternion to matrix conversion.
+ *
+ * This calculates the rigid transformation matrix of @p dq, the upper-left three-by-three block of which is
+ * the rotation matrix of its real part, as per @ref rotation, and the last column of which is its translation.
+ */
+template <typename T>
+[[nodiscard]]
+constexpr auto transformation(dual_quat<T> const& dq) noexcept -> mat<4, 4, T>;
+}
+
+#include "transform.inl"
+
+#endif
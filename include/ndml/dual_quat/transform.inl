@@ -0,0 +1,31 @@
+namespace ndml
+{
+template <typename T>
+constexpr auto dual_versor(quat<T> const& rotation, vec<3, T> const& translation) noexcept -> dual_quat<T>
+{
+	return {rotation, quat<T>{quat<T>{translation / T{2}, T{0}} * rotation}};
+}
+
+template <typename T>
+constexpr auto dual_versor(mat<4, 4, T> const& m) noexcept -> dual_quat<T>
+{
+	return dual_versor(versor(m), vec<3, T>{m[3].x, m[3].y, m[3].z});
+}
+
+template <typename T>
+constexpr auto translation(dual_quat<T> const& dq) noexcept -> vec<3, T>
+{
+	return detail::dual_translation(dq);
+}
+
+template <typename T>
+constexpr auto transformation(dual_quat<T> const& dq) noexcept -> mat<4, 4, T>
+{
+	auto m = rotation<4>(dq.real);
+
+	auto const t = detail::dual_translation(dq);
+	m[3]         = vec<4, T>{t.x, t.y, t.z, T{1}};
+
+	return m;
+}
+}
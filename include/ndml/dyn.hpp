@@ -0,0 +1,9 @@
+#ifndef NDML_DYN_HPP
+#define NDML_DYN_HPP
+
+#include "dyn/view.hpp"
+#include "dyn/vec.hpp"
+#include "dyn/mat.hpp"
+#include "dyn/operation.hpp"
+
+#endif
@@ -0,0 +1,199 @@
+#ifndef NDML_DYN_MAT_HPP
+#define NDML_DYN_MAT_HPP
+
+#include "view.hpp"
+
+#include "ndml/mat/mat.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+namespace ndml
+{
+/**
+ * @brief Matrix of runtime dimensions.
+ *
+ * Elements are stored contiguously and column-major, like the ones of @c mat, in memory obtained from @p Allocator.
+ * It converts to a @c dyn_mat_view, through which fixed-size and runtime-sized matrices are operated on alike.
+ *
+ * @tparam T         element type
+ * @tparam Allocator allocator of elements
+ */
+template <typename T, typename Allocator = std::allocator<T>>
+struct dyn_mat
+{
+	using value_type     = T;
+	using allocator_type = Allocator;
+	using column_type    = std::span<value_type>;
+	using view_type      = dyn_mat_view<value_type>;
+
+	/**
+	 * @brief Default constructor.
+	 *
+	 * The matrix has no rows and no columns.
+	 */
+	constexpr dyn_mat() = default;
+
+	/**
+	 * @brief Constructor from allocator.
+	 *
+	 * The matrix has no rows and no columns and will allocate its elements with @p allocator.
+	 */
+	constexpr explicit dyn_mat(allocator_type const& allocator) noexcept;
+
+	/**
+	 * @brief Constructor from dimensions.
+	 *
+	 * This will allocate @p rows * @p columns value-initialized elements with @p allocator,
+	 * i.e. the matrix will be equal to the zero matrix.
+	 */
+	constexpr dyn_mat(std::size_t rows, std::size_t columns, allocator_type const& allocator = {});
+
+	/**
+	 * @brief Constructor from dimensions and scale.
+	 *
+	 * This will initialize all entries along the main diagonal to @p scale and the others to zero.
+	 */
+	constexpr dyn_mat(std::size_t rows, std::size_t columns, value_type const& scale, allocator_type const& allocator = {});
+
+	/**
+	 * @brief Constructor from a view.
+	 *
+	 * This will copy elements of @p v to ones allocated with @p allocator.
+	 */
+	constexpr explicit dyn_mat(dyn_mat_view<value_type const> v, allocator_type const& allocator = {});
+
+	/**
+	 * @brief Constructor from a fixed-size matrix.
+	 *
+	 * This will copy elements of @p m to ones allocated with @p allocator.
+	 */
+	template <std::size_t R, std::size_t C>
+	constexpr explicit dyn_mat(mat<R, C, value_type> const& m, allocator_type const& allocator = {});
+
+	/**
+	 * @brief Allocator of elements.
+	 */
+	[[nodiscard]]
+	constexpr auto get_allocator(this dyn_mat const& self) noexcept -> allocator_type;
+
+	/**
+	 * @brief Number of rows.
+	 */
+	[[nodiscard]]
+	constexpr auto rows(this dyn_mat const& self) noexcept -> std::size_t;
+
+	/**
+	 * @brief Number of columns.
+	 */
+	[[nodiscard]]
+	constexpr auto columns(this dyn_mat const& self) noexcept -> std::size_t;
+
+	/**
+	 * @brief Size of matrix.
+	 *
+	 * This returns the number of columns as the matrix is stored column-major.
+	 *
+	 * @return the number of columns
+	 */
+	[[nodiscard]]
+	constexpr auto size(this dyn_mat const& self) noexcept -> std::size_t;
+
+	/**
+	 * @brief Whether the matrix has no elements.
+	 */
+	[[nodiscard]]
+	constexpr auto empty(this dyn_mat const& self) noexcept -> bool;
+
+	/**
+	 * @brief Pointer to the elements.
+	 *
+	 * @return pointer to the element at the intersection of the first column and the first row
+	 */
+	[[nodiscard]]
+	constexpr auto data(this auto&& self) noexcept -> decltype(auto);
+
+	/**
+	 * @brief View of the matrix.
+	 *
+	 * @return view of mutable elements for a mutable matrix and of constant elements otherwise
+	 */
+	[[nodiscard]]
+	constexpr auto view(this auto&& self) noexcept -> decltype(auto);
+
+	/**
+	 * @brief Conversion operator to a view of mutable elements.
+	 */
+	[[nodiscard]]
+	constexpr operator dyn_mat_view<value_type>(this dyn_mat& self) noexcept;
+
+	/**
+	 * @brief Conversion operator to a view of constant elements.
+	 */
+	[[nodiscard]]
+	constexpr operator dyn_mat_view<value_type const>(this dyn_mat const& self) noexcept;
+
+	/**
+	 * @brief Column subscript operator.
+	 *
+	 * This retrieves the column at index @p column.
+	 *
+	 * @param column column index
+	 *
+	 * @return span of elements of the column at index @p column
+	 *
+	 * @warning Behavior is undefined when @p column >= @c columns().
+	 */
+	[[nodiscard]]
+	constexpr auto operator[](this auto&& self, std::size_t column) noexcept -> decltype(auto);
+
+	/**
+	 * @brief Element subscript operator.
+	 *
+	 * This retrieves the element at the intersection of column @p column and row @p row.
+	 *
+	 * @param column column index
+	 * @param row    row index
+	 *
+	 * @return element at the intersection of column @p column and row @p row
+	 *
+	 * @warning Behavior is undefined when @p column >= @c columns() or @p row >= @c rows().
+	 */
+	[[nodiscard]]
+	constexpr auto operator[](this auto&& self, std::size_t column, std::size_t row) noexcept -> decltype(auto);
+
+	/**
+	 * @brief Equality comparison operator.
+	 *
+	 * Matrices are equal if they are of the same dimensions and their respective elements are equal.
+	 */
+	[[nodiscard]]
+	constexpr auto operator==(this dyn_mat const& self, dyn_mat const& other) noexcept -> bool;
+
+private:
+	/// Number of rows.
+	std::size_t rows_{};
+
+	/// Number of columns.
+	std::size_t columns_{};
+
+	/// Matrix elements, stored column-major.
+	std::vector<value_type, allocator_type> elements_;
+};
+
+namespace pmr
+{
+/**
+ * @brief Runtime-sized matrix allocating from a memory resource, e.g. a @c std::pmr::monotonic_buffer_resource.
+ */
+template <typename T>
+using dyn_mat = ndml::dyn_mat<T, std::pmr::polymorphic_allocator<T>>;
+}
+}
+
+#include "mat.inl"
+
+#endif
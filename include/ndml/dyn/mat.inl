@@ -0,0 +1,124 @@
+#include "ndml/meta/unroll.hpp"
+
+#include <algorithm>
+#include <type_traits>
+
+namespace ndml
+{
+template <typename T, typename Allocator>
+constexpr dyn_mat<T, Allocator>::dyn_mat(allocator_type const& allocator) noexcept
+	: elements_(allocator)
+{
+}
+
+template <typename T, typename Allocator>
+constexpr dyn_mat<T, Allocator>::dyn_mat(std::size_t rows, std::size_t columns, allocator_type const& allocator)
+	: rows_{rows}
+	, columns_{columns}
+	, elements_(rows * columns, allocator)
+{
+}
+
+template <typename T, typename Allocator>
+constexpr dyn_mat<T, Allocator>::dyn_mat(std::size_t rows, std::size_t columns, value_type const& scale, allocator_type const& allocator)
+	: dyn_mat(rows, columns, allocator)
+{
+	for (std::size_t i = 0; i < std::min(rows, columns); ++i)
+	{
+		(*this)[i, i] = scale;
+	}
+}
+
+template <typename T, typename Allocator>
+constexpr dyn_mat<T, Allocator>::dyn_mat(dyn_mat_view<value_type const> v, allocator_type const& allocator)
+	: rows_{v.rows()}
+	, columns_{v.columns()}
+	, elements_(v.data(), v.data() + v.rows() * v.columns(), allocator)
+{
+}
+
+template <typename T, typename Allocator>
+template <std::size_t R, std::size_t C>
+constexpr dyn_mat<T, Allocator>::dyn_mat(mat<R, C, value_type> const& m, allocator_type const& allocator)
+	: dyn_mat(R, C, allocator)
+{
+	for (std::size_t i = 0; i < C; ++i)
+	{
+		meta::unroll<R>([c = (*this)[i], &m, i](auto... j) { ((c[j] = get<j>(m[i])), ...); });
+	}
+}
+
+template <typename T, typename Allocator>
+constexpr auto dyn_mat<T, Allocator>::get_allocator(this dyn_mat const& self) noexcept -> allocator_type
+{
+	return self.elements_.get_allocator();
+}
+
+template <typename T, typename Allocator>
+constexpr auto dyn_mat<T, Allocator>::rows(this dyn_mat const& self) noexcept -> std::size_t
+{
+	return self.rows_;
+}
+
+template <typename T, typename Allocator>
+constexpr auto dyn_mat<T, Allocator>::columns(this dyn_mat const& self) noexcept -> std::size_t
+{
+	return self.columns_;
+}
+
+template <typename T, typename Allocator>
+constexpr auto dyn_mat<T, Allocator>::size(this dyn_mat const& self) noexcept -> std::size_t
+{
+	return self.columns_;
+}
+
+template <typename T, typename Allocator>
+constexpr auto dyn_mat<T, Allocator>::empty(this dyn_mat const& self) noexcept -> bool
+{
+	return self.elements_.empty();
+}
+
+template <typename T, typename Allocator>
+constexpr auto dyn_mat<T, Allocator>::data(this auto&& self) noexcept -> decltype(auto)
+{
+	return self.elements_.data();
+}
+
+template <typename T, typename Allocator>
+constexpr auto dyn_mat<T, Allocator>::view(this auto&& self) noexcept -> decltype(auto)
+{
+	using element_type = std::remove_pointer_t<decltype(self.data())>;
+
+	return dyn_mat_view<element_type>{self.data(), self.rows_, self.columns_};
+}
+
+template <typename T, typename Allocator>
+constexpr dyn_mat<T, Allocator>::operator dyn_mat_view<value_type>(this dyn_mat& self) noexcept
+{
+	return self.view();
+}
+
+template <typename T, typename Allocator>
+constexpr dyn_mat<T, Allocator>::operator dyn_mat_view<value_type const>(this dyn_mat const& self) noexcept
+{
+	return self.view();
+}
+
+template <typename T, typename Allocator>
+constexpr auto dyn_mat<T, Allocator>::operator[](this auto&& self, std::size_t column) noexcept -> decltype(auto)
+{
+	return self.view()[column];
+}
+
+template <typename T, typename Allocator>
+constexpr auto dyn_mat<T, Allocator>::operator[](this auto&& self, std::size_t column, std::size_t row) noexcept -> decltype(auto)
+{
+	return self.view()[column, row];
+}
+
+template <typename T, typename Allocator>
+constexpr auto dyn_mat<T, Allocator>::operator==(this dyn_mat const& self, dyn_mat const& other) noexcept -> bool
+{
+	return self.rows_ == other.rows_ && self.columns_ == other.columns_ && std::ranges::equal(self.elements_, other.elements_);
+}
+}
@@ -0,0 +1,252 @@
+#ifndef NDML_DYN_OPERATION_HPP
+#define NDML_DYN_OPERATION_HPP
+
+#include "mat.hpp"
+#include "vec.hpp"
+#include "view.hpp"
+
+#include <span>
+#include <type_traits>
+
+namespace ndml
+{
+/**
+ * @brief Matrix multiplication into a view.
+ *
+ * Multiplies @p lhs by @p rhs and stores the product to @p out without allocating.
+ * Either of the operands may be a view of a fixed-size matrix.
+ *
+ * @throws @c std::invalid_argument when dimensions of @p lhs, @p rhs, and @p out do not agree
+ *
+ * @warning Behavior is undefined if @p out overlaps either of the operands.
+ */
+template <typename T>
+auto multiply(std::type_identity_t<dyn_mat_view<T const>> lhs, std::type_identity_t<dyn_mat_view<T const>> rhs, dyn_mat_view<T> out) -> void;
+
+/**
+ * @brief Matrix-vector multiplication into a span.
+ *
+ * Multiplies @p m by @p v and stores the product to @p out without allocating.
+ *
+ * @throws @c std::invalid_argument when dimensions of @p m, @p v, and @p out do not agree
+ *
+ * @warning Behavior is undefined if @p out overlaps either of the operands.
+ */
+template <typename T>
+auto multiply(std::type_identity_t<dyn_mat_view<T const>> m, std::type_identity_t<std::span<T const>> v, std::span<T> out) -> void;
+
+/**
+ * @brief Transposition of a matrix.
+ *
+ * This transposes @p m, the result being allocated with the allocator of @p m.
+ */
+template <typename T, typename Allocator>
+[[nodiscard]]
+auto transpose(dyn_mat<T, Allocator> const& m) -> dyn_mat<T, Allocator>;
+
+/**
+ * @brief Determinant of a square matrix.
+ *
+ * This calculates the determinant of @p m via LU decomposition with partial pivoting.
+ *
+ * @throws @c std::invalid_argument when @p m is not square
+ */
+template <typename T, typename Allocator>
+[[nodiscard]]
+auto determinant(dyn_mat<T, Allocator> const& m) -> T;
+
+/**
+ * @brief Inverse of a square matrix.
+ *
+ * This calculates the inverse of @p m via LU decomposition with partial pivoting,
+ * the result being allocated with the allocator of @p m.
+ *
+ * @throws @c std::invalid_argument when @p m is not square
+ *
+ * @warning Behavior is undefined if @p m is singular.
+ */
+template <typename T, typename Allocator>
+[[nodiscard]]
+auto inverse(dyn_mat<T, Allocator> const& m) -> dyn_mat<T, Allocator>;
+
+/**
+ * @brief Trace of a square matrix.
+ *
+ * Calculates the sum of entries on the main diagonal of @p m.
+ *
+ * @throws @c std::invalid_argument when @p m is not square
+ */
+template <typename T, typename Allocator>
+[[nodiscard]]
+auto trace(dyn_mat<T, Allocator> const& m) -> T;
+
+/**
+ * @brief Matrix addition assignment operator.
+ *
+ * Adds elements of @p rhs to respective elements of @p lhs.
+ *
+ * @throws @c std::invalid_argument when dimensions of @p lhs and @p rhs differ
+ */
+template <typename T, typename Allocator>
+auto operator+=(dyn_mat<T, Allocator>& lhs, dyn_mat<T, Allocator> const& rhs) -> dyn_mat<T, Allocator>&;
+
+/**
+ * @brief Matrix subtraction assignment operator.
+ *
+ * Subtracts elements of @p rhs from respective elements of @p lhs.
+ *
+ * @throws @c std::invalid_argument when dimensions of @p lhs and @p rhs differ
+ */
+template <typename T, typename Allocator>
+auto operator-=(dyn_mat<T, Allocator>& lhs, dyn_mat<T, Allocator> const& rhs) -> dyn_mat<T, Allocator>&;
+
+/**
+ * @brief Matrix-scalar multiplication assignment operator.
+ *
+ * Multiplies elements of @p m by @p scale.
+ */
+template <typename T, typename Allocator>
+auto operator*=(dyn_mat<T, Allocator>& m, std::type_identity_t<T> const& scale) noexcept -> dyn_mat<T, Allocator>&;
+
+/**
+ * @brief Matrix-scalar division assignment operator.
+ *
+ * Divides elements of @p m by @p scale.
+ */
+template <typename T, typename Allocator>
+auto operator/=(dyn_mat<T, Allocator>& m, std::type_identity_t<T> const& scale) noexcept -> dyn_mat<T, Allocator>&;
+
+/**
+ * @brief Unary plus operator.
+ *
+ * Returns a copy of @p m.
+ */
+template <typename T, typename Allocator>
+[[nodiscard]]
+auto operator+(dyn_mat<T, Allocator> const& m) -> dyn_mat<T, Allocator>;
+
+/**
+ * @brief Unary minus operator.
+ *
+ * Negates elements of a copy of @p m and returns the result.
+ */
+template <typename T, typename Allocator>
+[[nodiscard]]
+auto operator-(dyn_mat<T, Allocator> const& m) -> dyn_mat<T, Allocator>;
+
+/**
+ * @brief Matrix addition operator.
+ *
+ * Adds elements of @p rhs to respective elements of a copy of @p lhs and returns the result.
+ *
+ * @throws @c std::invalid_argument when dimensions of @p lhs and @p rhs differ
+ */
+template <typename T, typename Allocator>
+[[nodiscard]]
+auto operator+(dyn_mat<T, Allocator> const& lhs, dyn_mat<T, Allocator> const& rhs) -> dyn_mat<T, Allocator>;
+
+/**
+ * @brief Matrix subtraction operator.
+ *
+ * Subtracts elements of @p rhs from respective elements of a copy of @p lhs and returns the result.
+ *
+ * @throws @c std::invalid_argument when dimensions of @p lhs and @p rhs differ
+ */
+template <typename T, typename Allocator>
+[[nodiscard]]
+auto operator-(dyn_mat<T, Allocator> const& lhs, dyn_mat<T, Allocator> const& rhs) -> dyn_mat<T, Allocator>;
+
+/**
+ * @brief Matrix multiplication operator.
+ *
+ * Performs matrix multiplication for @p lhs and @p rhs and returns the result,
+ * allocated with the allocator of @p lhs.
+ *
+ * @throws @c std::invalid_argument when the number of columns of @p lhs differs from the number of rows of @p rhs
+ */
+template <typename T, typename Allocator>
+[[nodiscard]]
+auto operator*(dyn_mat<T, Allocator> const& lhs, dyn_mat<T, Allocator> const& rhs) -> dyn_mat<T, Allocator>;
+
+/**
+ * @brief Matrix-vector multiplication operator.
+ *
+ * Multiplies @p m by @p v and returns the result, allocated with the allocator of @p v.
+ *
+ * @throws @c std::invalid_argument when the number of columns of @p m differs from the size of @p v
+ */
+template <typename T, typename Allocator>
+[[nodiscard]]
+auto operator*(dyn_mat<T, Allocator> const& m, dyn_vec<T, Allocator> const& v) -> dyn_vec<T, Allocator>;
+
+/**
+ * @brief Matrix-scalar multiplication operator.
+ *
+ * Multiplies @p m by @p scale and returns the result.
+ */
+template <typename T, typename Allocator>
+[[nodiscard]]
+auto operator*(dyn_mat<T, Allocator> const& m, std::type_identity_t<T> const& scale) -> dyn_mat<T, Allocator>;
+
+/**
+ * @brief Scalar-matrix multiplication operator.
+ *
+ * Multiplies @p m by @p scale and returns the result.
+ */
+template <typename T, typename Allocator>
+[[nodiscard]]
+auto operator*(std::type_identity_t<T> const& scale, dyn_mat<T, Allocator> const& m) -> dyn_mat<T, Allocator>;
+
+/**
+ * @brief Dot product.
+ *
+ * @throws @c std::invalid_argument when sizes of @p lhs and @p rhs differ
+ */
+template <typename T, typename Allocator>
+[[nodiscard]]
+auto dot(dyn_vec<T, Allocator> const& lhs, dyn_vec<T, Allocator> const& rhs) -> T;
+
+/**
+ * @brief Vector addition operator.
+ *
+ * Adds components of @p rhs to respective components of a copy of @p lhs and returns the result.
+ *
+ * @throws @c std::invalid_argument when sizes of @p lhs and @p rhs differ
+ */
+template <typename T, typename Allocator>
+[[nodiscard]]
+auto operator+(dyn_vec<T, Allocator> const& lhs, dyn_vec<T, Allocator> const& rhs) -> dyn_vec<T, Allocator>;
+
+/**
+ * @brief Vector subtraction operator.
+ *
+ * Subtracts components of @p rhs from respective components of a copy of @p lhs and returns the result.
+ *
+ * @throws @c std::invalid_argument when sizes of @p lhs and @p rhs differ
+ */
+template <typename T, typename Allocator>
+[[nodiscard]]
+auto operator-(dyn_vec<T, Allocator> const& lhs, dyn_vec<T, Allocator> const& rhs) -> dyn_vec<T, Allocator>;
+
+/**
+ * @brief Vector-scalar multiplication operator.
+ *
+ * Multiplies @p v by @p scale and returns the result.
+ */
+template <typename T, typename Allocator>
+[[nodiscard]]
+auto operator*(dyn_vec<T, Allocator> const& v, std::type_identity_t<T> const& scale) -> dyn_vec<T, Allocator>;
+
+/**
+ * @brief Scalar-vector multiplication operator.
+ *
+ * Multiplies @p v by @p scale and returns the result.
+ */
+template <typename T, typename Allocator>
+[[nodiscard]]
+auto operator*(std::type_identity_t<T> const& scale, dyn_vec<T, Allocator> const& v) -> dyn_vec<T, Allocator>;
+}
+
+#include "operation.inl"
+
+#endif
@@ -0,0 +1,458 @@
+#include "ndml/mat/lu.hpp"
+#include "ndml/mat/operation.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace ndml
+{
+namespace detail
+{
+/**
+ * @brief Elements of @p m as a flat span.
+ */
+template <typename M>
+constexpr auto elements(M&& m) noexcept -> decltype(auto)
+{
+	return std::span{m.data(), m.rows() * m.columns()};
+}
+
+/**
+ * @brief Copy of @p m allocated with its allocator.
+ *
+ * Unlike copy construction, it keeps allocating from the same memory resource for polymorphic allocators.
+ */
+template <typename T, typename Allocator>
+auto clone(dyn_mat<T, Allocator> const& m) -> dyn_mat<T, Allocator>
+{
+	return dyn_mat<T, Allocator>(m.view(), m.get_allocator());
+}
+
+/**
+ * @copydoc clone(dyn_mat<T, Allocator> const&)
+ */
+template <typename T, typename Allocator>
+auto clone(dyn_vec<T, Allocator> const& v) -> dyn_vec<T, Allocator>
+{
+	return dyn_vec<T, Allocator>(std::span<T const>{v}, v.get_allocator());
+}
+
+/**
+ * @brief Throws @c std::invalid_argument with @p what unless @p agree is @c true.
+ */
+inline auto require_dimensions(bool agree, char const* what) -> void
+{
+	if (!agree)
+	{
+		throw std::invalid_argument(what);
+	}
+}
+
+/**
+ * @brief Factorizes @p a in place into @f$ P A = L U @f$ with partial pivoting.
+ *
+ * On return, @p a holds @f$ U @f$ on and above the main diagonal and @f$ L @f$ without its unit diagonal below it,
+ * and row @c i of @f$ P A @f$ is row @c permutation[i] of @f$ A @f$.
+ *
+ * @return whether the permutation is odd
+ */
+template <typename T>
+auto factorize(dyn_mat_view<T> a, std::span<std::size_t> permutation) noexcept -> bool
+{
+	auto const n = a.rows();
+	auto odd     = false;
+
+	std::iota(permutation.begin(), permutation.end(), std::size_t{0});
+
+	for (std::size_t k = 0; k < n; ++k)
+	{
+		auto const column = a[k];
+
+		auto pivot = k;
+		for (std::size_t i = k + 1; i < n; ++i)
+		{
+			if (detail::abs(column[i]) > detail::abs(column[pivot]))
+			{
+				pivot = i;
+			}
+		}
+
+		if (column[pivot] == T{0})
+		{
+			continue;
+		}
+
+		if (pivot != k)
+		{
+			using std::swap;
+
+			for (std::size_t j = 0; j < n; ++j)
+			{
+				swap(a[j, k], a[j, pivot]);
+			}
+
+			swap(permutation[k], permutation[pivot]);
+			odd = !odd;
+		}
+
+		auto const d = column[k];
+		for (std::size_t i = k + 1; i < n; ++i)
+		{
+			column[i] /= d;
+		}
+
+		// column-oriented update of the trailing submatrix
+		for (std::size_t j = k + 1; j < n; ++j)
+		{
+			auto const target = a[j];
+			auto const s      = target[k];
+
+			for (std::size_t i = k + 1; i < n; ++i)
+			{
+				target[i] -= column[i] * s;
+			}
+		}
+	}
+
+	return odd;
+}
+
+/**
+ * @brief Permutation of rows of a square matrix, allocated with the allocator of @p m.
+ */
+template <typename T, typename Allocator>
+auto permutation_for(dyn_mat<T, Allocator> const& m)
+{
+	using allocator_type = std::allocator_traits<Allocator>::template rebind_alloc<std::size_t>;
+
+	return std::vector<std::size_t, allocator_type>(m.rows(), allocator_type(m.get_allocator()));
+}
+}
+
+template <typename T>
+auto multiply(std::type_identity_t<dyn_mat_view<T const>> lhs, std::type_identity_t<dyn_mat_view<T const>> rhs, dyn_mat_view<T> out) -> void
+{
+	detail::require_dimensions(
+		lhs.columns() == rhs.rows() && out.rows() == lhs.rows() && out.columns() == rhs.columns(),
+		"dimension mismatch in call to dyn_mat multiplication"
+	);
+
+	constexpr std::size_t tile_rows    = 8;
+	constexpr std::size_t tile_columns = 4;
+
+	auto const rows    = out.rows();
+	auto const columns = out.columns();
+	auto const depth   = lhs.columns();
+
+	auto const row_end    = rows - rows % tile_rows;
+	auto const column_end = columns - columns % tile_columns;
+
+	for (std::size_t j = 0; j < column_end; j += tile_columns)
+	{
+		for (std::size_t i = 0; i < row_end; i += tile_rows)
+		{
+			detail::multiply_tile<tile_rows, tile_columns>(lhs, rhs, out, i, j, depth);
+		}
+
+		for (std::size_t i = row_end; i < rows; ++i)
+		{
+			detail::multiply_tile<1, tile_columns>(lhs, rhs, out, i, j, depth);
+		}
+	}
+
+	for (std::size_t j = column_end; j < columns; ++j)
+	{
+		for (std::size_t i = 0; i < row_end; i += tile_rows)
+		{
+			detail::multiply_tile<tile_rows, 1>(lhs, rhs, out, i, j, depth);
+		}
+
+		for (std::size_t i = row_end; i < rows; ++i)
+		{
+			detail::multiply_tile<1, 1>(lhs, rhs, out, i, j, depth);
+		}
+	}
+}
+
+template <typename T>
+auto multiply(std::type_identity_t<dyn_mat_view<T const>> m, std::type_identity_t<std::span<T const>> v, std::span<T> out) -> void
+{
+	detail::require_dimensions(m.columns() == v.size() && out.size() == m.rows(), "dimension mismatch in call to dyn_mat-vector multiplication");
+
+	std::ranges::fill(out, T{0});
+
+	for (std::size_t k = 0; k < m.columns(); ++k)
+	{
+		auto const column = m[k];
+		auto const s      = v[k];
+
+		for (std::size_t i = 0; i < out.size(); ++i)
+		{
+			out[i] += column[i] * s;
+		}
+	}
+}
+
+template <typename T, typename Allocator>
+auto transpose(dyn_mat<T, Allocator> const& m) -> dyn_mat<T, Allocator>
+{
+	dyn_mat<T, Allocator> t(m.columns(), m.rows(), m.get_allocator());
+
+	for (std::size_t i = 0; i < m.columns(); ++i)
+	{
+		auto const column = m[i];
+
+		for (std::size_t j = 0; j < m.rows(); ++j)
+		{
+			t[j, i] = column[j];
+		}
+	}
+
+	return t;
+}
+
+template <typename T, typename Allocator>
+auto determinant(dyn_mat<T, Allocator> const& m) -> T
+{
+	detail::require_dimensions(m.rows() == m.columns(), "non-square matrix in call to determinant");
+
+	auto a           = detail::clone(m);
+	auto permutation = detail::permutation_for(m);
+	auto const odd   = detail::factorize(a.view(), std::span{permutation});
+
+	T det{1};
+	for (std::size_t i = 0; i < a.rows(); ++i)
+	{
+		det *= a[i, i];
+	}
+
+	return odd ? -det : det;
+}
+
+template <typename T, typename Allocator>
+auto inverse(dyn_mat<T, Allocator> const& m) -> dyn_mat<T, Allocator>
+{
+	detail::require_dimensions(m.rows() == m.columns(), "non-square matrix in call to inverse");
+
+	auto const n = m.rows();
+
+	auto a           = detail::clone(m);
+	auto permutation = detail::permutation_for(m);
+	detail::factorize(a.view(), std::span{permutation});
+
+	dyn_mat<T, Allocator> x(n, n, m.get_allocator());
+
+	for (std::size_t c = 0; c < n; ++c)
+	{
+		auto const column = x[c];
+
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			column[i] = permutation[i] == c ? T{1} : T{0};
+		}
+
+		// forward substitution with the unit lower triangular factor
+		for (std::size_t j = 0; j < n; ++j)
+		{
+			auto const l = a[j];
+			auto const s = column[j];
+
+			for (std::size_t i = j + 1; i < n; ++i)
+			{
+				column[i] -= l[i] * s;
+			}
+		}
+
+		// back substitution with the upper triangular factor
+		for (std::size_t j = n; j-- > 0;)
+		{
+			auto const u = a[j];
+			auto const s = column[j] /= u[j];
+
+			for (std::size_t i = 0; i < j; ++i)
+			{
+				column[i] -= u[i] * s;
+			}
+		}
+	}
+
+	return x;
+}
+
+template <typename T, typename Allocator>
+auto trace(dyn_mat<T, Allocator> const& m) -> T
+{
+	detail::require_dimensions(m.rows() == m.columns(), "non-square matrix in call to trace");
+
+	T tr{0};
+	for (std::size_t i = 0; i < m.rows(); ++i)
+	{
+		tr += m[i, i];
+	}
+
+	return tr;
+}
+
+template <typename T, typename Allocator>
+auto operator+=(dyn_mat<T, Allocator>& lhs, dyn_mat<T, Allocator> const& rhs) -> dyn_mat<T, Allocator>&
+{
+	detail::require_dimensions(lhs.rows() == rhs.rows() && lhs.columns() == rhs.columns(), "dimension mismatch in call to dyn_mat addition");
+
+	std::ranges::transform(detail::elements(lhs), detail::elements(rhs), detail::elements(lhs).begin(), std::plus<>{});
+	return lhs;
+}
+
+template <typename T, typename Allocator>
+auto operator-=(dyn_mat<T, Allocator>& lhs, dyn_mat<T, Allocator> const& rhs) -> dyn_mat<T, Allocator>&
+{
+	detail::require_dimensions(lhs.rows() == rhs.rows() && lhs.columns() == rhs.columns(), "dimension mismatch in call to dyn_mat subtraction");
+
+	std::ranges::transform(detail::elements(lhs), detail::elements(rhs), detail::elements(lhs).begin(), std::minus<>{});
+	return lhs;
+}
+
+template <typename T, typename Allocator>
+auto operator*=(dyn_mat<T, Allocator>& m, std::type_identity_t<T> const& scale) noexcept -> dyn_mat<T, Allocator>&
+{
+	for (auto& e : detail::elements(m))
+	{
+		e *= scale;
+	}
+
+	return m;
+}
+
+template <typename T, typename Allocator>
+auto operator/=(dyn_mat<T, Allocator>& m, std::type_identity_t<T> const& scale) noexcept -> dyn_mat<T, Allocator>&
+{
+	for (auto& e : detail::elements(m))
+	{
+		e /= scale;
+	}
+
+	return m;
+}
+
+template <typename T, typename Allocator>
+auto operator+(dyn_mat<T, Allocator> const& m) -> dyn_mat<T, Allocator>
+{
+	return detail::clone(m);
+}
+
+template <typename T, typename Allocator>
+auto operator-(dyn_mat<T, Allocator> const& m) -> dyn_mat<T, Allocator>
+{
+	auto tmp = detail::clone(m);
+	for (auto& e : detail::elements(tmp))
+	{
+		e = -e;
+	}
+
+	return tmp;
+}
+
+template <typename T, typename Allocator>
+auto operator+(dyn_mat<T, Allocator> const& lhs, dyn_mat<T, Allocator> const& rhs) -> dyn_mat<T, Allocator>
+{
+	auto tmp = detail::clone(lhs);
+	tmp += rhs;
+
+	return tmp;
+}
+
+template <typename T, typename Allocator>
+auto operator-(dyn_mat<T, Allocator> const& lhs, dyn_mat<T, Allocator> const& rhs) -> dyn_mat<T, Allocator>
+{
+	auto tmp = detail::clone(lhs);
+	tmp -= rhs;
+
+	return tmp;
+}
+
+template <typename T, typename Allocator>
+auto operator*(dyn_mat<T, Allocator> const& lhs, dyn_mat<T, Allocator> const& rhs) -> dyn_mat<T, Allocator>
+{
+	dyn_mat<T, Allocator> p(lhs.rows(), rhs.columns(), lhs.get_allocator());
+	multiply<T>(lhs, rhs, p);
+
+	return p;
+}
+
+template <typename T, typename Allocator>
+auto operator*(dyn_mat<T, Allocator> const& m, dyn_vec<T, Allocator> const& v) -> dyn_vec<T, Allocator>
+{
+	dyn_vec<T, Allocator> p(m.rows(), v.get_allocator());
+	multiply<T>(m, v, p);
+
+	return p;
+}
+
+template <typename T, typename Allocator>
+auto operator*(dyn_mat<T, Allocator> const& m, std::type_identity_t<T> const& scale) -> dyn_mat<T, Allocator>
+{
+	auto tmp = detail::clone(m);
+	tmp *= scale;
+
+	return tmp;
+}
+
+template <typename T, typename Allocator>
+auto operator*(std::type_identity_t<T> const& scale, dyn_mat<T, Allocator> const& m) -> dyn_mat<T, Allocator>
+{
+	return m * scale;
+}
+
+template <typename T, typename Allocator>
+auto dot(dyn_vec<T, Allocator> const& lhs, dyn_vec<T, Allocator> const& rhs) -> T
+{
+	detail::require_dimensions(lhs.size() == rhs.size(), "size mismatch in call to dyn_vec dot product");
+
+	return std::transform_reduce(lhs.begin(), lhs.end(), rhs.begin(), T{0});
+}
+
+template <typename T, typename Allocator>
+auto operator+(dyn_vec<T, Allocator> const& lhs, dyn_vec<T, Allocator> const& rhs) -> dyn_vec<T, Allocator>
+{
+	detail::require_dimensions(lhs.size() == rhs.size(), "size mismatch in call to dyn_vec addition");
+
+	auto tmp = detail::clone(lhs);
+	std::ranges::transform(tmp, rhs, tmp.begin(), std::plus<>{});
+
+	return tmp;
+}
+
+template <typename T, typename Allocator>
+auto operator-(dyn_vec<T, Allocator> const& lhs, dyn_vec<T, Allocator> const& rhs) -> dyn_vec<T, Allocator>
+{
+	detail::require_dimensions(lhs.size() == rhs.size(), "size mismatch in call to dyn_vec subtraction");
+
+	auto tmp = detail::clone(lhs);
+	std::ranges::transform(tmp, rhs, tmp.begin(), std::minus<>{});
+
+	return tmp;
+}
+
+template <typename T, typename Allocator>
+auto operator*(dyn_vec<T, Allocator> const& v, std::type_identity_t<T> const& scale) -> dyn_vec<T, Allocator>
+{
+	auto tmp = detail::clone(v);
+	for (auto& c : tmp)
+	{
+		c *= scale;
+	}
+
+	return tmp;
+}
+
+template <typename T, typename Allocator>
+auto operator*(std::type_identity_t<T> const& scale, dyn_vec<T, Allocator> const& v) -> dyn_vec<T, Allocator>
+{
+	return v * scale;
+}
+}
@@ -0,0 +1,145 @@
+#ifndef NDML_DYN_VEC_HPP
+#define NDML_DYN_VEC_HPP
+
+#include "ndml/vec/vec.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+namespace ndml
+{
+/**
+ * @brief Algebraic vector of a runtime size.
+ *
+ * Components are stored contiguously in memory obtained from @p Allocator.
+ * Its spans, e.g. @c std::span<T const>, are used as views of it.
+ *
+ * @tparam T         element type
+ * @tparam Allocator allocator of elements
+ */
+template <typename T, typename Allocator = std::allocator<T>>
+struct dyn_vec
+{
+	using value_type     = T;
+	using allocator_type = Allocator;
+	using iterator       = std::vector<value_type, allocator_type>::iterator;
+	using const_iterator = std::vector<value_type, allocator_type>::const_iterator;
+
+	/**
+	 * @brief Default constructor.
+	 *
+	 * The vector is empty.
+	 */
+	constexpr dyn_vec() = default;
+
+	/**
+	 * @brief Constructor from allocator.
+	 *
+	 * The vector is empty and will allocate its components with @p allocator.
+	 */
+	constexpr explicit dyn_vec(allocator_type const& allocator) noexcept;
+
+	/**
+	 * @brief Constructor from size.
+	 *
+	 * This will allocate @p size value-initialized components with @p allocator.
+	 */
+	constexpr explicit dyn_vec(std::size_t size, allocator_type const& allocator = {});
+
+	/**
+	 * @brief Constructor from size and scale.
+	 *
+	 * This will allocate @p size components initialized to the value of @p scale with @p allocator.
+	 */
+	constexpr dyn_vec(std::size_t size, value_type const& scale, allocator_type const& allocator = {});
+
+	/**
+	 * @brief Constructor from components.
+	 *
+	 * This will copy @p components to ones allocated with @p allocator.
+	 */
+	constexpr explicit dyn_vec(std::span<value_type const> components, allocator_type const& allocator = {});
+
+	/**
+	 * @brief Constructor from a fixed-size vector.
+	 *
+	 * This will copy components of @p v to ones allocated with @p allocator.
+	 */
+	template <std::size_t N>
+	constexpr explicit dyn_vec(vec<N, value_type> const& v, allocator_type const& allocator = {});
+
+	/**
+	 * @brief Allocator of components.
+	 */
+	[[nodiscard]]
+	constexpr auto get_allocator(this dyn_vec const& self) noexcept -> allocator_type;
+
+	/**
+	 * @brief Number of components.
+	 */
+	[[nodiscard]]
+	constexpr auto size(this dyn_vec const& self) noexcept -> std::size_t;
+
+	/**
+	 * @brief Whether the vector has no components.
+	 */
+	[[nodiscard]]
+	constexpr auto empty(this dyn_vec const& self) noexcept -> bool;
+
+	/**
+	 * @brief Pointer to the components.
+	 */
+	[[nodiscard]]
+	constexpr auto data(this auto&& self) noexcept -> decltype(auto);
+
+	/**
+	 * @brief Subscript operator.
+	 *
+	 * This retrieves the component at index @p i.
+	 *
+	 * @warning Behavior is undefined when @p i >= @c size().
+	 */
+	[[nodiscard]]
+	constexpr auto operator[](this auto&& self, std::size_t i) noexcept -> decltype(auto);
+
+	/**
+	 * @brief Iterator to the first component.
+	 */
+	[[nodiscard]]
+	constexpr auto begin(this auto&& self) noexcept -> decltype(auto);
+
+	/**
+	 * @brief Past-the-end iterator.
+	 */
+	[[nodiscard]]
+	constexpr auto end(this auto&& self) noexcept -> decltype(auto);
+
+	/**
+	 * @brief Equality comparison operator.
+	 *
+	 * Vectors are equal if they are of the same size and their respective components are equal.
+	 */
+	[[nodiscard]]
+	constexpr auto operator==(this dyn_vec const& self, dyn_vec const& other) noexcept -> bool;
+
+private:
+	/// Vector components.
+	std::vector<value_type, allocator_type> components_;
+};
+
+namespace pmr
+{
+/**
+ * @brief Runtime-sized vector allocating from a memory resource, e.g. a @c std::pmr::monotonic_buffer_resource.
+ */
+template <typename T>
+using dyn_vec = ndml::dyn_vec<T, std::pmr::polymorphic_allocator<T>>;
+}
+}
+
+#include "vec.inl"
+
+#endif
@@ -0,0 +1,87 @@
+#include "ndml/meta/unroll.hpp"
+
+#include <algorithm>
+
+namespace ndml
+{
+template <typename T, typename Allocator>
+constexpr dyn_vec<T, Allocator>::dyn_vec(allocator_type const& allocator) noexcept
+	: components_(allocator)
+{
+}
+
+template <typename T, typename Allocator>
+constexpr dyn_vec<T, Allocator>::dyn_vec(std::size_t size, allocator_type const& allocator)
+	: components_(size, allocator)
+{
+}
+
+template <typename T, typename Allocator>
+constexpr dyn_vec<T, Allocator>::dyn_vec(std::size_t size, value_type const& scale, allocator_type const& allocator)
+	: components_(size, scale, allocator)
+{
+}
+
+template <typename T, typename Allocator>
+constexpr dyn_vec<T, Allocator>::dyn_vec(std::span<value_type const> components, allocator_type const& allocator)
+	: components_(components.begin(), components.end(), allocator)
+{
+}
+
+template <typename T, typename Allocator>
+template <std::size_t N>
+constexpr dyn_vec<T, Allocator>::dyn_vec(vec<N, value_type> const& v, allocator_type const& allocator)
+	: components_(allocator)
+{
+	components_.reserve(N);
+	meta::unroll<N>([this, &v](auto... i) { (components_.push_back(get<i>(v)), ...); });
+}
+
+template <typename T, typename Allocator>
+constexpr auto dyn_vec<T, Allocator>::get_allocator(this dyn_vec const& self) noexcept -> allocator_type
+{
+	return self.components_.get_allocator();
+}
+
+template <typename T, typename Allocator>
+constexpr auto dyn_vec<T, Allocator>::size(this dyn_vec const& self) noexcept -> std::size_t
+{
+	return self.components_.size();
+}
+
+template <typename T, typename Allocator>
+constexpr auto dyn_vec<T, Allocator>::empty(this dyn_vec const& self) noexcept -> bool
+{
+	return self.components_.empty();
+}
+
+template <typename T, typename Allocator>
+constexpr auto dyn_vec<T, Allocator>::data(this auto&& self) noexcept -> decltype(auto)
+{
+	return self.components_.data();
+}
+
+template <typename T, typename Allocator>
+constexpr auto dyn_vec<T, Allocator>::operator[](this auto&& self, std::size_t i) noexcept -> decltype(auto)
+{
+	return self.components_[i];
+}
+
+template <typename T, typename Allocator>
+constexpr auto dyn_vec<T, Allocator>::begin(this auto&& self) noexcept -> decltype(auto)
+{
+	return self.components_.begin();
+}
+
+template <typename T, typename Allocator>
+constexpr auto dyn_vec<T, Allocator>::end(this auto&& self) noexcept -> decltype(auto)
+{
+	return self.components_.end();
+}
+
+template <typename T, typename Allocator>
+constexpr auto dyn_vec<T, Allocator>::operator==(this dyn_vec const& self, dyn_vec const& other) noexcept -> bool
+{
+	return std::ranges::equal(self.components_, other.components_);
+}
+}
@@ -0,0 +1,152 @@
+#ifndef NDML_DYN_VIEW_HPP
+#define NDML_DYN_VIEW_HPP
+
+#include "ndml/mat/mat.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+namespace ndml
+{
+/**
+ * @brief Non-owning view of a runtime-sized matrix.
+ *
+ * It refers to contiguous elements stored column-major, either of a @c dyn_mat, of a @c mat, or of an external buffer.
+ *
+ * @tparam T element type, const-qualified for read-only views
+ */
+template <typename T>
+struct dyn_mat_view
+{
+	using element_type = T;
+	using value_type   = std::remove_cv_t<T>;
+	using column_type  = std::span<element_type>;
+
+	/**
+	 * @brief Default constructor.
+	 *
+	 * The view is empty.
+	 */
+	constexpr dyn_mat_view() noexcept = default;
+
+	/**
+	 * @brief Constructor from a pointer and dimensions.
+	 *
+	 * @param data    pointer to the first element of @p rows * @p columns elements stored column-major
+	 * @param rows    number of rows
+	 * @param columns number of columns
+	 */
+	constexpr dyn_mat_view(element_type* data, std::size_t rows, std::size_t columns) noexcept;
+
+	/**
+	 * @brief Constructor from a fixed-size matrix.
+	 *
+	 * The view refers to the elements of @p m.
+	 */
+	template <std::size_t R, std::size_t C>
+	constexpr dyn_mat_view(mat<R, C, value_type>& m) noexcept;
+
+	/**
+	 * @brief Constructor from a constant fixed-size matrix.
+	 *
+	 * The view refers to the elements of @p m.
+	 */
+	template <std::size_t R, std::size_t C>
+	constexpr dyn_mat_view(mat<R, C, value_type> const& m) noexcept
+		requires std::is_const_v<element_type>;
+
+	/**
+	 * @brief Converting constructor from a view of mutable elements.
+	 */
+	template <typename FromT>
+	constexpr dyn_mat_view(dyn_mat_view<FromT> const& v) noexcept
+		requires (!std::same_as<FromT, element_type> && std::convertible_to<FromT (*)[], element_type (*)[]>);
+
+	/**
+	 * @brief Number of rows.
+	 */
+	[[nodiscard]]
+	constexpr auto rows(this dyn_mat_view const& self) noexcept -> std::size_t;
+
+	/**
+	 * @brief Number of columns.
+	 */
+	[[nodiscard]]
+	constexpr auto columns(this dyn_mat_view const& self) noexcept -> std::size_t;
+
+	/**
+	 * @brief Size of view.
+	 *
+	 * This returns the number of columns as the matrix is stored column-major.
+	 *
+	 * @return the number of columns
+	 */
+	[[nodiscard]]
+	constexpr auto size(this dyn_mat_view const& self) noexcept -> std::size_t;
+
+	/**
+	 * @brief Whether the view has no elements.
+	 */
+	[[nodiscard]]
+	constexpr auto empty(this dyn_mat_view const& self) noexcept -> bool;
+
+	/**
+	 * @brief Pointer to the elements.
+	 *
+	 * @return pointer to the element at the intersection of the first column and the first row
+	 */
+	[[nodiscard]]
+	constexpr auto data(this dyn_mat_view const& self) noexcept -> element_type*;
+
+	/**
+	 * @brief Column subscript operator.
+	 *
+	 * This retrieves the column at index @p column.
+	 *
+	 * @param column column index
+	 *
+	 * @return span of elements of the column at index @p column
+	 *
+	 * @warning Behavior is undefined when @p column >= @c columns().
+	 */
+	[[nodiscard]]
+	constexpr auto operator[](this dyn_mat_view const& self, std::size_t column) noexcept -> column_type;
+
+	/**
+	 * @brief Element subscript operator.
+	 *
+	 * This retrieves the element at the intersection of column @p column and row @p row.
+	 *
+	 * @param column column index
+	 * @param row    row index
+	 *
+	 * @return element at the intersection of column @p column and row @p row
+	 *
+	 * @warning Behavior is undefined when @p column >= @c columns() or @p row >= @c rows().
+	 */
+	[[nodiscard]]
+	constexpr auto operator[](this dyn_mat_view const& self, std::size_t column, std::size_t row) noexcept -> element_type&;
+
+private:
+	/// Pointer to the first element.
+	element_type* data_{};
+
+	/// Number of rows.
+	std::size_t rows_{};
+
+	/// Number of columns.
+	std::size_t columns_{};
+};
+
+template <std::size_t R, std::size_t C, typename T>
+dyn_mat_view(mat<R, C, T>&) -> dyn_mat_view<T>;
+
+template <std::size_t R, std::size_t C, typename T>
+dyn_mat_view(mat<R, C, T> const&) -> dyn_mat_view<T const>;
+}
+
+#include "view.inl"
+
+#endif
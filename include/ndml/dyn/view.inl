@@ -0,0 +1,75 @@
+namespace ndml
+{
+template <typename T>
+constexpr dyn_mat_view<T>::dyn_mat_view(element_type* data, std::size_t rows, std::size_t columns) noexcept
+	: data_{data}
+	, rows_{rows}
+	, columns_{columns}
+{
+}
+
+template <typename T>
+template <std::size_t R, std::size_t C>
+constexpr dyn_mat_view<T>::dyn_mat_view(mat<R, C, value_type>& m) noexcept
+	: dyn_mat_view{m.data(), R, C}
+{
+}
+
+template <typename T>
+template <std::size_t R, std::size_t C>
+constexpr dyn_mat_view<T>::dyn_mat_view(mat<R, C, value_type> const& m) noexcept
+	requires std::is_const_v<element_type>
+	: dyn_mat_view{m.data(), R, C}
+{
+}
+
+template <typename T>
+template <typename FromT>
+constexpr dyn_mat_view<T>::dyn_mat_view(dyn_mat_view<FromT> const& v) noexcept
+	requires (!std::same_as<FromT, element_type> && std::convertible_to<FromT (*)[], element_type (*)[]>)
+	: dyn_mat_view{v.data(), v.rows(), v.columns()}
+{
+}
+
+template <typename T>
+constexpr auto dyn_mat_view<T>::rows(this dyn_mat_view const& self) noexcept -> std::size_t
+{
+	return self.rows_;
+}
+
+template <typename T>
+constexpr auto dyn_mat_view<T>::columns(this dyn_mat_view const& self) noexcept -> std::size_t
+{
+	return self.columns_;
+}
+
+template <typename T>
+constexpr auto dyn_mat_view<T>::size(this dyn_mat_view const& self) noexcept -> std::size_t
+{
+	return self.columns_;
+}
+
+template <typename T>
+constexpr auto dyn_mat_view<T>::empty(this dyn_mat_view const& self) noexcept -> bool
+{
+	return self.rows_ == 0 || self.columns_ == 0;
+}
+
+template <typename T>
+constexpr auto dyn_mat_view<T>::data(this dyn_mat_view const& self) noexcept -> element_type*
+{
+	return self.data_;
+}
+
+template <typename T>
+constexpr auto dyn_mat_view<T>::operator[](this dyn_mat_view const& self, std::size_t column) noexcept -> column_type
+{
+	return {self.data_ + column * self.rows_, self.rows_};
+}
+
+template <typename T>
+constexpr auto dyn_mat_view<T>::operator[](this dyn_mat_view const& self, std::size_t column, std::size_t row) noexcept -> element_type&
+{
+	return self.data_[column * self.rows_ + row];
+}
+}
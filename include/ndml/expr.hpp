@@ -0,0 +1,7 @@
+#ifndef NDML_EXPR_HPP
+#define NDML_EXPR_HPP
+
+#include "expr/expr.hpp"
+#include "expr/operation.hpp"
+
+#endif
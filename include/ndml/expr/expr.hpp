@@ -0,0 +1,239 @@
+#ifndef NDML_EXPR_EXPR_HPP
+#define NDML_EXPR_EXPR_HPP
+
+#include "ndml/mat/mat.hpp"
+#include "ndml/vec/vec.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+
+namespace ndml::expr
+{
+/**
+ * @brief Shape of a vector or matrix type.
+ *
+ * This provides the number of elements of a vector or matrix type and access to them by a flat index,
+ * so that element-wise expressions are evaluated the same way for both.
+ * Matrix elements are indexed column-major.
+ *
+ * @tparam V vector or matrix type
+ */
+template <typename V>
+struct shape;
+
+template <std::size_t N, typename T>
+struct shape<vec<N, T>>
+{
+	using value_type = T;
+
+	static constexpr std::size_t size = N;
+
+	/**
+	 * @brief Element at flat index @p K.
+	 */
+	template <std::size_t K>
+	[[nodiscard]]
+	static constexpr auto element(auto&& v) noexcept -> decltype(auto);
+};
+
+template <std::size_t R, std::size_t C, typename T>
+struct shape<mat<R, C, T>>
+{
+	using value_type = T;
+
+	static constexpr std::size_t size = R * C;
+
+	/**
+	 * @brief Element at flat index @p K.
+	 */
+	template <std::size_t K>
+	[[nodiscard]]
+	static constexpr auto element(auto&& m) noexcept -> decltype(auto);
+};
+
+/**
+ * @brief Whether @p V is a vector or matrix type.
+ */
+template <typename V>
+concept shaped = requires { shape<std::remove_cvref_t<V>>::size; };
+
+/**
+ * @brief Base of expression nodes.
+ */
+struct node
+{
+};
+
+/**
+ * @brief Whether @p E is an expression node.
+ */
+template <typename E>
+concept expression = std::derived_from<std::remove_cvref_t<E>, node>;
+
+/**
+ * @brief Expression leaf referring to a vector or matrix.
+ *
+ * Lvalues are referred to, whereas rvalues are stored by value so that expressions built from temporaries
+ * do not outlive their operands.
+ *
+ * @tparam V vector or matrix type, or a constant reference to it
+ */
+template <typename V>
+struct terminal : node
+{
+	using result_type = std::remove_cvref_t<V>;
+	using value_type  = shape<result_type>::value_type;
+
+	/// Referred to or stored operand.
+	V operand;
+
+	/**
+	 * @brief Element at flat index @p K.
+	 */
+	template <std::size_t K>
+	[[nodiscard]]
+	constexpr auto element(this auto const& self) noexcept -> value_type;
+
+	/**
+	 * @brief Evaluates the expression.
+	 */
+	[[nodiscard]]
+	constexpr operator result_type(this auto const& self) noexcept;
+};
+
+/**
+ * @brief Expression leaf holding a scalar.
+ *
+ * Scalars have the same value at every element index.
+ *
+ * @tparam T scalar type
+ */
+template <typename T>
+struct scalar
+{
+	using value_type = T;
+
+	/// Scalar value.
+	T value;
+
+	/**
+	 * @brief Element at flat index @p K, i.e. the scalar itself.
+	 */
+	template <std::size_t K>
+	[[nodiscard]]
+	constexpr auto element(this auto const& self) noexcept -> value_type;
+};
+
+/**
+ * @brief Element-wise unary operation node.
+ *
+ * @tparam Op unary operation
+ * @tparam E  operand expression
+ */
+template <typename Op, typename E>
+struct unary : node
+{
+	using result_type = E::result_type;
+	using value_type  = E::value_type;
+
+	/// Operand.
+	E operand;
+
+	/**
+	 * @brief Element at flat index @p K.
+	 */
+	template <std::size_t K>
+	[[nodiscard]]
+	constexpr auto element(this auto const& self) noexcept -> value_type;
+
+	/**
+	 * @brief Evaluates the expression.
+	 */
+	[[nodiscard]]
+	constexpr operator result_type(this auto const& self) noexcept;
+};
+
+/**
+ * @brief Element-wise binary operation node.
+ *
+ * Either of the operands may be a @c scalar, in which case the result type is that of the other one.
+ *
+ * @tparam Op binary operation
+ * @tparam L  left operand expression
+ * @tparam R  right operand expression
+ */
+template <typename Op, typename L, typename R>
+struct binary : node
+{
+	using result_type = std::conditional_t<expression<L>, L, R>::result_type;
+	using value_type  = shape<result_type>::value_type;
+
+	/// Left operand.
+	L lhs;
+
+	/// Right operand.
+	R rhs;
+
+	/**
+	 * @brief Element at flat index @p K.
+	 */
+	template <std::size_t K>
+	[[nodiscard]]
+	constexpr auto element(this auto const& self) noexcept -> value_type;
+
+	/**
+	 * @brief Evaluates the expression.
+	 */
+	[[nodiscard]]
+	constexpr operator result_type(this auto const& self) noexcept;
+};
+
+namespace detail
+{
+/**
+ * @brief Type of a vector or matrix referred to or stored by a @c terminal built from an argument of type @p V.
+ */
+template <typename V>
+using stored_t = std::conditional_t<std::is_lvalue_reference_v<V>, std::remove_cvref_t<V> const&, std::remove_cvref_t<V>>;
+}
+
+/**
+ * @brief Lazy expression of a vector or matrix.
+ *
+ * This wraps @p v into an expression, so that arithmetic on it builds expression nodes instead of temporaries.
+ * The whole expression is evaluated element by element in a single pass
+ * when it is converted to its result type or passed to @c eval or @c assign, e.g.
+ * @code
+ * vec<4, float> r = expr::lazy(a) * s + expr::lazy(b) * t - c;
+ * @endcode
+ *
+ * @param v vector or matrix, referred to if it is an lvalue and stored otherwise
+ */
+template <shaped V>
+[[nodiscard]]
+constexpr auto lazy(V&& v) noexcept -> terminal<detail::stored_t<V>>;
+
+/**
+ * @brief Evaluates an expression.
+ *
+ * @return the value of @p e
+ */
+template <expression E>
+[[nodiscard]]
+constexpr auto eval(E const& e) noexcept -> E::result_type;
+
+/**
+ * @brief Evaluates an expression into a vector or matrix.
+ *
+ * Element @c k of the result depends only on elements @c k of the operands, so @p out may be one of them.
+ *
+ * @return reference to @p out
+ */
+template <expression E>
+constexpr auto assign(typename E::result_type& out, E const& e) noexcept -> E::result_type&;
+}
+
+#include "expr.inl"
+
+#endif
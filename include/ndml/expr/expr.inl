@@ -0,0 +1,91 @@
+#include "ndml/meta/unroll.hpp"
+
+#include <utility>
+
+namespace ndml::expr
+{
+template <std::size_t N, typename T>
+template <std::size_t K>
+constexpr auto shape<vec<N, T>>::element(auto&& v) noexcept -> decltype(auto)
+{
+	return get<K>(std::forward<decltype(v)>(v));
+}
+
+template <std::size_t R, std::size_t C, typename T>
+template <std::size_t K>
+constexpr auto shape<mat<R, C, T>>::element(auto&& m) noexcept -> decltype(auto)
+{
+	return get<K % R>(std::forward<decltype(m)>(m)[K / R]);
+}
+
+template <typename V>
+template <std::size_t K>
+constexpr auto terminal<V>::element(this auto const& self) noexcept -> value_type
+{
+	return shape<result_type>::template element<K>(self.operand);
+}
+
+template <typename V>
+constexpr terminal<V>::operator result_type(this auto const& self) noexcept
+{
+	return self.operand;
+}
+
+template <typename T>
+template <std::size_t K>
+constexpr auto scalar<T>::element(this auto const& self) noexcept -> value_type
+{
+	return self.value;
+}
+
+template <typename Op, typename E>
+template <std::size_t K>
+constexpr auto unary<Op, E>::element(this auto const& self) noexcept -> value_type
+{
+	return Op{}(self.operand.template element<K>());
+}
+
+template <typename Op, typename E>
+constexpr unary<Op, E>::operator result_type(this auto const& self) noexcept
+{
+	return eval(self);
+}
+
+template <typename Op, typename L, typename R>
+template <std::size_t K>
+constexpr auto binary<Op, L, R>::element(this auto const& self) noexcept -> value_type
+{
+	return Op{}(self.lhs.template element<K>(), self.rhs.template element<K>());
+}
+
+template <typename Op, typename L, typename R>
+constexpr binary<Op, L, R>::operator result_type(this auto const& self) noexcept
+{
+	return eval(self);
+}
+
+template <shaped V>
+constexpr auto lazy(V&& v) noexcept -> terminal<detail::stored_t<V>>
+{
+	return {{}, std::forward<V>(v)};
+}
+
+template <expression E>
+constexpr auto eval(E const& e) noexcept -> E::result_type
+{
+	typename E::result_type r;
+	assign(r, e);
+
+	return r;
+}
+
+template <expression E>
+constexpr auto assign(typename E::result_type& out, E const& e) noexcept -> E::result_type&
+{
+	using shape_type = shape<typename E::result_type>;
+
+	meta::unroll<shape_type::size>([&out, &e](auto... k) { ((shape_type::template element<k>(out) = e.template element<k>()), ...); });
+
+	return out;
+}
+}
@@ -0,0 +1,135 @@
+#ifndef NDML_EXPR_OPERATION_HPP
+#define NDML_EXPR_OPERATION_HPP
+
+#include "expr.hpp"
+
+#include <concepts>
+#include <functional>
+#include <type_traits>
+
+namespace ndml::expr
+{
+namespace detail
+{
+/**
+ * @brief Expression node type of an operand of type @p V.
+ *
+ * Expressions are kept as they are, whereas vectors and matrices are wrapped into a @c terminal.
+ */
+template <typename V>
+using node_t = std::conditional_t<expression<V>, std::remove_cvref_t<V>, terminal<stored_t<V>>>;
+
+/**
+ * @brief Operand of type @p V as an expression node.
+ */
+template <typename V>
+[[nodiscard]]
+constexpr auto as_node(V&& v) noexcept -> node_t<V>;
+}
+
+/**
+ * @brief Whether @p V is either an expression, or a vector or matrix.
+ */
+template <typename V>
+concept operand = expression<V> || shaped<V>;
+
+/**
+ * @brief Whether @p L and @p R can be combined element-wise.
+ *
+ * At least one of them has to be an expression, so that eager operations on vectors and matrices are not affected,
+ * and both have to have the same result type.
+ */
+template <typename L, typename R>
+concept elementwise = operand<L> && operand<R> && (expression<L> || expression<R>)
+                   && std::same_as<typename detail::node_t<L>::result_type, typename detail::node_t<R>::result_type>;
+
+/**
+ * @brief Whether @p L and @p R can be combined component-wise as vectors.
+ */
+template <typename L, typename R>
+concept componentwise = elementwise<L, R> && requires { detail::node_t<L>::result_type::dimension; };
+
+/**
+ * @brief Whether @p S is a scalar applicable to elements of operand @p E.
+ */
+template <typename S, typename E>
+concept scalar_for = expression<E> && !operand<S> && std::convertible_to<S, typename detail::node_t<E>::value_type>;
+
+/**
+ * @brief Expression promotion operator.
+ */
+template <expression E>
+[[nodiscard]]
+constexpr auto operator+(E&& e) noexcept -> unary<std::identity, detail::node_t<E>>;
+
+/**
+ * @brief Expression negation operator.
+ */
+template <expression E>
+[[nodiscard]]
+constexpr auto operator-(E&& e) noexcept -> unary<std::negate<>, detail::node_t<E>>;
+
+/**
+ * @brief Expression addition operator.
+ */
+template <typename L, typename R>
+[[nodiscard]]
+constexpr auto operator+(L&& lhs, R&& rhs) noexcept -> binary<std::plus<>, detail::node_t<L>, detail::node_t<R>>
+	requires elementwise<L, R>;
+
+/**
+ * @brief Expression subtraction operator.
+ */
+template <typename L, typename R>
+[[nodiscard]]
+constexpr auto operator-(L&& lhs, R&& rhs) noexcept -> binary<std::minus<>, detail::node_t<L>, detail::node_t<R>>
+	requires elementwise<L, R>;
+
+/**
+ * @brief Expression component-wise multiplication operator.
+ *
+ * This is only available for vectors, as multiplication of matrices is not element-wise.
+ */
+template <typename L, typename R>
+[[nodiscard]]
+constexpr auto operator*(L&& lhs, R&& rhs) noexcept -> binary<std::multiplies<>, detail::node_t<L>, detail::node_t<R>>
+	requires componentwise<L, R>;
+
+/**
+ * @brief Expression component-wise division operator.
+ *
+ * This is only available for vectors.
+ */
+template <typename L, typename R>
+[[nodiscard]]
+constexpr auto operator/(L&& lhs, R&& rhs) noexcept -> binary<std::divides<>, detail::node_t<L>, detail::node_t<R>>
+	requires componentwise<L, R>;
+
+/**
+ * @brief Expression-scalar multiplication operator.
+ */
+template <typename E, typename S>
+[[nodiscard]]
+constexpr auto operator*(E&& e, S const& scale) noexcept -> binary<std::multiplies<>, detail::node_t<E>, scalar<typename detail::node_t<E>::value_type>>
+	requires scalar_for<S, E>;
+
+/**
+ * @brief Scalar-expression multiplication operator.
+ */
+template <typename S, typename E>
+[[nodiscard]]
+constexpr auto operator*(S const& scale, E&& e) noexcept -> binary<std::multiplies<>, scalar<typename detail::node_t<E>::value_type>, detail::node_t<E>>
+	requires scalar_for<S, E>;
+
+/**
+ * @brief Expression-scalar division operator.
+ */
+template <typename E, typename S>
+[[nodiscard]]
+constexpr auto operator/(E&& e, S const& scale) noexcept -> binary<std::divides<>, detail::node_t<E>, scalar<typename detail::node_t<E>::value_type>>
+	requires scalar_for<S, E>;
+}
+
+#include "operation.inl"
+
+#endif
@@ -0,0 +1,78 @@
+#include <utility>
+
+namespace ndml::expr
+{
+template <typename V>
+constexpr auto detail::as_node(V&& v) noexcept -> node_t<V>
+{
+	if constexpr (expression<V>)
+	{
+		return std::forward<V>(v);
+	}
+	else
+	{
+		return lazy(std::forward<V>(v));
+	}
+}
+
+template <expression E>
+constexpr auto operator+(E&& e) noexcept -> unary<std::identity, detail::node_t<E>>
+{
+	return {{}, detail::as_node(std::forward<E>(e))};
+}
+
+template <expression E>
+constexpr auto operator-(E&& e) noexcept -> unary<std::negate<>, detail::node_t<E>>
+{
+	return {{}, detail::as_node(std::forward<E>(e))};
+}
+
+template <typename L, typename R>
+constexpr auto operator+(L&& lhs, R&& rhs) noexcept -> binary<std::plus<>, detail::node_t<L>, detail::node_t<R>>
+	requires elementwise<L, R>
+{
+	return {{}, detail::as_node(std::forward<L>(lhs)), detail::as_node(std::forward<R>(rhs))};
+}
+
+template <typename L, typename R>
+constexpr auto operator-(L&& lhs, R&& rhs) noexcept -> binary<std::minus<>, detail::node_t<L>, detail::node_t<R>>
+	requires elementwise<L, R>
+{
+	return {{}, detail::as_node(std::forward<L>(lhs)), detail::as_node(std::forward<R>(rhs))};
+}
+
+template <typename L, typename R>
+constexpr auto operator*(L&& lhs, R&& rhs) noexcept -> binary<std::multiplies<>, detail::node_t<L>, detail::node_t<R>>
+	requires componentwise<L, R>
+{
+	return {{}, detail::as_node(std::forward<L>(lhs)), detail::as_node(std::forward<R>(rhs))};
+}
+
+template <typename L, typename R>
+constexpr auto operator/(L&& lhs, R&& rhs) noexcept -> binary<std::divides<>, detail::node_t<L>, detail::node_t<R>>
+	requires componentwise<L, R>
+{
+	return {{}, detail::as_node(std::forward<L>(lhs)), detail::as_node(std::forward<R>(rhs))};
+}
+
+template <typename E, typename S>
+constexpr auto operator*(E&& e, S const& scale) noexcept -> binary<std::multiplies<>, detail::node_t<E>, scalar<typename detail::node_t<E>::value_type>>
+	requires scalar_for<S, E>
+{
+	return {{}, detail::as_node(std::forward<E>(e)), {static_cast<typename detail::node_t<E>::value_type>(scale)}};
+}
+
+template <typename S, typename E>
+constexpr auto operator*(S const& scale, E&& e) noexcept -> binary<std::multiplies<>, scalar<typename detail::node_t<E>::value_type>, detail::node_t<E>>
+	requires scalar_for<S, E>
+{
+	return {{}, {static_cast<typename detail::node_t<E>::value_type>(scale)}, detail::as_node(std::forward<E>(e))};
+}
+
+template <typename E, typename S>
+constexpr auto operator/(E&& e, S const& scale) noexcept -> binary<std::divides<>, detail::node_t<E>, scalar<typename detail::node_t<E>::value_type>>
+	requires scalar_for<S, E>
+{
+	return {{}, detail::as_node(std::forward<E>(e)), {static_cast<typename detail::node_t<E>::value_type>(scale)}};
+}
+}
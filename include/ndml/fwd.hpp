@@ -11,8 +11,58 @@ struct vec;
 template <std::size_t R, std::size_t C, typename T>
 struct mat;
 
+template <std::size_t N, typename T>
+struct sym_mat;
+
+enum class triangular;
+
+template <std::size_t N, typename T, triangular Part>
+struct tri_mat;
+
+template <std::size_t N, typename T>
+struct affine;
+
 template <typename T>
 struct quat;
+
+template <typename T>
+struct dual_quat;
+
+template <typename T>
+struct plane;
+
+template <typename T>
+struct aabb;
+
+template <typename T>
+struct sphere;
+
+template <typename T>
+struct ray;
+
+template <typename T>
+struct triangle;
+
+template <typename T>
+struct frustum;
+
+template <typename T, std::size_t W>
+struct ray_packet;
+
+template <typename T, std::size_t W>
+struct triangle_packet;
+
+template <typename T, std::size_t W>
+struct aabb_packet;
+
+template <std::size_t N, typename T>
+struct vec_view;
+
+template <std::size_t N, typename T, std::size_t... I>
+struct swizzle_view;
+
+template <std::size_t R, std::size_t C, typename T>
+struct mat_view;
 }
 
 #endif
@@ -0,0 +1,8 @@
+#ifndef NDML_GEOMETRY_HPP
+#define NDML_GEOMETRY_HPP
+
+#include "geometry/packet.hpp"
+#include "geometry/shape.hpp"
+#include "geometry/operation.hpp"
+
+#endif
@@ -0,0 +1,271 @@
+#ifndef NDML_GEOMETRY_OPERATION_HPP
+#define NDML_GEOMETRY_OPERATION_HPP
+
+#include "packet.hpp"
+#include "shape.hpp"
+
+#include "ndml/affine/affine.hpp"
+#include "ndml/mat/operation.hpp"
+#include "ndml/vec/operation.hpp"
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <type_traits>
+
+namespace ndml
+{
+/**
+ * @brief Signed distance from a plane to a point.
+ *
+ * This calculates @f$ n \cdot p + d @f$, which is positive in front of @p pl, and is the Euclidean distance if the normal of @p pl is a unit vector.
+ *
+ * @return the signed distance from @p pl to @p p
+ */
+template <typename T>
+[[nodiscard]]
+constexpr auto distance(plane<T> const& pl, vec<3, T> const& p) noexcept -> T;
+
+/**
+ * @brief Normalization of a plane.
+ *
+ * This divides the normal and the offset of @p pl by the norm of the normal, so that @ref distance is Euclidean.
+ *
+ * @warning Behavior is undefined if the normal of @p pl is zero.
+ *
+ * @return the plane equal to @p pl with a unit normal
+ */
+template <typename T>
+[[nodiscard]]
+constexpr auto normal(plane<T> const& pl) noexcept -> plane<T>;
+
+/**
+ * @brief Center of an axis-aligned bounding box.
+ */
+template <typename T>
+[[nodiscard]]
+constexpr auto center(aabb<T> const& box) noexcept -> vec<3, T>;
+
+/**
+ * @brief Extent of an axis-aligned bounding box.
+ *
+ * @return half of the size of @p box along each axis
+ */
+template <typename T>
+[[nodiscard]]
+constexpr auto extent(aabb<T> const& box) noexcept -> vec<3, T>;
+
+/**
+ * @brief Transformation of an axis-aligned bounding box by affine transformation.
+ *
+ * This transforms the center of @p box by @p a and calculates the extent of the result as the product of the element-wise
+ * absolute value of the linear block and the extent of @p box, as per J. Arvo, "Transforming Axis-Aligned Bounding Boxes",
+ * which is the tightest box bounding the transformed box and cheaper than transforming its eight corners.
+ *
+ * @return the axis-aligned bounding box of @p box transformed by @p a
+ */
+template <typename T>
+[[nodiscard]]
+constexpr auto operator*(affine<3, T> const& a, aabb<T> const& box) noexcept -> aabb<T>;
+
+/**
+ * @brief Transformation of an axis-aligned bounding box by affine transformation matrix.
+ *
+ * As for @ref affine, the upper-left three by three block of @p m is the linear block and the first three rows of its last column are the translation,
+ * whereas its last row is ignored, so that @p m must be an affine transformation matrix, e.g. a model matrix, rather than a projection.
+ *
+ * @return the axis-aligned bounding box of @p box transformed by @p m
+ */
+template <typename T>
+[[nodiscard]]
+constexpr auto operator*(mat<4, 4, T> const& m, aabb<T> const& box) noexcept -> aabb<T>;
+
+/**
+ * @brief Classification of an axis-aligned bounding box against a frustum.
+ *
+ * For each plane, this compares the signed distance to the center of @p box with the projection of its extent onto the normal of the plane.
+ * The box is outside if it is entirely behind any plane, inside if it is entirely in front of all planes, and intersecting otherwise.
+ * As is usual for culling, boxes near the edges of @p f which are behind none of its planes but outside of it are conservatively classified as intersecting.
+ *
+ * @return relation of @p box to @p f
+ */
+template <typename T>
+[[nodiscard]]
+constexpr auto classify(frustum<T> const& f, aabb<T> const& box) noexcept -> containment;
+
+/**
+ * @brief Classification of a sphere against a frustum.
+ *
+ * Same as @ref classify for axis-aligned bounding boxes, with the radius of @p s in place of the projected extent.
+ *
+ * @return relation of @p s to @p f
+ */
+template <typename T>
+[[nodiscard]]
+constexpr auto classify(frustum<T> const& f, sphere<T> const& s) noexcept -> containment;
+
+/**
+ * @brief Intersection test of an axis-aligned bounding box and a frustum.
+ *
+ * Same as comparing the result of @ref classify with @c containment::outside, but it returns as soon as @p box is behind a plane.
+ *
+ * @return whether @p box may be partially inside @p f
+ */
+template <typename T>
+[[nodiscard]]
+constexpr auto intersects(frustum<T> const& f, aabb<T> const& box) noexcept -> bool;
+
+/**
+ * @brief Intersection test of a sphere and a frustum.
+ *
+ * @return whether @p s may be partially inside @p f
+ */
+template <typename T>
+[[nodiscard]]
+constexpr auto intersects(frustum<T> const& f, sphere<T> const& s) noexcept -> bool;
+
+/**
+ * @brief Batch classification of axis-aligned bounding boxes against a frustum in structure of arrays form.
+ *
+ * Classifies each box whose center and extent components are the respective elements of spans of @p centers and @p extents,
+ * and stores the results to the respective elements of @p out, e.g.
+ * @code
+ * classify(f, {cxs, cys, czs}, {exs, eys, ezs}, visibility);
+ * @endcode
+ * Boxes behind a plane are not tested against the remaining ones.
+ *
+ * @warning Behavior is undefined if any of spans of @p centers or @p extents, or @p out, is shorter than the first span of @p centers.
+ *
+ * @return the first @c centers[0].size() elements of @p out
+ */
+template <typename T>
+constexpr auto classify(
+	frustum<T> const&                                              f,
+	std::type_identity_t<std::array<std::span<T const>, 3>> const& centers,
+	std::type_identity_t<std::array<std::span<T const>, 3>> const& extents,
+	std::span<containment>                                         out
+) noexcept -> std::span<containment>;
+
+/**
+ * @brief Batch classification of spheres against a frustum in structure of arrays form.
+ *
+ * Same as batch @ref classify for axis-aligned bounding boxes, with the respective elements of @p radii in place of projected extents.
+ *
+ * @warning Behavior is undefined if any of spans of @p centers, @p radii, or @p out, is shorter than the first span of @p centers.
+ *
+ * @return the first @c centers[0].size() elements of @p out
+ */
+template <typename T>
+constexpr auto classify(
+	frustum<T> const&                                              f,
+	std::type_identity_t<std::array<std::span<T const>, 3>> const& centers,
+	std::type_identity_t<std::span<T const>>                       radii,
+	std::span<containment>                                         out
+) noexcept -> std::span<containment>;
+
+/**
+ * @brief Intersection of a ray and a plane.
+ *
+ * @return the distance along @p r to the plane, or nothing if @p r is parallel to it or points away from it
+ */
+template <std::floating_point T>
+[[nodiscard]]
+constexpr auto intersection(ray<T> const& r, plane<T> const& pl) noexcept -> std::optional<T>;
+
+/**
+ * @brief Intersection of a ray and a sphere.
+ *
+ * @return the distance along @p r to the nearest point of the surface of @p s ahead of its origin, or nothing if @p r misses @p s
+ */
+template <std::floating_point T>
+[[nodiscard]]
+constexpr auto intersection(ray<T> const& r, sphere<T> const& s) noexcept -> std::optional<T>;
+
+/**
+ * @brief Intersection of a ray and an axis-aligned bounding box.
+ *
+ * This clips @p r to the slab between the planes of each pair of opposite faces of @p box, multiplying by the reciprocals of its direction.
+ *
+ * @return the distance along @p r at which it enters @p box, zero if its origin is inside of @p box, or nothing if @p r misses @p box
+ */
+template <std::floating_point T>
+[[nodiscard]]
+constexpr auto intersection(ray<T> const& r, aabb<T> const& box) noexcept -> std::optional<T>;
+
+/**
+ * @brief Intersection of a ray and a triangle.
+ *
+ * This solves for the distance and the barycentric coordinates of the intersection at once,
+ * as per T. Möller and B. Trumbore, "Fast, Minimum Storage Ray/Triangle Intersection". Both faces of @p t are hit.
+ *
+ * @return the intersection, or nothing if @p r misses @p t or is parallel to it
+ */
+template <std::floating_point T>
+[[nodiscard]]
+constexpr auto intersection(ray<T> const& r, triangle<T> const& t) noexcept -> std::optional<triangle_hit<T>>;
+
+/**
+ * @brief Intersection of a packet of rays and a triangle.
+ *
+ * This updates each lane of @p hit whose ray hits @p t nearer than its distance, e.g.
+ * @code
+ * triangle_hit_packet<float, 8> hit;
+ * for (auto const& t : triangles) { intersect(rays, t, hit); }
+ * @endcode
+ * With @c NDML_SIMD, single-precision packets of four and eight rays are tested in SIMD registers,
+ * and the remaining steps are skipped once all lanes missed.
+ *
+ * @return the mask of the updated lanes
+ */
+template <std::floating_point T, std::size_t W>
+constexpr auto intersect(ray_packet<T, W> const& rays, triangle<T> const& t, triangle_hit_packet<T, W>& hit) noexcept -> lane_mask;
+
+/**
+ * @brief Intersection of a ray and a packet of triangles.
+ *
+ * This updates each lane of @p hit whose triangle is hit by @p r nearer than its distance.
+ * The nearest intersection of @p r is that of the least distance of the updated lanes.
+ * With @c NDML_SIMD, single-precision packets of four and eight triangles are tested in SIMD registers,
+ * and the remaining steps are skipped once all lanes missed.
+ *
+ * @return the mask of the updated lanes
+ */
+template <std::floating_point T, std::size_t W>
+constexpr auto intersect(ray<T> const& r, triangle_packet<T, W> const& triangles, triangle_hit_packet<T, W>& hit) noexcept -> lane_mask;
+
+/**
+ * @brief Intersection of a packet of rays and an axis-aligned bounding box.
+ *
+ * This stores the distance along each ray at which it enters @p box to the respective lane of @p entry,
+ * as by the intersection of a single ray, e.g. for testing the nodes of a bounding volume hierarchy.
+ * With @c NDML_SIMD, single-precision packets of four and eight rays are tested in SIMD registers.
+ *
+ * @param max_distance distances beyond which rays are considered to miss @p box
+ *
+ * @return the mask of the lanes whose rays hit @p box, the other lanes of @p entry being unspecified
+ */
+template <std::floating_point T, std::size_t W>
+constexpr auto intersect(ray_packet<T, W> const& rays, aabb<T> const& box, std::array<T, W> const& max_distance, std::array<T, W>& entry) noexcept
+	-> lane_mask;
+
+/**
+ * @brief Intersection of a ray and a packet of axis-aligned bounding boxes.
+ *
+ * This stores the distance along @p r at which it enters each box to the respective lane of @p entry,
+ * as by the intersection of a single ray, e.g. for ordering the children of a node of a wide bounding volume hierarchy.
+ * With @c NDML_SIMD, single-precision packets of four and eight boxes are tested in SIMD registers.
+ *
+ * @param max_distance distance beyond which @p r is considered to miss boxes
+ *
+ * @return the mask of the lanes whose boxes are hit by @p r, the other lanes of @p entry being unspecified
+ */
+template <std::floating_point T, std::size_t W>
+constexpr auto intersect(ray<T> const& r, aabb_packet<T, W> const& boxes, std::type_identity_t<T> max_distance, std::array<T, W>& entry) noexcept
+	-> lane_mask;
+}
+
+#include "operation.inl"
+
+#endif
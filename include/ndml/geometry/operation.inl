@@ -0,0 +1,555 @@
+#include "ndml/math/function.hpp"
+#include "ndml/simd/geometry.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace ndml
+{
+namespace detail
+{
+/**
+ * @brief Element-wise absolute value of a vector.
+ */
+template <typename T>
+constexpr auto absolute(vec<3, T> const& v) noexcept -> vec<3, T>
+{
+	return {std::abs(v.x), std::abs(v.y), std::abs(v.z)};
+}
+
+/**
+ * @brief Transformation of an axis-aligned bounding box.
+ *
+ * Only the upper-left three by three block of @p linear is accessed, so that it may be that of a homogeneous transformation matrix.
+ */
+template <std::size_t N, typename T>
+constexpr auto transform_bounds(mat<N, N, T> const& linear, vec<3, T> const& translation, aabb<T> const& box) noexcept -> aabb<T>
+{
+	auto const c = center(box);
+	auto const e = extent(box);
+
+	auto const row = [&linear](std::size_t r) { return vec<3, T>{linear[0, r], linear[1, r], linear[2, r]}; };
+
+	vec<3, T> const rows[3]{row(0), row(1), row(2)};
+
+	auto const transformed = vec<3, T>{dot(rows[0], c), dot(rows[1], c), dot(rows[2], c)} + translation;
+	auto const radius      = vec<3, T>{dot(absolute(rows[0]), e), dot(absolute(rows[1]), e), dot(absolute(rows[2]), e)};
+
+	return {transformed - radius, transformed + radius};
+}
+
+/**
+ * @brief Classification of a bound against a frustum.
+ *
+ * @p radius maps each plane to the distance from the center of the bound to its boundary along the normal of that plane.
+ */
+template <typename T, typename Radius>
+constexpr auto classify(frustum<T> const& f, vec<3, T> const& c, Radius const& radius) noexcept -> containment
+{
+	auto result = containment::inside;
+
+	for (auto const& pl : f.planes)
+	{
+		auto const d = distance(pl, c);
+		auto const r = radius(pl);
+
+		if (d < -r)
+		{
+			return containment::outside;
+		}
+
+		if (d < r)
+		{
+			result = containment::intersecting;
+		}
+	}
+
+	return result;
+}
+
+/**
+ * @brief Intersection of a ray and a triangle given by its first vertex @p a and the edges @p e1 and @p e2 from it.
+ */
+template <typename T>
+constexpr auto moller_trumbore(vec<3, T> const& o, vec<3, T> const& d, vec<3, T> const& a, vec<3, T> const& e1, vec<3, T> const& e2) noexcept
+	-> std::optional<triangle_hit<T>>
+{
+	// Cramer's rule for o + t d = a + u e1 + v e2, whose determinant is zero if the ray is parallel to the triangle
+	auto const p   = cross(d, e2);
+	auto const det = dot(e1, p);
+	if (det == T{0})
+	{
+		return std::nullopt;
+	}
+
+	auto const inv_det = T{1} / det;
+
+	auto const s = o - a;
+	auto const u = dot(s, p) * inv_det;
+	if (u < T{0} || u > T{1})
+	{
+		return std::nullopt;
+	}
+
+	auto const q = cross(s, e1);
+	auto const v = dot(d, q) * inv_det;
+	if (v < T{0} || u + v > T{1})
+	{
+		return std::nullopt;
+	}
+
+	auto const t = dot(e2, q) * inv_det;
+	if (t < T{0})
+	{
+		return std::nullopt;
+	}
+
+	return triangle_hit<T>{t, u, v};
+}
+
+/**
+ * @brief Updates lane @p i of @p hit with the intersection of a ray and a triangle, as by @c moller_trumbore, if it is nearer.
+ *
+ * All of the tests are evaluated without branching, so that loops over the lanes of packets can be vectorized.
+ *
+ * @return whether the lane was updated
+ */
+template <typename T, std::size_t W>
+constexpr auto moller_trumbore_lane(
+	vec<3, T> const&           o,
+	vec<3, T> const&           d,
+	vec<3, T> const&           a,
+	vec<3, T> const&           e1,
+	vec<3, T> const&           e2,
+	triangle_hit_packet<T, W>& hit,
+	std::size_t                i
+) noexcept -> bool
+{
+	auto const p = cross(d, e2);
+	auto const s = o - a;
+	auto const q = cross(s, e1);
+
+	auto const det     = dot(e1, p);
+	auto const inv_det = det == T{0} ? T{0} : T{1} / det;
+	auto const u       = dot(s, p) * inv_det;
+	auto const v       = dot(d, q) * inv_det;
+	auto const t       = dot(e2, q) * inv_det;
+
+	bool const nearer = (det != T{0}) & (u >= T{0}) & (u <= T{1}) & (v >= T{0}) & (u + v <= T{1}) & (t >= T{0}) & (t < hit.distance[i]);
+
+	hit.distance[i] = nearer ? t : hit.distance[i];
+	hit.u[i]        = nearer ? u : hit.u[i];
+	hit.v[i]        = nearer ? v : hit.v[i];
+
+	return nearer;
+}
+
+/**
+ * @brief Intersection of a ray with origin @p o, direction @p d and reciprocals of direction @p inv_d and an axis-aligned bounding box.
+ *
+ * Slabs parallel to the ray are tested against its origin, rather than clipped to by infinite distances.
+ * The far distance is clamped to the greatest finite value of @p T, so that boxes with infinite corners,
+ * e.g. the default boxes of packets, are missed rather than hit at an infinite distance.
+ */
+template <typename T>
+constexpr auto slab(
+	vec<3, T> const& o,
+	vec<3, T> const& d,
+	vec<3, T> const& inv_d,
+	vec<3, T> const& lower,
+	vec<3, T> const& upper,
+	T const&         max_distance
+) noexcept -> std::optional<T>
+{
+	auto near = T{0};
+	auto far  = std::min(max_distance, std::numeric_limits<T>::max());
+
+	for (std::size_t k = 0; k < 3; ++k)
+	{
+		if (d[k] == T{0})
+		{
+			if (o[k] < lower[k] || o[k] > upper[k])
+			{
+				return std::nullopt;
+			}
+
+			continue;
+		}
+
+		auto const t1 = (lower[k] - o[k]) * inv_d[k];
+		auto const t2 = (upper[k] - o[k]) * inv_d[k];
+
+		near = std::max(near, std::min(t1, t2));
+		far  = std::min(far, std::max(t1, t2));
+	}
+
+	if (near > far)
+	{
+		return std::nullopt;
+	}
+
+	return near;
+}
+
+/**
+ * @brief Updates lane @p i of @p entry with the entry distance of a ray into an axis-aligned bounding box, as by @c slab, if it is hit.
+ *
+ * All of the tests are evaluated without branching, so that loops over the lanes of packets can be vectorized.
+ *
+ * @return whether the lane was updated
+ */
+template <typename T, std::size_t W>
+constexpr auto slab_lane(
+	vec<3, T> const&  o,
+	vec<3, T> const&  d,
+	vec<3, T> const&  inv_d,
+	vec<3, T> const&  lower,
+	vec<3, T> const&  upper,
+	T const&          max_distance,
+	std::array<T, W>& entry,
+	std::size_t       i
+) noexcept -> bool
+{
+	auto near = T{0};
+	auto far  = std::min(max_distance, std::numeric_limits<T>::max());
+
+	bool inside = true;
+	for (std::size_t k = 0; k < 3; ++k)
+	{
+		// slabs parallel to the ray leave the distances as they are, and test its origin instead
+		bool const parallel = d[k] == T{0};
+
+		auto const t1 = parallel ? T{0} : (lower[k] - o[k]) * inv_d[k];
+		auto const t2 = parallel ? far : (upper[k] - o[k]) * inv_d[k];
+
+		near = std::max(near, std::min(t1, t2));
+		far  = std::min(far, std::max(t1, t2));
+		inside &= !(parallel & ((o[k] < lower[k]) | (o[k] > upper[k])));
+	}
+
+	bool const hit = inside & (near <= far);
+
+	entry[i] = hit ? near : entry[i];
+
+	return hit;
+}
+}
+
+template <typename T>
+constexpr auto distance(plane<T> const& pl, vec<3, T> const& p) noexcept -> T
+{
+	return dot(pl.normal, p) + pl.offset;
+}
+
+template <typename T>
+constexpr auto normal(plane<T> const& pl) noexcept -> plane<T>
+{
+	auto const inv_norm = T{1} / math::sqrt(norm_squared(pl.normal), math::precise);
+
+	return {pl.normal * inv_norm, pl.offset * inv_norm};
+}
+
+template <typename T>
+constexpr auto center(aabb<T> const& box) noexcept -> vec<3, T>
+{
+	return (box.lower + box.upper) / T{2};
+}
+
+template <typename T>
+constexpr auto extent(aabb<T> const& box) noexcept -> vec<3, T>
+{
+	return (box.upper - box.lower) / T{2};
+}
+
+template <typename T>
+constexpr auto operator*(affine<3, T> const& a, aabb<T> const& box) noexcept -> aabb<T>
+{
+	return detail::transform_bounds(a.linear, a.translation, box);
+}
+
+template <typename T>
+constexpr auto operator*(mat<4, 4, T> const& m, aabb<T> const& box) noexcept -> aabb<T>
+{
+	return detail::transform_bounds(m, vec<3, T>{m[3, 0], m[3, 1], m[3, 2]}, box);
+}
+
+template <typename T>
+constexpr auto classify(frustum<T> const& f, aabb<T> const& box) noexcept -> containment
+{
+	auto const e = extent(box);
+
+	return detail::classify(f, center(box), [&e](plane<T> const& pl) { return dot(detail::absolute(pl.normal), e); });
+}
+
+template <typename T>
+constexpr auto classify(frustum<T> const& f, sphere<T> const& s) noexcept -> containment
+{
+	return detail::classify(f, s.center, [&s](plane<T> const&) { return s.radius; });
+}
+
+template <typename T>
+constexpr auto intersects(frustum<T> const& f, aabb<T> const& box) noexcept -> bool
+{
+	auto const c = center(box);
+	auto const e = extent(box);
+
+	for (auto const& pl : f.planes)
+	{
+		if (distance(pl, c) < -dot(detail::absolute(pl.normal), e))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+template <typename T>
+constexpr auto intersects(frustum<T> const& f, sphere<T> const& s) noexcept -> bool
+{
+	for (auto const& pl : f.planes)
+	{
+		if (distance(pl, s.center) < -s.radius)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+template <typename T>
+constexpr auto classify(
+	frustum<T> const&                                              f,
+	std::type_identity_t<std::array<std::span<T const>, 3>> const& centers,
+	std::type_identity_t<std::array<std::span<T const>, 3>> const& extents,
+	std::span<containment>                                         out
+) noexcept -> std::span<containment>
+{
+	out = out.first(centers[0].size());
+
+	if constexpr (simd::batch_enabled<frustum<T>>)
+	{
+		if !consteval
+		{
+			simd::batch<frustum<T>>::classify(f, centers, extents, out);
+			return out;
+		}
+	}
+
+	for (std::size_t i = 0; i < out.size(); ++i)
+	{
+		vec<3, T> const c{centers[0][i], centers[1][i], centers[2][i]};
+		vec<3, T> const e{extents[0][i], extents[1][i], extents[2][i]};
+
+		out[i] = detail::classify(f, c, [&e](plane<T> const& pl) { return dot(detail::absolute(pl.normal), e); });
+	}
+
+	return out;
+}
+
+template <typename T>
+constexpr auto classify(
+	frustum<T> const&                                              f,
+	std::type_identity_t<std::array<std::span<T const>, 3>> const& centers,
+	std::type_identity_t<std::span<T const>>                       radii,
+	std::span<containment>                                         out
+) noexcept -> std::span<containment>
+{
+	out = out.first(centers[0].size());
+
+	if constexpr (simd::batch_enabled<frustum<T>>)
+	{
+		if !consteval
+		{
+			simd::batch<frustum<T>>::classify(f, centers, radii, out);
+			return out;
+		}
+	}
+
+	for (std::size_t i = 0; i < out.size(); ++i)
+	{
+		vec<3, T> const c{centers[0][i], centers[1][i], centers[2][i]};
+		auto const      r = radii[i];
+
+		out[i] = detail::classify(f, c, [r](plane<T> const&) { return r; });
+	}
+
+	return out;
+}
+
+template <std::floating_point T>
+constexpr auto intersection(ray<T> const& r, plane<T> const& pl) noexcept -> std::optional<T>
+{
+	auto const rate = dot(pl.normal, r.direction);
+	if (rate == T{0})
+	{
+		return std::nullopt;
+	}
+
+	auto const t = -distance(pl, r.origin) / rate;
+	if (t < T{0})
+	{
+		return std::nullopt;
+	}
+
+	return t;
+}
+
+template <std::floating_point T>
+constexpr auto intersection(ray<T> const& r, sphere<T> const& s) noexcept -> std::optional<T>
+{
+	// roots of |o + t d - c|^2 = r^2, i.e. of a t^2 + 2 b t + c = 0
+	auto const oc = r.origin - s.center;
+	auto const a  = dot(r.direction, r.direction);
+	auto const b  = dot(oc, r.direction);
+	auto const c  = dot(oc, oc) - s.radius * s.radius;
+
+	auto const discriminant = b * b - a * c;
+	if (discriminant < T{0} || a == T{0})
+	{
+		return std::nullopt;
+	}
+
+	auto const root = math::sqrt(discriminant, math::precise);
+
+	// the nearer root is behind the origin if it is inside of the sphere
+	if (auto const t = (-b - root) / a; t >= T{0})
+	{
+		return t;
+	}
+
+	if (auto const t = (-b + root) / a; t >= T{0})
+	{
+		return t;
+	}
+
+	return std::nullopt;
+}
+
+template <std::floating_point T>
+constexpr auto intersection(ray<T> const& r, aabb<T> const& box) noexcept -> std::optional<T>
+{
+	vec<3, T> const inv_d{detail::reciprocal(r.direction.x), detail::reciprocal(r.direction.y), detail::reciprocal(r.direction.z)};
+
+	return detail::slab(r.origin, r.direction, inv_d, box.lower, box.upper, detail::unbounded<T>());
+}
+
+template <std::floating_point T>
+constexpr auto intersection(ray<T> const& r, triangle<T> const& t) noexcept -> std::optional<triangle_hit<T>>
+{
+	auto const& [a, b, c] = t.vertices;
+
+	return detail::moller_trumbore(r.origin, r.direction, a, b - a, c - a);
+}
+
+template <std::floating_point T, std::size_t W>
+constexpr auto intersect(ray_packet<T, W> const& rays, triangle<T> const& t, triangle_hit_packet<T, W>& hit) noexcept -> lane_mask
+{
+	if constexpr (simd::batch_enabled<ray_packet<T, W>>)
+	{
+		if !consteval
+		{
+			return simd::batch<ray_packet<T, W>>::intersect(rays, t, hit);
+		}
+	}
+
+	auto const& [a, b, c] = t.vertices;
+
+	auto const e1 = b - a;
+	auto const e2 = c - a;
+
+	auto const& o = rays.origin();
+	auto const& d = rays.direction();
+
+	lane_mask mask = 0;
+	for (std::size_t i = 0; i < W; ++i)
+	{
+		vec<3, T> const origin{o[0][i], o[1][i], o[2][i]};
+		vec<3, T> const direction{d[0][i], d[1][i], d[2][i]};
+
+		mask |= lane_mask{detail::moller_trumbore_lane(origin, direction, a, e1, e2, hit, i)} << i;
+	}
+
+	return mask;
+}
+
+template <std::floating_point T, std::size_t W>
+constexpr auto intersect(ray<T> const& r, triangle_packet<T, W> const& triangles, triangle_hit_packet<T, W>& hit) noexcept -> lane_mask
+{
+	if constexpr (simd::batch_enabled<triangle_packet<T, W>>)
+	{
+		if !consteval
+		{
+			return simd::batch<triangle_packet<T, W>>::intersect(r, triangles, hit);
+		}
+	}
+
+	auto const& a     = triangles.vertex();
+	auto const& edges = triangles.edges();
+
+	lane_mask mask = 0;
+	for (std::size_t i = 0; i < W; ++i)
+	{
+		vec<3, T> const v{a[0][i], a[1][i], a[2][i]};
+		vec<3, T> const e1{edges[0][0][i], edges[0][1][i], edges[0][2][i]};
+		vec<3, T> const e2{edges[1][0][i], edges[1][1][i], edges[1][2][i]};
+
+		mask |= lane_mask{detail::moller_trumbore_lane(r.origin, r.direction, v, e1, e2, hit, i)} << i;
+	}
+
+	return mask;
+}
+
+template <std::floating_point T, std::size_t W>
+constexpr auto intersect(ray_packet<T, W> const& rays, aabb<T> const& box, std::array<T, W> const& max_distance, std::array<T, W>& entry) noexcept
+	-> lane_mask
+{
+	if constexpr (simd::batch_enabled<ray_packet<T, W>>)
+	{
+		if !consteval
+		{
+			return simd::batch<ray_packet<T, W>>::intersect(rays, box, max_distance, entry);
+		}
+	}
+
+	auto const& inv_d = rays.inverse_direction();
+
+	lane_mask mask = 0;
+	for (std::size_t i = 0; i < W; ++i)
+	{
+		auto const      r = rays[i];
+		vec<3, T> const inverse_direction{inv_d[0][i], inv_d[1][i], inv_d[2][i]};
+
+		mask |= lane_mask{detail::slab_lane(r.origin, r.direction, inverse_direction, box.lower, box.upper, max_distance[i], entry, i)} << i;
+	}
+
+	return mask;
+}
+
+template <std::floating_point T, std::size_t W>
+constexpr auto intersect(ray<T> const& r, aabb_packet<T, W> const& boxes, std::type_identity_t<T> max_distance, std::array<T, W>& entry) noexcept
+	-> lane_mask
+{
+	if constexpr (simd::batch_enabled<aabb_packet<T, W>>)
+	{
+		if !consteval
+		{
+			return simd::batch<aabb_packet<T, W>>::intersect(r, boxes, max_distance, entry);
+		}
+	}
+
+	vec<3, T> const inv_d{detail::reciprocal(r.direction.x), detail::reciprocal(r.direction.y), detail::reciprocal(r.direction.z)};
+
+	lane_mask mask = 0;
+	for (std::size_t i = 0; i < W; ++i)
+	{
+		auto const box = boxes[i];
+
+		mask |= lane_mask{detail::slab_lane(r.origin, r.direction, inv_d, box.lower, box.upper, max_distance, entry, i)} << i;
+	}
+
+	return mask;
+}
+}
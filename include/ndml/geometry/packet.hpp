@@ -0,0 +1,285 @@
+#ifndef NDML_GEOMETRY_PACKET_HPP
+#define NDML_GEOMETRY_PACKET_HPP
+
+#include "shape.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace ndml
+{
+/**
+ * @brief Mask of the lanes of a packet, the bit @c 1 << i of which is set if lane @c i satisfies a query.
+ */
+using lane_mask = std::uint32_t;
+
+/**
+ * @brief Packet of rays in structure of arrays form.
+ *
+ * Each coordinate of the origins and directions of @p W rays is stored contiguously, one lane per ray,
+ * so that a query tests all of them against a primitive at once, e.g. coherent primary rays of a tile of pixels
+ * against the nodes and triangles of a bounding volume hierarchy.
+ * Reciprocals of the directions are stored along with them for slab tests.
+ *
+ * @tparam T element type
+ * @tparam W number of rays, at most 32
+ */
+template <typename T, std::size_t W>
+struct ray_packet
+{
+	static_assert(W >= 1 && W <= 32, "lanes of a packet must fit in a lane mask");
+
+	using value_type = T;
+	using ray_type   = ray<T>;
+	using lane_type  = std::array<T, W>;
+
+	/**
+	 * @brief Number of rays.
+	 */
+	static constexpr std::size_t width = W;
+
+	/**
+	 * @brief Default constructor.
+	 *
+	 * Rays have zero origins and directions, so that they hit no triangles, and only boxes containing the origin.
+	 */
+	constexpr ray_packet() noexcept;
+
+	/**
+	 * @brief Constructor from rays.
+	 */
+	constexpr explicit ray_packet(std::span<ray_type const, W> rays) noexcept;
+
+	/**
+	 * @brief Ray of lane @p lane.
+	 *
+	 * @warning Behavior is undefined when @p lane >= @c width.
+	 */
+	[[nodiscard]]
+	constexpr auto operator[](this ray_packet const& self, std::size_t lane) noexcept -> ray_type;
+
+	/**
+	 * @brief Sets the ray of lane @p lane.
+	 *
+	 * @warning Behavior is undefined when @p lane >= @c width.
+	 */
+	constexpr auto set(this ray_packet& self, std::size_t lane, ray_type const& r) noexcept -> void;
+
+	/**
+	 * @brief Coordinates of the origins, indexed by axis and then by lane.
+	 */
+	[[nodiscard]]
+	constexpr auto origin(this ray_packet const& self) noexcept -> std::array<lane_type, 3> const&;
+
+	/**
+	 * @brief Coordinates of the directions, indexed by axis and then by lane.
+	 */
+	[[nodiscard]]
+	constexpr auto direction(this ray_packet const& self) noexcept -> std::array<lane_type, 3> const&;
+
+	/**
+	 * @brief Reciprocals of the coordinates of the directions, indexed by axis and then by lane.
+	 */
+	[[nodiscard]]
+	constexpr auto inverse_direction(this ray_packet const& self) noexcept -> std::array<lane_type, 3> const&;
+
+protected:
+	/// Coordinates of the origins.
+	std::array<lane_type, 3> origin_{};
+
+	/// Coordinates of the directions.
+	std::array<lane_type, 3> direction_{};
+
+	/// Reciprocals of the coordinates of the directions.
+	std::array<lane_type, 3> inverse_direction_;
+};
+
+/**
+ * @brief Packet of triangles in structure of arrays form.
+ *
+ * Each coordinate of the first vertices and of the edges from them of @p W triangles is stored contiguously, one lane per triangle,
+ * so that a query tests a ray against all of them at once, e.g. against the triangles of a leaf of a bounding volume hierarchy.
+ * Edges are calculated once as the packet is built, rather than by every query.
+ *
+ * @tparam T element type
+ * @tparam W number of triangles, at most 32
+ */
+template <typename T, std::size_t W>
+struct triangle_packet
+{
+	static_assert(W >= 1 && W <= 32, "lanes of a packet must fit in a lane mask");
+
+	using value_type    = T;
+	using triangle_type = triangle<T>;
+	using lane_type     = std::array<T, W>;
+
+	/**
+	 * @brief Number of triangles.
+	 */
+	static constexpr std::size_t width = W;
+
+	/**
+	 * @brief Default constructor.
+	 *
+	 * Triangles are degenerate, with all of their vertices at the origin, so that they are never hit.
+	 */
+	constexpr triangle_packet() noexcept = default;
+
+	/**
+	 * @brief Constructor from triangles.
+	 */
+	constexpr explicit triangle_packet(std::span<triangle_type const, W> triangles) noexcept;
+
+	/**
+	 * @brief Triangle of lane @p lane.
+	 *
+	 * @warning Behavior is undefined when @p lane >= @c width.
+	 */
+	[[nodiscard]]
+	constexpr auto operator[](this triangle_packet const& self, std::size_t lane) noexcept -> triangle_type;
+
+	/**
+	 * @brief Sets the triangle of lane @p lane.
+	 *
+	 * @warning Behavior is undefined when @p lane >= @c width.
+	 */
+	constexpr auto set(this triangle_packet& self, std::size_t lane, triangle_type const& t) noexcept -> void;
+
+	/**
+	 * @brief Coordinates of the first vertices, indexed by axis and then by lane.
+	 */
+	[[nodiscard]]
+	constexpr auto vertex(this triangle_packet const& self) noexcept -> std::array<lane_type, 3> const&;
+
+	/**
+	 * @brief Coordinates of the edges from the first vertices to the other ones, indexed by edge, by axis, and then by lane.
+	 */
+	[[nodiscard]]
+	constexpr auto edges(this triangle_packet const& self) noexcept -> std::array<std::array<lane_type, 3>, 2> const&;
+
+protected:
+	/// Coordinates of the first vertices.
+	std::array<lane_type, 3> vertex_{};
+
+	/// Coordinates of the edges from the first vertices to the second and third ones.
+	std::array<std::array<lane_type, 3>, 2> edges_{};
+};
+
+/**
+ * @brief Packet of axis-aligned bounding boxes in structure of arrays form.
+ *
+ * Each coordinate of the corners of @p W boxes is stored contiguously, one lane per box,
+ * so that a query tests a ray against all of them at once, e.g. against the children of a node of a wide bounding volume hierarchy.
+ *
+ * @tparam T element type
+ * @tparam W number of boxes, at most 32
+ */
+template <typename T, std::size_t W>
+struct aabb_packet
+{
+	static_assert(W >= 1 && W <= 32, "lanes of a packet must fit in a lane mask");
+
+	using value_type = T;
+	using aabb_type  = aabb<T>;
+	using lane_type  = std::array<T, W>;
+
+	/**
+	 * @brief Number of boxes.
+	 */
+	static constexpr std::size_t width = W;
+
+	/**
+	 * @brief Coordinates of the lower corners, indexed by axis and then by lane.
+	 */
+	std::array<lane_type, 3> lower;
+
+	/**
+	 * @brief Coordinates of the upper corners, indexed by axis and then by lane.
+	 */
+	std::array<lane_type, 3> upper;
+
+	/**
+	 * @brief Default constructor.
+	 *
+	 * Boxes are degenerate, with both of their corners infinitely far along every axis, so that they are never hit.
+	 */
+	constexpr aabb_packet() noexcept;
+
+	/**
+	 * @brief Constructor from boxes.
+	 */
+	constexpr explicit aabb_packet(std::span<aabb_type const, W> boxes) noexcept;
+
+	/**
+	 * @brief Box of lane @p lane.
+	 *
+	 * @warning Behavior is undefined when @p lane >= @c width.
+	 */
+	[[nodiscard]]
+	constexpr auto operator[](this aabb_packet const& self, std::size_t lane) noexcept -> aabb_type;
+
+	/**
+	 * @brief Sets the box of lane @p lane.
+	 *
+	 * @warning Behavior is undefined when @p lane >= @c width.
+	 */
+	constexpr auto set(this aabb_packet& self, std::size_t lane, aabb_type const& box) noexcept -> void;
+};
+
+/**
+ * @brief Intersections of rays and triangles of packets.
+ *
+ * Queries update the lanes whose intersections are nearer than the distances they already hold,
+ * so that testing primitives in turn finds the nearest intersection of each lane, and lanes whose distances are zero are inactive.
+ *
+ * @tparam T element type
+ * @tparam W number of lanes
+ */
+template <typename T, std::size_t W>
+struct triangle_hit_packet
+{
+	using value_type = T;
+	using lane_type  = std::array<T, W>;
+
+	/**
+	 * @brief Distances along the rays, or the maximal distances of lanes not hit yet.
+	 */
+	lane_type distance;
+
+	/**
+	 * @brief Barycentric coordinates of the intersections relative to the second vertices.
+	 */
+	lane_type u{};
+
+	/**
+	 * @brief Barycentric coordinates of the intersections relative to the third vertices.
+	 */
+	lane_type v{};
+
+	/**
+	 * @brief Default constructor.
+	 *
+	 * Distances are infinite, or the greatest value of @p T if it has no infinity.
+	 */
+	constexpr triangle_hit_packet() noexcept;
+
+	/**
+	 * @brief Constructor from the distance beyond which intersections are ignored.
+	 */
+	constexpr explicit triangle_hit_packet(T max_distance) noexcept;
+
+	/**
+	 * @brief Intersection of lane @p lane.
+	 *
+	 * @warning Behavior is undefined when @p lane >= @c W.
+	 */
+	[[nodiscard]]
+	constexpr auto operator[](this triangle_hit_packet const& self, std::size_t lane) noexcept -> triangle_hit<T>;
+};
+}
+
+#include "packet.inl"
+
+#endif
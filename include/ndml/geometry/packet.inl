@@ -0,0 +1,188 @@
+#include <limits>
+
+namespace ndml
+{
+namespace detail
+{
+/**
+ * @brief Greatest value of @p T, infinite if representable.
+ */
+template <typename T>
+constexpr auto unbounded() noexcept -> T
+{
+	if constexpr (std::numeric_limits<T>::has_infinity)
+	{
+		return std::numeric_limits<T>::infinity();
+	}
+	else
+	{
+		return std::numeric_limits<T>::max();
+	}
+}
+
+/**
+ * @brief Reciprocal of a coordinate of a ray direction for slab tests, infinite if it is zero.
+ */
+template <typename T>
+constexpr auto reciprocal(T const& d) noexcept -> T
+{
+	return d == T{0} ? unbounded<T>() : T{1} / d;
+}
+}
+
+template <typename T, std::size_t W>
+constexpr ray_packet<T, W>::ray_packet() noexcept
+{
+	for (auto& lanes : inverse_direction_)
+	{
+		lanes.fill(detail::reciprocal(T{0}));
+	}
+}
+
+template <typename T, std::size_t W>
+constexpr ray_packet<T, W>::ray_packet(std::span<ray_type const, W> rays) noexcept
+{
+	for (std::size_t i = 0; i < W; ++i)
+	{
+		set(i, rays[i]);
+	}
+}
+
+template <typename T, std::size_t W>
+constexpr auto ray_packet<T, W>::operator[](this ray_packet const& self, std::size_t lane) noexcept -> ray_type
+{
+	return {
+		vec<3, T>{self.origin_[0][lane], self.origin_[1][lane], self.origin_[2][lane]},
+		vec<3, T>{self.direction_[0][lane], self.direction_[1][lane], self.direction_[2][lane]},
+	};
+}
+
+template <typename T, std::size_t W>
+constexpr auto ray_packet<T, W>::set(this ray_packet& self, std::size_t lane, ray_type const& r) noexcept -> void
+{
+	for (std::size_t k = 0; k < 3; ++k)
+	{
+		self.origin_[k][lane]            = r.origin[k];
+		self.direction_[k][lane]         = r.direction[k];
+		self.inverse_direction_[k][lane] = detail::reciprocal(r.direction[k]);
+	}
+}
+
+template <typename T, std::size_t W>
+constexpr auto ray_packet<T, W>::origin(this ray_packet const& self) noexcept -> std::array<lane_type, 3> const&
+{
+	return self.origin_;
+}
+
+template <typename T, std::size_t W>
+constexpr auto ray_packet<T, W>::direction(this ray_packet const& self) noexcept -> std::array<lane_type, 3> const&
+{
+	return self.direction_;
+}
+
+template <typename T, std::size_t W>
+constexpr auto ray_packet<T, W>::inverse_direction(this ray_packet const& self) noexcept -> std::array<lane_type, 3> const&
+{
+	return self.inverse_direction_;
+}
+
+template <typename T, std::size_t W>
+constexpr triangle_packet<T, W>::triangle_packet(std::span<triangle_type const, W> triangles) noexcept
+{
+	for (std::size_t i = 0; i < W; ++i)
+	{
+		set(i, triangles[i]);
+	}
+}
+
+template <typename T, std::size_t W>
+constexpr auto triangle_packet<T, W>::operator[](this triangle_packet const& self, std::size_t lane) noexcept -> triangle_type
+{
+	vec<3, T> const a{self.vertex_[0][lane], self.vertex_[1][lane], self.vertex_[2][lane]};
+	vec<3, T> const e1{self.edges_[0][0][lane], self.edges_[0][1][lane], self.edges_[0][2][lane]};
+	vec<3, T> const e2{self.edges_[1][0][lane], self.edges_[1][1][lane], self.edges_[1][2][lane]};
+
+	return {a, a + e1, a + e2};
+}
+
+template <typename T, std::size_t W>
+constexpr auto triangle_packet<T, W>::set(this triangle_packet& self, std::size_t lane, triangle_type const& t) noexcept -> void
+{
+	auto const& [a, b, c] = t.vertices;
+
+	for (std::size_t k = 0; k < 3; ++k)
+	{
+		self.vertex_[k][lane]   = a[k];
+		self.edges_[0][k][lane] = b[k] - a[k];
+		self.edges_[1][k][lane] = c[k] - a[k];
+	}
+}
+
+template <typename T, std::size_t W>
+constexpr auto triangle_packet<T, W>::vertex(this triangle_packet const& self) noexcept -> std::array<lane_type, 3> const&
+{
+	return self.vertex_;
+}
+
+template <typename T, std::size_t W>
+constexpr auto triangle_packet<T, W>::edges(this triangle_packet const& self) noexcept -> std::array<std::array<lane_type, 3>, 2> const&
+{
+	return self.edges_;
+}
+
+template <typename T, std::size_t W>
+constexpr aabb_packet<T, W>::aabb_packet() noexcept
+{
+	for (std::size_t k = 0; k < 3; ++k)
+	{
+		lower[k].fill(detail::unbounded<T>());
+		upper[k].fill(detail::unbounded<T>());
+	}
+}
+
+template <typename T, std::size_t W>
+constexpr aabb_packet<T, W>::aabb_packet(std::span<aabb_type const, W> boxes) noexcept
+{
+	for (std::size_t i = 0; i < W; ++i)
+	{
+		set(i, boxes[i]);
+	}
+}
+
+template <typename T, std::size_t W>
+constexpr auto aabb_packet<T, W>::operator[](this aabb_packet const& self, std::size_t lane) noexcept -> aabb_type
+{
+	return {
+		vec<3, T>{self.lower[0][lane], self.lower[1][lane], self.lower[2][lane]},
+		vec<3, T>{self.upper[0][lane], self.upper[1][lane], self.upper[2][lane]},
+	};
+}
+
+template <typename T, std::size_t W>
+constexpr auto aabb_packet<T, W>::set(this aabb_packet& self, std::size_t lane, aabb_type const& box) noexcept -> void
+{
+	for (std::size_t k = 0; k < 3; ++k)
+	{
+		self.lower[k][lane] = box.lower[k];
+		self.upper[k][lane] = box.upper[k];
+	}
+}
+
+template <typename T, std::size_t W>
+constexpr triangle_hit_packet<T, W>::triangle_hit_packet() noexcept
+	: triangle_hit_packet{detail::unbounded<T>()}
+{
+}
+
+template <typename T, std::size_t W>
+constexpr triangle_hit_packet<T, W>::triangle_hit_packet(T max_distance) noexcept
+{
+	distance.fill(max_distance);
+}
+
+template <typename T, std::size_t W>
+constexpr auto triangle_hit_packet<T, W>::operator[](this triangle_hit_packet const& self, std::size_t lane) noexcept -> triangle_hit<T>
+{
+	return {self.distance[lane], self.u[lane], self.v[lane]};
+}
+}
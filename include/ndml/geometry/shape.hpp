@@ -0,0 +1,312 @@
+#ifndef NDML_GEOMETRY_SHAPE_HPP
+#define NDML_GEOMETRY_SHAPE_HPP
+
+#include "ndml/mat/mat.hpp"
+#include "ndml/vec/vec.hpp"
+
+#include <array>
+#include <cstddef>
+
+namespace ndml
+{
+/**
+ * @brief Plane in three-dimensional space.
+ *
+ * It consists of points @f$ p @f$ such that @f$ n \cdot p + d = 0 @f$, where @f$ n @f$ is its normal and @f$ d @f$ is its offset.
+ * Points on the side the normal points to are in front of the plane. Queries expecting signed distances require a unit normal.
+ *
+ * @tparam T element type
+ */
+template <typename T>
+struct plane
+{
+	using value_type = T;
+	using vec_type   = vec<3, T>;
+
+	/**
+	 * @brief Normal.
+	 */
+	vec_type normal;
+
+	/**
+	 * @brief Offset, i.e. the negated dot product of the normal and any point on the plane.
+	 */
+	value_type offset;
+
+	/**
+	 * @brief Default constructor.
+	 *
+	 * Elements are value-initialized.
+	 */
+	constexpr plane() noexcept = default;
+
+	/**
+	 * @brief Constructor from normal and offset.
+	 */
+	constexpr plane(vec_type normal, value_type offset) noexcept;
+
+	/**
+	 * @brief Constructor from normal and point.
+	 *
+	 * The plane passes through @p point.
+	 */
+	constexpr plane(vec_type normal, vec_type const& point) noexcept;
+
+	/**
+	 * @brief Constructor from coefficients.
+	 *
+	 * The normal is initialized to the first three components of @p coefficients and the offset to the last one,
+	 * so that the plane consists of points whose homogeneous coordinates are orthogonal to @p coefficients.
+	 */
+	constexpr explicit plane(vec<4, value_type> const& coefficients) noexcept;
+};
+
+/**
+ * @brief Axis-aligned bounding box.
+ *
+ * It consists of points each coordinate of which lies between the respective coordinates of its lower and upper corners.
+ *
+ * @tparam T element type
+ */
+template <typename T>
+struct aabb
+{
+	using value_type = T;
+	using vec_type   = vec<3, T>;
+
+	/**
+	 * @brief Lower corner, i.e. the least of coordinates along each axis.
+	 */
+	vec_type lower;
+
+	/**
+	 * @brief Upper corner, i.e. the greatest of coordinates along each axis.
+	 */
+	vec_type upper;
+
+	/**
+	 * @brief Default constructor.
+	 *
+	 * Elements are value-initialized.
+	 */
+	constexpr aabb() noexcept = default;
+
+	/**
+	 * @brief Constructor from corners.
+	 */
+	constexpr aabb(vec_type lower, vec_type upper) noexcept;
+};
+
+/**
+ * @brief Sphere.
+ *
+ * @tparam T element type
+ */
+template <typename T>
+struct sphere
+{
+	using value_type = T;
+	using vec_type   = vec<3, T>;
+
+	/**
+	 * @brief Center.
+	 */
+	vec_type center;
+
+	/**
+	 * @brief Radius.
+	 */
+	value_type radius;
+
+	/**
+	 * @brief Default constructor.
+	 *
+	 * Elements are value-initialized.
+	 */
+	constexpr sphere() noexcept = default;
+
+	/**
+	 * @brief Constructor from center and radius.
+	 */
+	constexpr sphere(vec_type center, value_type radius) noexcept;
+};
+
+/**
+ * @brief Ray, i.e. half-line.
+ *
+ * It consists of points @f$ o + t d @f$ for @f$ t \ge 0 @f$, where @f$ o @f$ is its origin and @f$ d @f$ is its direction.
+ * The direction need not be a unit vector, in which case distances along the ray are in units of its length.
+ *
+ * @tparam T element type
+ */
+template <typename T>
+struct ray
+{
+	using value_type = T;
+	using vec_type   = vec<3, T>;
+
+	/**
+	 * @brief Origin.
+	 */
+	vec_type origin;
+
+	/**
+	 * @brief Direction.
+	 */
+	vec_type direction;
+
+	/**
+	 * @brief Default constructor.
+	 *
+	 * Elements are value-initialized.
+	 */
+	constexpr ray() noexcept = default;
+
+	/**
+	 * @brief Constructor from origin and direction.
+	 */
+	constexpr ray(vec_type origin, vec_type direction) noexcept;
+};
+
+/**
+ * @brief Triangle.
+ *
+ * Its front face is the one its vertices appear counterclockwise from, i.e. the one the cross product of its edges from the first vertex points to.
+ *
+ * @tparam T element type
+ */
+template <typename T>
+struct triangle
+{
+	using value_type = T;
+	using vec_type   = vec<3, T>;
+
+	/**
+	 * @brief Vertices.
+	 */
+	std::array<vec_type, 3> vertices;
+
+	/**
+	 * @brief Default constructor.
+	 *
+	 * Vertices are value-initialized.
+	 */
+	constexpr triangle() noexcept = default;
+
+	/**
+	 * @brief Constructor from vertices.
+	 */
+	constexpr triangle(vec_type a, vec_type b, vec_type c) noexcept;
+};
+
+/**
+ * @brief View frustum.
+ *
+ * It consists of points in front of all of its six planes, whose normals point inwards.
+ *
+ * @tparam T element type
+ */
+template <typename T>
+struct frustum
+{
+	using value_type = T;
+	using plane_type = plane<T>;
+
+	/**
+	 * @brief Indices of planes.
+	 */
+	enum side : std::size_t
+	{
+		left,
+		right,
+		bottom,
+		top,
+		near,
+		far,
+	};
+
+	/**
+	 * @brief Planes, in order of @ref side.
+	 */
+	std::array<plane_type, 6> planes;
+
+	/**
+	 * @brief Default constructor.
+	 *
+	 * Planes are value-initialized.
+	 */
+	constexpr frustum() noexcept = default;
+
+	/**
+	 * @brief Constructor from planes.
+	 */
+	constexpr explicit frustum(std::array<plane_type, 6> const& planes) noexcept;
+
+	/**
+	 * @brief Constructor from clip matrix.
+	 *
+	 * This extracts the planes bounding the points which @p clip maps into the clip volume, i.e. whose homogeneous clip coordinates
+	 * satisfy @f$ -w \le x, y, z \le w @f$, as per G. Gribb and K. Hartmann, "Fast Extraction of Viewing Frustum Planes from the World-View-Projection Matrix".
+	 * Each plane is a sum or a difference of the last row of @p clip and one of the others, normalized so that distances are signed Euclidean ones.
+	 * The clip volume is the one of @ref perspective and @ref ortho, and @p clip is usually their product by the view and model matrices,
+	 * so that the planes are in the space of the model.
+	 *
+	 * @param clip clip matrix
+	 */
+	constexpr explicit frustum(mat<4, 4, T> const& clip) noexcept;
+};
+
+template <typename T>
+frustum(mat<4, 4, T> const&) -> frustum<T>;
+
+/**
+ * @brief Relation of a shape to a region.
+ */
+enum class containment : unsigned char
+{
+	/**
+	 * @brief The shape is entirely outside of the region.
+	 */
+	outside,
+
+	/**
+	 * @brief The shape may be partially inside of the region.
+	 */
+	intersecting,
+
+	/**
+	 * @brief The shape is entirely inside of the region.
+	 */
+	inside,
+};
+
+/**
+ * @brief Intersection of a ray and a triangle.
+ *
+ * The intersection is the point @f$ (1 - u - v) a + u b + v c @f$ of the triangle with vertices @f$ a, b, c @f$.
+ *
+ * @tparam T element type
+ */
+template <typename T>
+struct triangle_hit
+{
+	/**
+	 * @brief Distance along the ray, in units of the length of its direction.
+	 */
+	T distance;
+
+	/**
+	 * @brief Barycentric coordinate of the intersection relative to the second vertex.
+	 */
+	T u;
+
+	/**
+	 * @brief Barycentric coordinate of the intersection relative to the third vertex.
+	 */
+	T v;
+};
+}
+
+#include "shape.inl"
+
+#endif
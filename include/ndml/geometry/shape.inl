@@ -0,0 +1,82 @@
+#include "ndml/math/function.hpp"
+
+#include <utility>
+
+namespace ndml
+{
+template <typename T>
+constexpr plane<T>::plane(vec_type normal, value_type offset) noexcept
+	: normal{std::move(normal)}
+	, offset{std::move(offset)}
+{
+}
+
+template <typename T>
+constexpr plane<T>::plane(vec_type normal, vec_type const& point) noexcept
+	: normal{std::move(normal)}
+	, offset{-dot(this->normal, point)}
+{
+}
+
+template <typename T>
+constexpr plane<T>::plane(vec<4, value_type> const& coefficients) noexcept
+	: normal{coefficients.xyz()}
+	, offset{coefficients.w}
+{
+}
+
+template <typename T>
+constexpr aabb<T>::aabb(vec_type lower, vec_type upper) noexcept
+	: lower{std::move(lower)}
+	, upper{std::move(upper)}
+{
+}
+
+template <typename T>
+constexpr sphere<T>::sphere(vec_type center, value_type radius) noexcept
+	: center{std::move(center)}
+	, radius{std::move(radius)}
+{
+}
+
+template <typename T>
+constexpr ray<T>::ray(vec_type origin, vec_type direction) noexcept
+	: origin{std::move(origin)}
+	, direction{std::move(direction)}
+{
+}
+
+template <typename T>
+constexpr triangle<T>::triangle(vec_type a, vec_type b, vec_type c) noexcept
+	: vertices{std::move(a), std::move(b), std::move(c)}
+{
+}
+
+template <typename T>
+constexpr frustum<T>::frustum(std::array<plane_type, 6> const& planes) noexcept
+	: planes{planes}
+{
+}
+
+template <typename T>
+constexpr frustum<T>::frustum(mat<4, 4, T> const& clip) noexcept
+{
+	auto const row = [&clip](std::size_t i) { return vec<4, T>{clip[0, i], clip[1, i], clip[2, i], clip[3, i]}; };
+
+	auto const x = row(0);
+	auto const y = row(1);
+	auto const z = row(2);
+	auto const w = row(3);
+
+	vec<4, T> const coefficients[6]{w + x, w - x, w + y, w - y, w + z, w - z};
+
+	for (std::size_t i = 0; i < 6; ++i)
+	{
+		plane_type const p{coefficients[i]};
+
+		auto const inv_norm = T{1} / math::sqrt(dot(p.normal, p.normal), math::precise);
+
+		planes[i] = {p.normal * inv_norm, p.offset * inv_norm};
+	}
+}
+}
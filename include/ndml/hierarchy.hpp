@@ -0,0 +1,6 @@
+#ifndef NDML_HIERARCHY_HPP
+#define NDML_HIERARCHY_HPP
+
+#include "hierarchy/hierarchy.hpp"
+
+#endif
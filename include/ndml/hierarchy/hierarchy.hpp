@@ -0,0 +1,189 @@
+#ifndef NDML_HIERARCHY_HIERARCHY_HPP
+#define NDML_HIERARCHY_HIERARCHY_HPP
+
+#include "ndml/parallel/algorithm.hpp"
+#include "ndml/parallel/pool.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace ndml
+{
+/**
+ * @brief Flat transformation hierarchy with incremental update.
+ *
+ * Nodes are stored in order of addition, so that each parent precedes its children, as structure of arrays
+ * of parent indices, local transformations (relative to the parent), and world transformations (relative to the root).
+ * Setting a local transformation marks its node dirty, and @ref update recomposes world transformations of dirty nodes
+ * and of their descendants only, in a single pass in order of nodes, e.g.
+ * @code
+ * hierarchy<mat<4, 4, float>> scene;
+ *
+ * auto const body = scene.add(translation(position));
+ * auto const arm  = scene.add(translation(offset) * rotation(orientation), body);
+ * scene.update(); // all nodes are composed, as added nodes are dirty
+ *
+ * scene.set_local(arm, translation(offset) * rotation(next_orientation) * scale(size));
+ * scene.update(); // only the arm is recomposed
+ * @endcode
+ * The world transformation of a node is the product of that of its parent and its local one, and that of a root is its local one.
+ *
+ * @tparam M transformation type, e.g. @c mat<4, 4, T>, @c affine<3, T>, or @c dual_quat<T>
+ */
+template <typename M>
+struct hierarchy
+{
+	using transform_type = M;
+
+	/**
+	 * @brief Parent index of roots.
+	 */
+	static constexpr std::size_t no_parent = std::numeric_limits<std::size_t>::max();
+
+	/**
+	 * @brief Default constructor.
+	 *
+	 * The hierarchy is empty.
+	 */
+	constexpr hierarchy() = default;
+
+	/**
+	 * @brief Reserves storage for @p count nodes.
+	 */
+	constexpr auto reserve(this hierarchy& self, std::size_t count) -> void;
+
+	/**
+	 * @brief Adds a node.
+	 *
+	 * The node is dirty, so that its world transformation is calculated by the next update.
+	 *
+	 * @warning Behavior is undefined if @p parent is neither @ref no_parent nor less than @c size().
+	 *
+	 * @param local  local transformation
+	 * @param parent index of the parent node, or @ref no_parent for a root
+	 *
+	 * @return the index of the node, which is the number of nodes before it was added
+	 */
+	constexpr auto add(this hierarchy& self, transform_type const& local, std::size_t parent = no_parent) -> std::size_t;
+
+	/**
+	 * @brief Number of nodes.
+	 */
+	[[nodiscard]]
+	constexpr auto size(this hierarchy const& self) noexcept -> std::size_t;
+
+	/**
+	 * @brief Whether the hierarchy has no nodes.
+	 */
+	[[nodiscard]]
+	constexpr auto empty(this hierarchy const& self) noexcept -> bool;
+
+	/**
+	 * @brief Index of the parent of node @p node, or @ref no_parent if it is a root.
+	 *
+	 * @warning Behavior is undefined when @p node >= @c size().
+	 */
+	[[nodiscard]]
+	constexpr auto parent(this hierarchy const& self, std::size_t node) noexcept -> std::size_t;
+
+	/**
+	 * @brief Local transformation of node @p node.
+	 *
+	 * @warning Behavior is undefined when @p node >= @c size().
+	 */
+	[[nodiscard]]
+	constexpr auto local(this hierarchy const& self, std::size_t node) noexcept -> transform_type const&;
+
+	/**
+	 * @brief World transformation of node @p node, as of the last update.
+	 *
+	 * @warning Behavior is undefined when @p node >= @c size().
+	 */
+	[[nodiscard]]
+	constexpr auto world(this hierarchy const& self, std::size_t node) noexcept -> transform_type const&;
+
+	/**
+	 * @brief Whether the local transformation of node @p node was set since the last update.
+	 *
+	 * Descendants of dirty nodes are recomposed by the next update as well, although they are not dirty themselves.
+	 *
+	 * @warning Behavior is undefined when @p node >= @c size().
+	 */
+	[[nodiscard]]
+	constexpr auto dirty(this hierarchy const& self, std::size_t node) noexcept -> bool;
+
+	/**
+	 * @brief Sets the local transformation of node @p node and marks it dirty.
+	 *
+	 * @warning Behavior is undefined when @p node >= @c size().
+	 */
+	constexpr auto set_local(this hierarchy& self, std::size_t node, transform_type const& local) noexcept -> void;
+
+	/**
+	 * @brief Parent indices of all nodes.
+	 */
+	[[nodiscard]]
+	constexpr auto parents(this hierarchy const& self) noexcept -> std::span<std::size_t const>;
+
+	/**
+	 * @brief Local transformations of all nodes.
+	 */
+	[[nodiscard]]
+	constexpr auto locals(this hierarchy const& self) noexcept -> std::span<transform_type const>;
+
+	/**
+	 * @brief World transformations of all nodes, as of the last update.
+	 */
+	[[nodiscard]]
+	constexpr auto worlds(this hierarchy const& self) noexcept -> std::span<transform_type const>;
+
+	/**
+	 * @brief Incremental update.
+	 *
+	 * This recomposes the world transformations of dirty nodes and of their descendants, and clears the dirty flags.
+	 * As parents precede their children, a single pass in order of nodes, starting at the first dirty one, suffices,
+	 * in which a node is recomposed if it is dirty or its parent was recomposed.
+	 *
+	 * @return the number of recomposed nodes
+	 */
+	constexpr auto update(this hierarchy& self) -> std::size_t;
+
+	/**
+	 * @brief Parallel incremental update.
+	 *
+	 * Same as @ref update, except that nodes of the same depth, whose subtrees are independent, are recomposed across the threads of @p p,
+	 * one depth after another. This pays off for wide hierarchies, e.g. of many independent objects, rather than for deep ones.
+	 *
+	 * @return the number of recomposed nodes
+	 */
+	auto update(this hierarchy& self, parallel::pool& p) -> std::size_t;
+
+private:
+	/// Parent indices.
+	std::vector<std::size_t> parents_;
+
+	/// Local transformations.
+	std::vector<transform_type> locals_;
+
+	/// World transformations.
+	std::vector<transform_type> worlds_;
+
+	/// Whether each node is to be recomposed by the next update, set for descendants of dirty nodes during the update.
+	std::vector<unsigned char> dirty_;
+
+	/// Least index of a dirty node, before which no node is recomposed, or the number of nodes if there are none.
+	std::size_t first_dirty_ = 0;
+
+	/// Depths, i.e. numbers of ancestors.
+	std::vector<std::size_t> depths_;
+
+	/// Indices of nodes grouped by depth, for the parallel update.
+	std::vector<std::vector<std::size_t>> levels_;
+};
+}
+
+#include "hierarchy.inl"
+
+#endif
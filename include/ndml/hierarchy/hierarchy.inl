@@ -0,0 +1,183 @@
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+
+namespace ndml
+{
+template <typename M>
+constexpr auto hierarchy<M>::reserve(this hierarchy& self, std::size_t count) -> void
+{
+	self.parents_.reserve(count);
+	self.locals_.reserve(count);
+	self.worlds_.reserve(count);
+	self.dirty_.reserve(count);
+	self.depths_.reserve(count);
+}
+
+template <typename M>
+constexpr auto hierarchy<M>::add(this hierarchy& self, transform_type const& local, std::size_t parent) -> std::size_t
+{
+	auto const node  = self.size();
+	auto const depth = parent == no_parent ? 0 : self.depths_[parent] + 1;
+
+	self.parents_.push_back(parent);
+	self.locals_.push_back(local);
+	self.worlds_.push_back(local);
+	self.dirty_.push_back(1);
+	self.depths_.push_back(depth);
+
+	if (depth == self.levels_.size())
+	{
+		self.levels_.emplace_back();
+	}
+
+	self.levels_[depth].push_back(node);
+
+	self.first_dirty_ = std::min(self.first_dirty_, node);
+
+	return node;
+}
+
+template <typename M>
+constexpr auto hierarchy<M>::size(this hierarchy const& self) noexcept -> std::size_t
+{
+	return self.parents_.size();
+}
+
+template <typename M>
+constexpr auto hierarchy<M>::empty(this hierarchy const& self) noexcept -> bool
+{
+	return self.parents_.empty();
+}
+
+template <typename M>
+constexpr auto hierarchy<M>::parent(this hierarchy const& self, std::size_t node) noexcept -> std::size_t
+{
+	return self.parents_[node];
+}
+
+template <typename M>
+constexpr auto hierarchy<M>::local(this hierarchy const& self, std::size_t node) noexcept -> transform_type const&
+{
+	return self.locals_[node];
+}
+
+template <typename M>
+constexpr auto hierarchy<M>::world(this hierarchy const& self, std::size_t node) noexcept -> transform_type const&
+{
+	return self.worlds_[node];
+}
+
+template <typename M>
+constexpr auto hierarchy<M>::dirty(this hierarchy const& self, std::size_t node) noexcept -> bool
+{
+	return self.dirty_[node] != 0;
+}
+
+template <typename M>
+constexpr auto hierarchy<M>::set_local(this hierarchy& self, std::size_t node, transform_type const& local) noexcept -> void
+{
+	self.locals_[node] = local;
+	self.dirty_[node]  = 1;
+
+	self.first_dirty_ = std::min(self.first_dirty_, node);
+}
+
+template <typename M>
+constexpr auto hierarchy<M>::parents(this hierarchy const& self) noexcept -> std::span<std::size_t const>
+{
+	return self.parents_;
+}
+
+template <typename M>
+constexpr auto hierarchy<M>::locals(this hierarchy const& self) noexcept -> std::span<transform_type const>
+{
+	return self.locals_;
+}
+
+template <typename M>
+constexpr auto hierarchy<M>::worlds(this hierarchy const& self) noexcept -> std::span<transform_type const>
+{
+	return self.worlds_;
+}
+
+template <typename M>
+constexpr auto hierarchy<M>::update(this hierarchy& self) -> std::size_t
+{
+	std::size_t recomposed = 0;
+
+	for (auto node = self.first_dirty_; node < self.size(); ++node)
+	{
+		auto const parent = self.parents_[node];
+
+		// parents precede their children, so that their flags already tell whether they were recomposed in this pass
+		if (parent != no_parent && self.dirty_[parent])
+		{
+			self.dirty_[node] = 1;
+		}
+
+		if (self.dirty_[node])
+		{
+			self.worlds_[node] = parent == no_parent ? self.locals_[node] : self.worlds_[parent] * self.locals_[node];
+			++recomposed;
+		}
+	}
+
+	std::fill(self.dirty_.begin() + static_cast<std::ptrdiff_t>(self.first_dirty_), self.dirty_.end(), 0);
+	self.first_dirty_ = self.size();
+
+	return recomposed;
+}
+
+template <typename M>
+auto hierarchy<M>::update(this hierarchy& self, parallel::pool& p) -> std::size_t
+{
+	constexpr auto length = std::max<std::size_t>(parallel::block_size / sizeof(transform_type), 1);
+
+	if (self.first_dirty_ == self.size())
+	{
+		return 0;
+	}
+
+	std::atomic<std::size_t> recomposed = 0;
+
+	// nodes of a depth only read nodes of the previous one, which is done by the time the run over the depth starts
+	for (auto const& level : self.levels_)
+	{
+		// nodes of a depth are in order, so that those from the first dirty one on are the last ones
+		auto const first = static_cast<std::size_t>(std::ranges::lower_bound(level, self.first_dirty_) - level.begin());
+
+		p.run(
+			(level.size() - first + length - 1) / length,
+			[&](std::size_t chunk)
+			{
+				std::size_t count = 0;
+
+				for (auto i = first + chunk * length; i < std::min(level.size(), first + (chunk + 1) * length); ++i)
+				{
+					auto const node   = level[i];
+					auto const parent = self.parents_[node];
+
+					if (parent != no_parent && self.dirty_[parent])
+					{
+						self.dirty_[node] = 1;
+					}
+
+					if (self.dirty_[node])
+					{
+						self.worlds_[node] = parent == no_parent ? self.locals_[node] : self.worlds_[parent] * self.locals_[node];
+						++count;
+					}
+				}
+
+				recomposed.fetch_add(count, std::memory_order_relaxed);
+			}
+		);
+	}
+
+	std::fill(self.dirty_.begin() + static_cast<std::ptrdiff_t>(self.first_dirty_), self.dirty_.end(), 0);
+	self.first_dirty_ = self.size();
+
+	return recomposed.load(std::memory_order_relaxed);
+}
+}
@@ -0,0 +1,7 @@
+#ifndef NDML_INSTRUMENT_HPP
+#define NDML_INSTRUMENT_HPP
+
+#include "instrument/instrument.hpp"
+#include "instrument/zone.hpp"
+
+#endif
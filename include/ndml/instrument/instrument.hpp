@@ -0,0 +1,263 @@
+#ifndef NDML_INSTRUMENT_INSTRUMENT_HPP
+#define NDML_INSTRUMENT_INSTRUMENT_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+/**
+ * @def NDML_INSTRUMENT
+ *
+ * @brief Opt-in switch for instrumentation of expensive operations.
+ *
+ * When defined, each call to one of the operations of @c ndml::instrument::operation outside of constant evaluation
+ * is counted in counters of the calling thread, timed if timing is enabled, and reported to zone hooks if set,
+ * so that time spent in inlined operations can be attributed to them. Otherwise, operations are not instrumented at all,
+ * and the functions of @c ndml::instrument report no calls.
+ *
+ * @note Calls are counted and timed inclusively, i.e. an operation calling another, e.g. @c inverse of a large matrix calling @c lu,
+ *       counts as a call to each of them, and the time spent in the latter is included in that of the former.
+ */
+
+namespace ndml::instrument
+{
+/**
+ * @brief Instrumented operation.
+ */
+enum class operation : std::uint8_t
+{
+	row_echelon_form,
+	determinant,
+	inverse,
+	inverse_and_determinant,
+	affine_inverse,
+	rigid_inverse,
+	lu,
+	cholesky,
+	eigen,
+	mat_transform,
+	rotation,
+	look_at,
+	ortho,
+	perspective,
+	versor,
+	quat_rotation,
+	axis_angle,
+	slerp,
+	quat_transform,
+};
+
+/**
+ * @brief Number of instrumented operations.
+ */
+inline constexpr std::size_t operation_count = static_cast<std::size_t>(operation::quat_transform) + 1;
+
+/**
+ * @brief Name of an operation, e.g. @c "mat/inverse", suitable for labelling profiler zones.
+ */
+[[nodiscard]]
+constexpr auto name(operation op) noexcept -> std::string_view;
+
+/**
+ * @brief Statistics of an operation.
+ */
+struct statistics
+{
+	/// Number of calls.
+	std::uint64_t calls = 0;
+
+	/// Time spent in calls while timing was enabled.
+	std::chrono::nanoseconds time{0};
+};
+
+/**
+ * @brief Statistics of all of the operations.
+ */
+struct report
+{
+	/**
+	 * @brief Statistics of operation @p op.
+	 */
+	[[nodiscard]]
+	auto operator[](this report const& self, operation op) noexcept -> statistics const&;
+
+	/// Statistics, indexed by operation.
+	std::array<statistics, operation_count> operations{};
+};
+
+/**
+ * @brief Statistics of all threads since the start of the program or the last call to @c reset.
+ *
+ * This merges the counters of all threads, including those which have exited. These are only read,
+ * so that threads are not synchronized with, and calls in progress on other threads may or may not be included.
+ */
+[[nodiscard]]
+auto snapshot() -> report;
+
+/**
+ * @brief Resets the statistics reported by @c snapshot to zero.
+ *
+ * Counters of threads are left as they are, and are instead subtracted from by later snapshots.
+ */
+auto reset() -> void;
+
+/**
+ * @brief Enables or disables timing of calls.
+ *
+ * Timing is disabled by default, as it reads a clock twice per call, whereas counting only increments a counter of the calling thread.
+ */
+auto enable_timing(bool enabled) noexcept -> void;
+
+/**
+ * @brief Hooks called at the start and the end of each call, as by zones of profilers such as ITT or Tracy.
+ *
+ * Hooks are called on the thread of the call, and must neither throw nor call instrumented operations.
+ */
+struct zone_hooks
+{
+	/// Called at the start of each call.
+	void (*begin)(operation op, void* context) noexcept = nullptr;
+
+	/// Called at the end of each call.
+	void (*end)(operation op, void* context) noexcept = nullptr;
+
+	/// Context passed to the hooks.
+	void* context = nullptr;
+};
+
+/**
+ * @brief Sets the zone hooks.
+ *
+ * @param hooks hooks, which must outlive all instrumented calls, or null to unset them
+ */
+auto set_hooks(zone_hooks const* hooks) noexcept -> void;
+
+/**
+ * @brief Scope of an instrumented call.
+ *
+ * It counts the call on construction, and times it and calls the zone hooks as configured, outside of constant evaluation.
+ */
+struct zone
+{
+	/**
+	 * @brief Constructor from the operation called.
+	 */
+	constexpr explicit zone(operation op) noexcept;
+
+	zone(zone const&) = delete;
+
+	auto operator=(zone const&) -> zone& = delete;
+
+	/**
+	 * @brief Destructor.
+	 *
+	 * This ends the call.
+	 */
+	constexpr ~zone();
+
+private:
+	/**
+	 * @brief Starts the call.
+	 */
+	auto begin(this zone& self) noexcept -> void;
+
+	/**
+	 * @brief Ends the call.
+	 */
+	auto end(this zone& self) noexcept -> void;
+
+	/// Operation called.
+	operation op_;
+
+	/// Whether the call is timed.
+	bool timed_ = false;
+
+	/// Zone hooks at the start of the call, if any, so that the end is reported to the same ones.
+	zone_hooks const* hooks_ = nullptr;
+
+	/// Start of the call, if timed.
+	std::chrono::steady_clock::time_point start_{};
+};
+
+namespace detail
+{
+/**
+ * @brief Counters of a thread.
+ *
+ * They are only written by their thread, without read-modify-write operations, and read by snapshots of any thread.
+ */
+struct thread_counters
+{
+	/**
+	 * @brief Default constructor.
+	 *
+	 * This registers the counters.
+	 */
+	thread_counters();
+
+	thread_counters(thread_counters const&) = delete;
+
+	auto operator=(thread_counters const&) -> thread_counters& = delete;
+
+	/**
+	 * @brief Destructor.
+	 *
+	 * This merges the counters into those of exited threads, and unregisters them.
+	 */
+	~thread_counters();
+
+	/// Number of calls, indexed by operation.
+	std::array<std::atomic<std::uint64_t>, operation_count> calls{};
+
+	/// Time spent in calls in nanoseconds, indexed by operation.
+	std::array<std::atomic<std::uint64_t>, operation_count> nanoseconds{};
+};
+
+/**
+ * @brief Counters of all threads.
+ */
+struct registry
+{
+	/// Guards the counters of threads and of exited threads, and the baseline.
+	std::mutex mutex;
+
+	/// Counters of running threads.
+	std::vector<thread_counters const*> threads;
+
+	/// Merged statistics of exited threads.
+	report exited;
+
+	/// Statistics at the last reset.
+	report baseline;
+
+	/// Whether calls are timed.
+	std::atomic<bool> timing{false};
+
+	/// Zone hooks, or null if unset.
+	std::atomic<zone_hooks const*> hooks{nullptr};
+};
+
+/**
+ * @brief Registry of the program.
+ *
+ * It is constant-initialized, so that calls need not check whether it is.
+ */
+inline constinit registry global{};
+
+/**
+ * @brief Counters of the calling thread.
+ */
+[[nodiscard]]
+auto local_counters() -> thread_counters&;
+}
+}
+
+#include "instrument.inl"
+
+#endif
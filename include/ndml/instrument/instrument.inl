@@ -0,0 +1,199 @@
+namespace ndml::instrument
+{
+constexpr auto name(operation op) noexcept -> std::string_view
+{
+	switch (op)
+	{
+	case operation::row_echelon_form:
+		return "mat/row_echelon_form";
+	case operation::determinant:
+		return "mat/determinant";
+	case operation::inverse:
+		return "mat/inverse";
+	case operation::inverse_and_determinant:
+		return "mat/inverse_and_determinant";
+	case operation::affine_inverse:
+		return "mat/affine_inverse";
+	case operation::rigid_inverse:
+		return "mat/rigid_inverse";
+	case operation::lu:
+		return "mat/lu";
+	case operation::cholesky:
+		return "mat/cholesky";
+	case operation::eigen:
+		return "mat/eigen";
+	case operation::mat_transform:
+		return "mat/transform";
+	case operation::rotation:
+		return "mat/rotation";
+	case operation::look_at:
+		return "mat/look_at";
+	case operation::ortho:
+		return "mat/ortho";
+	case operation::perspective:
+		return "mat/perspective";
+	case operation::versor:
+		return "quat/versor";
+	case operation::quat_rotation:
+		return "quat/rotation";
+	case operation::axis_angle:
+		return "quat/axis_angle";
+	case operation::slerp:
+		return "quat/slerp";
+	case operation::quat_transform:
+		return "quat/transform";
+	}
+
+	return "?";
+}
+
+inline auto report::operator[](this report const& self, operation op) noexcept -> statistics const&
+{
+	return self.operations[static_cast<std::size_t>(op)];
+}
+
+namespace detail
+{
+/**
+ * @brief Increments a counter only written by the calling thread.
+ */
+inline auto add(std::atomic<std::uint64_t>& counter, std::uint64_t value) noexcept -> void
+{
+	counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Adds the counters of @p c to @p r.
+ */
+inline auto merge(report& r, thread_counters const& c) noexcept -> void
+{
+	for (std::size_t i = 0; i < operation_count; ++i)
+	{
+		r.operations[i].calls += c.calls[i].load(std::memory_order_relaxed);
+		r.operations[i].time += std::chrono::nanoseconds{c.nanoseconds[i].load(std::memory_order_relaxed)};
+	}
+}
+
+/**
+ * @brief Statistics of all threads since the start of the program.
+ *
+ * @warning The mutex of @p r must be held.
+ */
+inline auto totals(registry const& r) noexcept -> report
+{
+	auto total = r.exited;
+	for (auto const* c : r.threads)
+	{
+		merge(total, *c);
+	}
+
+	return total;
+}
+
+inline thread_counters::thread_counters()
+{
+	auto&                 r = global;
+	std::lock_guard const lock{r.mutex};
+
+	r.threads.push_back(this);
+}
+
+inline thread_counters::~thread_counters()
+{
+	auto&                 r = global;
+	std::lock_guard const lock{r.mutex};
+
+	merge(r.exited, *this);
+	std::erase(r.threads, this);
+}
+
+inline auto local_counters() -> thread_counters&
+{
+	thread_local thread_counters c;
+
+	return c;
+}
+}
+
+inline auto snapshot() -> report
+{
+	auto&                 r = detail::global;
+	std::lock_guard const lock{r.mutex};
+
+	auto total = detail::totals(r);
+	for (std::size_t i = 0; i < operation_count; ++i)
+	{
+		total.operations[i].calls -= r.baseline.operations[i].calls;
+		total.operations[i].time -= r.baseline.operations[i].time;
+	}
+
+	return total;
+}
+
+inline auto reset() -> void
+{
+	auto&                 r = detail::global;
+	std::lock_guard const lock{r.mutex};
+
+	r.baseline = detail::totals(r);
+}
+
+inline auto enable_timing(bool enabled) noexcept -> void
+{
+	detail::global.timing.store(enabled, std::memory_order_relaxed);
+}
+
+inline auto set_hooks(zone_hooks const* hooks) noexcept -> void
+{
+	detail::global.hooks.store(hooks, std::memory_order_release);
+}
+
+constexpr zone::zone(operation op) noexcept : op_{op}
+{
+	if !consteval
+	{
+		begin();
+	}
+}
+
+constexpr zone::~zone()
+{
+	if !consteval
+	{
+		end();
+	}
+}
+
+inline auto zone::begin(this zone& self) noexcept -> void
+{
+	auto& r = detail::global;
+
+	detail::add(detail::local_counters().calls[static_cast<std::size_t>(self.op_)], 1);
+
+	self.hooks_ = r.hooks.load(std::memory_order_acquire);
+	if (self.hooks_ != nullptr && self.hooks_->begin != nullptr)
+	{
+		self.hooks_->begin(self.op_, self.hooks_->context);
+	}
+
+	self.timed_ = r.timing.load(std::memory_order_relaxed);
+	if (self.timed_)
+	{
+		self.start_ = std::chrono::steady_clock::now();
+	}
+}
+
+inline auto zone::end(this zone& self) noexcept -> void
+{
+	if (self.timed_)
+	{
+		auto const elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - self.start_);
+		detail::add(detail::local_counters().nanoseconds[static_cast<std::size_t>(self.op_)], static_cast<std::uint64_t>(elapsed.count()));
+	}
+
+	if (self.hooks_ != nullptr && self.hooks_->end != nullptr)
+	{
+		self.hooks_->end(self.op_, self.hooks_->context);
+	}
+}
+}
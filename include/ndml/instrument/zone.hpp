@@ -0,0 +1,20 @@
+#ifndef NDML_INSTRUMENT_ZONE_HPP
+#define NDML_INSTRUMENT_ZONE_HPP
+
+/**
+ * @def NDML_INSTRUMENT_ZONE
+ *
+ * @brief Instruments the rest of the enclosing scope as a call to operation @p op of @c ndml::instrument::operation.
+ *
+ * This expands to a @c ndml::instrument::zone if @c NDML_INSTRUMENT is defined, and to nothing otherwise,
+ * so that uninstrumented builds neither include the instrumentation nor pay for it.
+ */
+#ifdef NDML_INSTRUMENT
+#	include "instrument.hpp"
+
+#	define NDML_INSTRUMENT_ZONE(op) ::ndml::instrument::zone const ndml_instrument_zone_{::ndml::instrument::operation::op}
+#else
+#	define NDML_INSTRUMENT_ZONE(op) static_cast<void>(0)
+#endif
+
+#endif
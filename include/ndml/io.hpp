@@ -0,0 +1,8 @@
+#ifndef NDML_IO_HPP
+#define NDML_IO_HPP
+
+#include "io/format.hpp"
+#include "io/mapped.hpp"
+#include "io/stream.hpp"
+
+#endif
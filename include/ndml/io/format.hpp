@@ -0,0 +1,170 @@
+#ifndef NDML_IO_FORMAT_HPP
+#define NDML_IO_FORMAT_HPP
+
+#include "ndml/math/precision.hpp"
+#include "ndml/mat/mat.hpp"
+#include "ndml/meta/layout.hpp"
+#include "ndml/quat/quat.hpp"
+#include "ndml/vec/vec.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <ios>
+#include <limits>
+#include <span>
+
+namespace ndml::io
+{
+namespace detail
+{
+/**
+ * @brief Kind and dimensions of values of type @p V, which are only defined for serializable types.
+ */
+template <typename V>
+struct description;
+
+/**
+ * @brief Element type code of elements of type @p T, which is only defined for serializable element types.
+ */
+template <typename T>
+struct scalar_of;
+}
+
+/**
+ * @brief Kind of values stored in a file.
+ */
+enum class kind : std::uint8_t
+{
+	vector     = 1,
+	matrix     = 2,
+	quaternion = 3,
+};
+
+/**
+ * @brief Element type of values stored in a file.
+ */
+enum class scalar : std::uint8_t
+{
+	int8     = 1,
+	int16    = 2,
+	int32    = 3,
+	int64    = 4,
+	uint8    = 5,
+	uint16   = 6,
+	uint32   = 7,
+	uint64   = 8,
+	float32  = 9,
+	float64  = 10,
+	float16  = 11,
+	bfloat16 = 12,
+};
+
+/**
+ * @brief Version of the format written, which is the only one read.
+ */
+inline constexpr std::uint16_t format_version = 1;
+
+/**
+ * @brief Size in bytes of the header, at which offset the values start.
+ *
+ * Values of a memory-mapped file are thus aligned to 64 bytes, which suffices for all of the supported types.
+ */
+inline constexpr std::size_t header_size = 64;
+
+/**
+ * @brief Header of a file of values.
+ *
+ * The header is encoded in @c header_size bytes as follows, multi-byte fields being in the byte order of the file:
+ * - bytes 0 to 3: magic number, the characters @c NDML;
+ * - byte 4: byte order, @c 0 for little-endian and @c 1 for big-endian;
+ * - byte 5: kind of values;
+ * - byte 6: element type;
+ * - byte 7: size of an element in bytes;
+ * - bytes 8 and 9: format version;
+ * - bytes 12 to 15: number of rows, i.e. of components of vectors and quaternions;
+ * - bytes 16 to 19: number of columns, which is one for vectors and quaternions;
+ * - bytes 24 to 31: number of values;
+ * - remaining bytes: zero.
+ *
+ * Values follow the header as arrays of their elements, matrices being stored in column-major order.
+ */
+struct header
+{
+	/// Byte order of the values.
+	std::endian byte_order = std::endian::native;
+
+	/// Kind of values.
+	io::kind kind{};
+
+	/// Element type.
+	io::scalar scalar{};
+
+	/// Number of rows.
+	std::uint32_t rows = 0;
+
+	/// Number of columns.
+	std::uint32_t columns = 0;
+
+	/// Number of values.
+	std::uint64_t count = 0;
+};
+
+/**
+ * @brief Whether values of type @p V can be stored in files.
+ *
+ * They are vectors, matrices, and quaternions of elements of fixed-width integer or floating-point types,
+ * including half-precision ones where supported, laid out as arrays thereof.
+ */
+template <typename V>
+concept serializable = requires {
+	{ detail::description<V>::kind } -> std::convertible_to<kind>;
+	{ detail::scalar_of<typename V::value_type>::value } -> std::convertible_to<scalar>;
+} && meta::array_layout<V, typename V::value_type, detail::description<V>::rows * detail::description<V>::columns>;
+
+/**
+ * @brief Header of a file of @p count values of type @p V in the native byte order.
+ */
+template <serializable V>
+[[nodiscard]]
+constexpr auto header_of(std::uint64_t count) noexcept -> header;
+
+/**
+ * @brief Whether values described by @p h are of type @p V.
+ *
+ * This compares the kind, dimensions, and element type, but not the byte order.
+ */
+template <serializable V>
+[[nodiscard]]
+constexpr auto describes(header const& h) noexcept -> bool;
+
+/**
+ * @brief Encodes @p h into bytes of the file header.
+ */
+[[nodiscard]]
+constexpr auto encode(header const& h) noexcept -> std::array<std::byte, header_size>;
+
+/**
+ * @brief Decodes bytes of the file header.
+ *
+ * @throws @c std::ios_base::failure when @p bytes do not start with the magic number, are of another format version,
+ *         or give an element size other than that of the element type
+ */
+[[nodiscard]]
+auto decode(std::span<std::byte const, header_size> bytes) -> header;
+
+/**
+ * @brief Checks that values described by @p h are of type @p V.
+ *
+ * @throws @c std::ios_base::failure when they are not
+ */
+template <serializable V>
+auto require(header const& h) -> void;
+}
+
+#include "format.inl"
+
+#endif
@@ -0,0 +1,273 @@
+namespace ndml::io
+{
+namespace detail
+{
+template <std::size_t N, typename T>
+struct description<vec<N, T>>
+{
+	static constexpr io::kind      kind    = io::kind::vector;
+	static constexpr std::uint32_t rows    = N;
+	static constexpr std::uint32_t columns = 1;
+};
+
+template <std::size_t R, std::size_t C, typename T>
+struct description<mat<R, C, T>>
+{
+	static constexpr io::kind      kind    = io::kind::matrix;
+	static constexpr std::uint32_t rows    = R;
+	static constexpr std::uint32_t columns = C;
+};
+
+template <typename T>
+struct description<quat<T>>
+{
+	static constexpr io::kind      kind    = io::kind::quaternion;
+	static constexpr std::uint32_t rows    = 4;
+	static constexpr std::uint32_t columns = 1;
+};
+
+/**
+ * @brief Size in bytes of an element of given type.
+ */
+constexpr auto size_of(scalar s) noexcept -> std::size_t
+{
+	switch (s)
+	{
+	case scalar::int8:
+	case scalar::uint8:
+		return 1;
+	case scalar::int16:
+	case scalar::uint16:
+	case scalar::float16:
+	case scalar::bfloat16:
+		return 2;
+	case scalar::int32:
+	case scalar::uint32:
+	case scalar::float32:
+		return 4;
+	default:
+		return 8;
+	}
+}
+
+/**
+ * @brief Element type code @p S of elements of type @p T.
+ */
+template <typename T, scalar S>
+struct scalar_code
+{
+	static_assert(sizeof(T) == size_of(S), "elements must be of the width of their type code");
+
+	static constexpr io::scalar value = S;
+};
+
+template <>
+struct scalar_of<std::int8_t> : scalar_code<std::int8_t, scalar::int8>
+{
+};
+
+template <>
+struct scalar_of<std::int16_t> : scalar_code<std::int16_t, scalar::int16>
+{
+};
+
+template <>
+struct scalar_of<std::int32_t> : scalar_code<std::int32_t, scalar::int32>
+{
+};
+
+template <>
+struct scalar_of<std::int64_t> : scalar_code<std::int64_t, scalar::int64>
+{
+};
+
+template <>
+struct scalar_of<std::uint8_t> : scalar_code<std::uint8_t, scalar::uint8>
+{
+};
+
+template <>
+struct scalar_of<std::uint16_t> : scalar_code<std::uint16_t, scalar::uint16>
+{
+};
+
+template <>
+struct scalar_of<std::uint32_t> : scalar_code<std::uint32_t, scalar::uint32>
+{
+};
+
+template <>
+struct scalar_of<std::uint64_t> : scalar_code<std::uint64_t, scalar::uint64>
+{
+};
+
+template <>
+struct scalar_of<float> : scalar_code<float, scalar::float32>
+{
+	static_assert(std::numeric_limits<float>::is_iec559, "single-precision elements must be IEEE 754 binary32");
+};
+
+template <>
+struct scalar_of<double> : scalar_code<double, scalar::float64>
+{
+	static_assert(std::numeric_limits<double>::is_iec559, "double-precision elements must be IEEE 754 binary64");
+};
+
+#if defined(__STDCPP_FLOAT16_T__)
+template <>
+struct scalar_of<std::float16_t> : scalar_code<std::float16_t, scalar::float16>
+{
+};
+#endif
+
+#if defined(__STDCPP_BFLOAT16_T__)
+template <>
+struct scalar_of<std::bfloat16_t> : scalar_code<std::bfloat16_t, scalar::bfloat16>
+{
+};
+#endif
+
+/**
+ * @brief Offsets of the fields of an encoded header.
+ */
+namespace offset
+{
+inline constexpr std::size_t byte_order   = 4;
+inline constexpr std::size_t kind         = 5;
+inline constexpr std::size_t scalar       = 6;
+inline constexpr std::size_t element_size = 7;
+inline constexpr std::size_t version      = 8;
+inline constexpr std::size_t rows         = 12;
+inline constexpr std::size_t columns      = 16;
+inline constexpr std::size_t count        = 24;
+}
+
+/**
+ * @brief Magic number at the start of an encoded header.
+ */
+inline constexpr std::array<std::byte, 4> magic{std::byte{'N'}, std::byte{'D'}, std::byte{'M'}, std::byte{'L'}};
+
+/**
+ * @brief Stores unsigned integer @p value to bytes at @p p in byte order @p order.
+ */
+template <std::unsigned_integral U>
+constexpr auto store(std::byte* p, U value, std::endian order) noexcept -> void
+{
+	for (std::size_t i = 0; i < sizeof(U); ++i)
+	{
+		auto const shift = order == std::endian::little ? i * 8 : (sizeof(U) - 1 - i) * 8;
+		p[i]             = static_cast<std::byte>(value >> shift);
+	}
+}
+
+/**
+ * @brief Loads an unsigned integer from bytes at @p p in byte order @p order.
+ */
+template <std::unsigned_integral U>
+constexpr auto load(std::byte const* p, std::endian order) noexcept -> U
+{
+	U value{0};
+	for (std::size_t i = 0; i < sizeof(U); ++i)
+	{
+		auto const shift = order == std::endian::little ? i * 8 : (sizeof(U) - 1 - i) * 8;
+		value |= static_cast<U>(static_cast<U>(p[i]) << shift);
+	}
+
+	return value;
+}
+
+/**
+ * @brief Throws @c std::ios_base::failure with @p what.
+ */
+[[noreturn]]
+inline auto fail(char const* what) -> void
+{
+	throw std::ios_base::failure(what);
+}
+}
+
+template <serializable V>
+constexpr auto header_of(std::uint64_t count) noexcept -> header
+{
+	return {
+		std::endian::native,
+		detail::description<V>::kind,
+		detail::scalar_of<typename V::value_type>::value,
+		detail::description<V>::rows,
+		detail::description<V>::columns,
+		count,
+	};
+}
+
+template <serializable V>
+constexpr auto describes(header const& h) noexcept -> bool
+{
+	auto const expected = header_of<V>(h.count);
+
+	return h.kind == expected.kind && h.scalar == expected.scalar && h.rows == expected.rows && h.columns == expected.columns;
+}
+
+constexpr auto encode(header const& h) noexcept -> std::array<std::byte, header_size>
+{
+	static_assert(std::endian::native == std::endian::little || std::endian::native == std::endian::big, "mixed byte order is not supported");
+
+	std::array<std::byte, header_size> bytes{};
+
+	std::ranges::copy(detail::magic, bytes.begin());
+
+	bytes[detail::offset::byte_order]   = std::byte{h.byte_order == std::endian::big};
+	bytes[detail::offset::kind]         = static_cast<std::byte>(h.kind);
+	bytes[detail::offset::scalar]       = static_cast<std::byte>(h.scalar);
+	bytes[detail::offset::element_size] = static_cast<std::byte>(detail::size_of(h.scalar));
+
+	detail::store(bytes.data() + detail::offset::version, format_version, h.byte_order);
+	detail::store(bytes.data() + detail::offset::rows, h.rows, h.byte_order);
+	detail::store(bytes.data() + detail::offset::columns, h.columns, h.byte_order);
+	detail::store(bytes.data() + detail::offset::count, h.count, h.byte_order);
+
+	return bytes;
+}
+
+inline auto decode(std::span<std::byte const, header_size> bytes) -> header
+{
+	if (!std::ranges::equal(bytes.first<4>(), detail::magic))
+	{
+		detail::fail("ndml: not a file of values, as its magic number is missing");
+	}
+
+	if (bytes[detail::offset::byte_order] > std::byte{1})
+	{
+		detail::fail("ndml: file of values of unknown byte order");
+	}
+
+	header h;
+	h.byte_order = bytes[detail::offset::byte_order] == std::byte{1} ? std::endian::big : std::endian::little;
+
+	if (detail::load<std::uint16_t>(bytes.data() + detail::offset::version, h.byte_order) != format_version)
+	{
+		detail::fail("ndml: file of values of unsupported format version");
+	}
+
+	h.kind    = static_cast<kind>(bytes[detail::offset::kind]);
+	h.scalar  = static_cast<scalar>(bytes[detail::offset::scalar]);
+	h.rows    = detail::load<std::uint32_t>(bytes.data() + detail::offset::rows, h.byte_order);
+	h.columns = detail::load<std::uint32_t>(bytes.data() + detail::offset::columns, h.byte_order);
+	h.count   = detail::load<std::uint64_t>(bytes.data() + detail::offset::count, h.byte_order);
+
+	if (static_cast<std::size_t>(bytes[detail::offset::element_size]) != detail::size_of(h.scalar))
+	{
+		detail::fail("ndml: file of values of an element size other than that of their type");
+	}
+
+	return h;
+}
+
+template <serializable V>
+auto require(header const& h) -> void
+{
+	if (!describes<V>(h))
+	{
+		detail::fail("ndml: file of values of another type than requested");
+	}
+}
+}
@@ -0,0 +1,168 @@
+#ifndef NDML_IO_MAPPED_HPP
+#define NDML_IO_MAPPED_HPP
+
+#include "format.hpp"
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <system_error>
+#include <utility>
+
+#if !defined(_WIN32)
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif
+
+#if defined(_WIN32)
+// declared as by the Windows headers, which are not included for the macros they define, e.g. min and max
+struct _SECURITY_ATTRIBUTES;
+#endif
+
+namespace ndml::io
+{
+namespace detail
+{
+#if defined(_WIN32)
+/**
+ * @brief Functions and constants of the Windows API used for file mappings.
+ */
+namespace win32
+{
+extern "C"
+{
+	__declspec(dllimport) auto __stdcall CreateFileW(wchar_t const* name, unsigned long access, unsigned long share, _SECURITY_ATTRIBUTES* security, unsigned long disposition, unsigned long attributes, void* template_file) -> void*;
+
+	__declspec(dllimport) auto __stdcall GetFileSize(void* file, unsigned long* high) -> unsigned long;
+
+	__declspec(dllimport) auto __stdcall CreateFileMappingW(void* file, _SECURITY_ATTRIBUTES* security, unsigned long protection, unsigned long size_high, unsigned long size_low, wchar_t const* name) -> void*;
+
+#	if defined(_WIN64)
+	__declspec(dllimport) auto __stdcall MapViewOfFile(void* mapping, unsigned long access, unsigned long offset_high, unsigned long offset_low, unsigned long long size) -> void*;
+#	else
+	__declspec(dllimport) auto __stdcall MapViewOfFile(void* mapping, unsigned long access, unsigned long offset_high, unsigned long offset_low, unsigned long size) -> void*;
+#	endif
+
+	__declspec(dllimport) auto __stdcall UnmapViewOfFile(void const* view) -> int;
+
+	__declspec(dllimport) auto __stdcall CloseHandle(void* object) -> int;
+
+	__declspec(dllimport) auto __stdcall GetLastError() -> unsigned long;
+}
+
+inline constexpr unsigned long generic_read          = 0x80000000;
+inline constexpr unsigned long file_share_read       = 0x00000001;
+inline constexpr unsigned long open_existing         = 3;
+inline constexpr unsigned long file_attribute_normal = 0x00000080;
+inline constexpr unsigned long page_readonly         = 0x00000002;
+inline constexpr unsigned long file_map_read         = 0x00000004;
+inline constexpr unsigned long invalid_file_size     = 0xffffffff;
+inline constexpr unsigned long no_error              = 0;
+
+/**
+ * @brief Whether @p handle is @c INVALID_HANDLE_VALUE.
+ */
+inline auto invalid_handle(void* handle) noexcept -> bool
+{
+	return reinterpret_cast<std::intptr_t>(handle) == -1;
+}
+}
+#endif
+
+/**
+ * @brief Read-only mapping of a whole file into memory.
+ *
+ * It is implemented with @c mmap on POSIX systems, and with @c MapViewOfFile on Windows.
+ */
+struct file_mapping
+{
+	/**
+	 * @brief Constructor from a file path.
+	 *
+	 * @throws @c std::system_error when the file cannot be opened or mapped
+	 */
+	explicit file_mapping(std::filesystem::path const& path);
+
+	file_mapping(file_mapping&& other) noexcept;
+
+	auto operator=(file_mapping&& other) noexcept -> file_mapping&;
+
+	/**
+	 * @brief Destructor.
+	 *
+	 * This unmaps the file.
+	 */
+	~file_mapping();
+
+	/**
+	 * @brief Bytes of the file.
+	 */
+	[[nodiscard]]
+	auto bytes(this file_mapping const& self) noexcept -> std::span<std::byte const>;
+
+private:
+	/**
+	 * @brief Unmaps the file, if mapped.
+	 */
+	auto unmap(this file_mapping& self) noexcept -> void;
+
+	/// First byte of the mapping, or null if there is none, as is the case for empty files.
+	std::byte const* data_ = nullptr;
+
+	/// Size of the mapping in bytes.
+	std::size_t size_ = 0;
+};
+}
+
+/**
+ * @brief Values of type @p V of a file mapped into memory.
+ *
+ * The values are accessed in place, without being copied nor converted, and pages of the file are only loaded as they are accessed,
+ * so that large files are opened in constant time. The file must be in the native byte order, and must not be modified while it is mapped.
+ *
+ * @tparam V vector, matrix, or quaternion type of the values
+ */
+template <serializable V>
+struct mapped
+{
+	static_assert(alignof(V) <= header_size, "values must be aligned by the header of the file");
+
+	/**
+	 * @brief Constructor from a file path.
+	 *
+	 * @throws @c std::system_error when the file cannot be opened or mapped
+	 * @throws @c std::ios_base::failure when the file is not valid, describes values of another type,
+	 *         is in the foreign byte order, or is shorter than the number of values of its header
+	 */
+	explicit mapped(std::filesystem::path const& path);
+
+	/**
+	 * @brief Header of the file.
+	 */
+	[[nodiscard]]
+	auto description(this mapped const& self) noexcept -> header const&;
+
+	/**
+	 * @brief Values of the file.
+	 *
+	 * They are valid as long as the mapping.
+	 */
+	[[nodiscard]]
+	auto values(this mapped const& self) noexcept -> std::span<V const>;
+
+private:
+	/// Mapping of the file.
+	detail::file_mapping file_;
+
+	/// Header of the file.
+	header header_;
+};
+}
+
+#include "mapped.inl"
+
+#endif
@@ -0,0 +1,186 @@
+namespace ndml::io
+{
+namespace detail
+{
+#if defined(_WIN32)
+inline file_mapping::file_mapping(std::filesystem::path const& path)
+{
+	auto const file = win32::CreateFileW(path.c_str(), win32::generic_read, win32::file_share_read, nullptr, win32::open_existing, win32::file_attribute_normal, nullptr);
+
+	if (win32::invalid_handle(file))
+	{
+		throw std::system_error(static_cast<int>(win32::GetLastError()), std::system_category(), "ndml: file of values cannot be opened");
+	}
+
+	unsigned long high = 0;
+	auto const low     = win32::GetFileSize(file, &high);
+
+	if (low == win32::invalid_file_size)
+	{
+		// the maximum low half of sizes is also reported this way, but then without an error
+		if (auto const error = win32::GetLastError(); error != win32::no_error)
+		{
+			win32::CloseHandle(file);
+			throw std::system_error(static_cast<int>(error), std::system_category(), "ndml: file of values cannot be opened");
+		}
+	}
+
+	auto const size = (static_cast<std::uint64_t>(high) << 32) | low;
+
+	// empty files cannot be mapped, and are left without a mapping
+	if (size > 0)
+	{
+		auto const mapping = win32::CreateFileMappingW(file, nullptr, win32::page_readonly, 0, 0, nullptr);
+		auto const error   = win32::GetLastError();
+		win32::CloseHandle(file);
+
+		if (mapping == nullptr)
+		{
+			throw std::system_error(static_cast<int>(error), std::system_category(), "ndml: file of values cannot be mapped");
+		}
+
+		auto const view = win32::MapViewOfFile(mapping, win32::file_map_read, 0, 0, 0);
+		auto const view_error = win32::GetLastError();
+		win32::CloseHandle(mapping);
+
+		if (view == nullptr)
+		{
+			throw std::system_error(static_cast<int>(view_error), std::system_category(), "ndml: file of values cannot be mapped");
+		}
+
+		data_ = static_cast<std::byte const*>(view);
+		size_ = static_cast<std::size_t>(size);
+	}
+	else
+	{
+		win32::CloseHandle(file);
+	}
+}
+
+inline auto file_mapping::unmap(this file_mapping& self) noexcept -> void
+{
+	if (self.data_ != nullptr)
+	{
+		win32::UnmapViewOfFile(self.data_);
+	}
+}
+#else
+inline file_mapping::file_mapping(std::filesystem::path const& path)
+{
+	auto const fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+	if (fd == -1)
+	{
+		throw std::system_error(errno, std::system_category(), "ndml: file of values cannot be opened");
+	}
+
+	struct stat status;
+
+	if (::fstat(fd, &status) == -1)
+	{
+		auto const error = errno;
+		::close(fd);
+		throw std::system_error(error, std::system_category(), "ndml: file of values cannot be opened");
+	}
+
+	// empty files cannot be mapped, and are left without a mapping
+	if (status.st_size > 0)
+	{
+		auto const size = static_cast<std::size_t>(status.st_size);
+		auto* const p   = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+		auto const error = errno;
+		::close(fd);
+
+		if (p == MAP_FAILED)
+		{
+			throw std::system_error(error, std::system_category(), "ndml: file of values cannot be mapped");
+		}
+
+		data_ = static_cast<std::byte const*>(p);
+		size_ = size;
+	}
+	else
+	{
+		::close(fd);
+	}
+}
+
+inline auto file_mapping::unmap(this file_mapping& self) noexcept -> void
+{
+	if (self.data_ != nullptr)
+	{
+		::munmap(const_cast<std::byte*>(self.data_), self.size_);
+	}
+}
+#endif
+
+inline file_mapping::file_mapping(file_mapping&& other) noexcept
+	: data_{std::exchange(other.data_, nullptr)}, size_{std::exchange(other.size_, 0)}
+{
+}
+
+inline auto file_mapping::operator=(file_mapping&& other) noexcept -> file_mapping&
+{
+	if (this != &other)
+	{
+		unmap();
+		data_ = std::exchange(other.data_, nullptr);
+		size_ = std::exchange(other.size_, 0);
+	}
+
+	return *this;
+}
+
+inline file_mapping::~file_mapping()
+{
+	unmap();
+}
+
+inline auto file_mapping::bytes(this file_mapping const& self) noexcept -> std::span<std::byte const>
+{
+	return {self.data_, self.size_};
+}
+}
+
+template <serializable V>
+mapped<V>::mapped(std::filesystem::path const& path) : file_{path}
+{
+	auto const bytes = file_.bytes();
+
+	if (bytes.size() < header_size)
+	{
+		detail::fail("ndml: file of values ends within its header");
+	}
+
+	header_ = decode(bytes.first<header_size>());
+	require<V>(header_);
+
+	if (header_.byte_order != std::endian::native)
+	{
+		detail::fail("ndml: file of values in the foreign byte order cannot be mapped, but only read from a stream");
+	}
+
+	if ((bytes.size() - header_size) / sizeof(V) < header_.count)
+	{
+		detail::fail("ndml: file of values ends before its last value");
+	}
+}
+
+template <serializable V>
+auto mapped<V>::description(this mapped const& self) noexcept -> header const&
+{
+	return self.header_;
+}
+
+template <serializable V>
+auto mapped<V>::values(this mapped const& self) noexcept -> std::span<V const>
+{
+	if (self.header_.count == 0)
+	{
+		return {};
+	}
+
+	// values are trivially copyable arrays of elements, the bytes of which the mapping provides as-is
+	return {reinterpret_cast<V const*>(self.file_.bytes().data() + header_size), static_cast<std::size_t>(self.header_.count)};
+}
+}
@@ -0,0 +1,164 @@
+#ifndef NDML_IO_STREAM_HPP
+#define NDML_IO_STREAM_HPP
+
+#include "format.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ios>
+#include <istream>
+#include <ostream>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace ndml::io
+{
+/**
+ * @brief Reader of values of type @p V from a binary stream.
+ *
+ * The header is read and checked on construction, and values are then read in batches of any size.
+ * Values of files in the foreign byte order are converted to the native one as they are read.
+ *
+ * @tparam V vector, matrix, or quaternion type of the values
+ */
+template <serializable V>
+struct reader
+{
+	/**
+	 * @brief Constructor from an input stream.
+	 *
+	 * This reads the header from @p in, which must outlive the reader and is expected to have been opened in binary mode.
+	 *
+	 * @throws @c std::ios_base::failure when the header cannot be read, is not valid, or describes values of another type
+	 */
+	explicit reader(std::istream& in);
+
+	reader(reader const&) = delete;
+
+	auto operator=(reader const&) -> reader& = delete;
+
+	/**
+	 * @brief Header of the file.
+	 */
+	[[nodiscard]]
+	auto description(this reader const& self) noexcept -> header const&;
+
+	/**
+	 * @brief Number of values not read yet.
+	 */
+	[[nodiscard]]
+	auto remaining(this reader const& self) noexcept -> std::uint64_t;
+
+	/**
+	 * @brief Reads values into @p out.
+	 *
+	 * @return the leading part of @p out read into, which is shorter than @p out only if fewer values remain
+	 *
+	 * @throws @c std::ios_base::failure when the stream ends before the number of values of the header
+	 */
+	auto read(this reader& self, std::span<V> out) -> std::span<V>;
+
+private:
+	/// Input stream.
+	std::istream* in_;
+
+	/// Header of the file.
+	header header_;
+
+	/// Number of values not read yet.
+	std::uint64_t remaining_;
+};
+
+/**
+ * @brief Writer of values of type @p V to a binary stream.
+ *
+ * A header of no values is written on construction, values are then appended in batches of any size,
+ * and the number of values of the header is updated on @c finish, so that the total need not be known in advance.
+ * Values are written in the native byte order.
+ *
+ * @tparam V vector, matrix, or quaternion type of the values
+ */
+template <serializable V>
+struct writer
+{
+	/**
+	 * @brief Constructor from an output stream.
+	 *
+	 * This writes the header to @p out, which must outlive the writer, be seekable, and is expected to have been opened in binary mode.
+	 *
+	 * @throws @c std::ios_base::failure when the header cannot be written
+	 */
+	explicit writer(std::ostream& out);
+
+	writer(writer const&) = delete;
+
+	auto operator=(writer const&) -> writer& = delete;
+
+	/**
+	 * @brief Destructor.
+	 *
+	 * This finishes the file unless already done, ignoring errors, which are only reported by calling @c finish.
+	 */
+	~writer();
+
+	/**
+	 * @brief Number of values written so far.
+	 */
+	[[nodiscard]]
+	auto count(this writer const& self) noexcept -> std::uint64_t;
+
+	/**
+	 * @brief Appends @p values.
+	 *
+	 * @throws @c std::ios_base::failure when the values cannot be written, or the file has been finished
+	 */
+	auto write(this writer& self, std::span<V const> values) -> void;
+
+	/**
+	 * @brief Finishes the file, updating the number of values of its header.
+	 *
+	 * This seeks back to the header and then to the end of the values, so that @p out is left where the file ends.
+	 * Calling it again does nothing.
+	 *
+	 * @throws @c std::ios_base::failure when the header cannot be updated
+	 */
+	auto finish(this writer& self) -> void;
+
+private:
+	/// Output stream.
+	std::ostream* out_;
+
+	/// Position of the header in the stream.
+	std::ostream::pos_type start_;
+
+	/// Number of values written so far.
+	std::uint64_t count_ = 0;
+
+	/// Whether the file has been finished.
+	bool finished_ = false;
+};
+
+/**
+ * @brief Writes a file of @p values to @p out.
+ *
+ * @throws @c std::ios_base::failure when the file cannot be written
+ */
+template <serializable V>
+auto write(std::ostream& out, std::type_identity_t<std::span<V const>> values) -> void;
+
+/**
+ * @brief Reads all of the values of a file from @p in.
+ *
+ * @throws @c std::ios_base::failure when the file cannot be read, is not valid, or describes values of another type
+ */
+template <serializable V>
+[[nodiscard]]
+auto read(std::istream& in) -> std::vector<V>;
+}
+
+#include "stream.inl"
+
+#endif
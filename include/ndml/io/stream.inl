@@ -0,0 +1,168 @@
+namespace ndml::io
+{
+namespace detail
+{
+/**
+ * @brief Reverses the byte order of each of the elements of @p element_size bytes of @p bytes.
+ */
+inline auto swap_bytes(std::span<std::byte> bytes, std::size_t element_size) noexcept -> void
+{
+	if (element_size == 1)
+	{
+		return;
+	}
+
+	for (auto* p = bytes.data(); p != bytes.data() + bytes.size(); p += element_size)
+	{
+		std::ranges::reverse(p, p + element_size);
+	}
+}
+}
+
+template <serializable V>
+reader<V>::reader(std::istream& in) : in_{&in}
+{
+	std::array<std::byte, header_size> bytes;
+
+	if (!in.read(reinterpret_cast<char*>(bytes.data()), header_size))
+	{
+		detail::fail("ndml: file of values ends within its header");
+	}
+
+	header_ = decode(bytes);
+	require<V>(header_);
+	remaining_ = header_.count;
+}
+
+template <serializable V>
+auto reader<V>::description(this reader const& self) noexcept -> header const&
+{
+	return self.header_;
+}
+
+template <serializable V>
+auto reader<V>::remaining(this reader const& self) noexcept -> std::uint64_t
+{
+	return self.remaining_;
+}
+
+template <serializable V>
+auto reader<V>::read(this reader& self, std::span<V> out) -> std::span<V>
+{
+	out = out.first(static_cast<std::size_t>(std::min<std::uint64_t>(out.size(), self.remaining_)));
+
+	auto const bytes = std::as_writable_bytes(out);
+
+	if (!self.in_->read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(bytes.size())))
+	{
+		detail::fail("ndml: file of values ends before its last value");
+	}
+
+	if (self.header_.byte_order != std::endian::native)
+	{
+		detail::swap_bytes(bytes, sizeof(typename V::value_type));
+	}
+
+	self.remaining_ -= out.size();
+
+	return out;
+}
+
+template <serializable V>
+writer<V>::writer(std::ostream& out) : out_{&out}, start_{out.tellp()}
+{
+	if (start_ == std::ostream::pos_type(-1))
+	{
+		detail::fail("ndml: file of values cannot be written to a stream which is not seekable");
+	}
+
+	auto const bytes = encode(header_of<V>(0));
+
+	if (!out.write(reinterpret_cast<char const*>(bytes.data()), header_size))
+	{
+		detail::fail("ndml: header of file of values cannot be written");
+	}
+}
+
+template <serializable V>
+writer<V>::~writer()
+{
+	try
+	{
+		finish();
+	}
+	catch (...)
+	{
+	}
+}
+
+template <serializable V>
+auto writer<V>::count(this writer const& self) noexcept -> std::uint64_t
+{
+	return self.count_;
+}
+
+template <serializable V>
+auto writer<V>::write(this writer& self, std::span<V const> values) -> void
+{
+	if (self.finished_)
+	{
+		detail::fail("ndml: values cannot be written to a finished file");
+	}
+
+	auto const bytes = std::as_bytes(values);
+
+	if (!self.out_->write(reinterpret_cast<char const*>(bytes.data()), static_cast<std::streamsize>(bytes.size())))
+	{
+		detail::fail("ndml: values of file of values cannot be written");
+	}
+
+	self.count_ += values.size();
+}
+
+template <serializable V>
+auto writer<V>::finish(this writer& self) -> void
+{
+	if (self.finished_)
+	{
+		return;
+	}
+
+	self.finished_ = true;
+
+	auto const end   = self.out_->tellp();
+	auto const bytes = encode(header_of<V>(self.count_));
+
+	if (!self.out_->seekp(self.start_) || !self.out_->write(reinterpret_cast<char const*>(bytes.data()), header_size) || !self.out_->seekp(end))
+	{
+		detail::fail("ndml: header of file of values cannot be updated");
+	}
+}
+
+template <serializable V>
+auto write(std::ostream& out, std::type_identity_t<std::span<V const>> values) -> void
+{
+	writer<V> w{out};
+	w.write(values);
+	w.finish();
+}
+
+template <serializable V>
+auto read(std::istream& in) -> std::vector<V>
+{
+	// values are read in chunks rather than all at once, so that a corrupt count fails on reading rather than on allocation
+	constexpr std::size_t chunk = (std::size_t{1} << 20) / sizeof(V);
+
+	reader<V>      r{in};
+	std::vector<V> values;
+
+	while (r.remaining() > 0)
+	{
+		auto const size = values.size();
+		values.resize(size + static_cast<std::size_t>(std::min<std::uint64_t>(r.remaining(), chunk)));
+		r.read(std::span{values}.subspan(size));
+	}
+
+	return values;
+}
+}
@@ -3,6 +3,12 @@
 
 #include "mat/mat.hpp"
 #include "mat/operation.hpp"
+#include "mat/lu.hpp"
+#include "mat/cholesky.hpp"
+#include "mat/eigen.hpp"
+#include "mat/sym.hpp"
+#include "mat/tri.hpp"
 #include "mat/transform.hpp"
+#include "mat/view.hpp"
 
 #endif
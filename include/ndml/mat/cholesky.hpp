@@ -0,0 +1,112 @@
+#ifndef NDML_MAT_CHOLESKY_HPP
+#define NDML_MAT_CHOLESKY_HPP
+
+#include "sym.hpp"
+#include "tri.hpp"
+
+#include <array>
+#include <cstddef>
+
+namespace ndml
+{
+/**
+ * @brief Cholesky decomposition of a symmetric positive-definite matrix.
+ *
+ * This factorizes a matrix @f$ S @f$ into @f$ S = L L^T @f$, where @f$ L @f$ is a lower triangular matrix with a positive diagonal.
+ * It requires neither pivoting nor the lower triangle of @f$ S @f$, and takes about half of the operations of an LU decomposition,
+ * e.g. for solving the normal equations of a least-squares problem or the innovation of a Kalman filter.
+ *
+ * The factorization is calculated once in @f$ O(N^3) @f$, after which every system @f$ S x = b @f$
+ * is solved by forward and backward substitution in @f$ O(N^2) @f$.
+ *
+ * @tparam N number of rows and columns
+ * @tparam T element type
+ *
+ * @sa ndml::lu
+ */
+template <std::size_t N, typename T>
+struct cholesky
+{
+	using sym_mat_type = sym_mat<N, T>;
+	using factor_type  = lower_mat<N, T>;
+	using vec_type     = vec<N, T>;
+	using value_type   = T;
+
+	/**
+	 * @brief Constructor from a symmetric matrix.
+	 *
+	 * This factorizes @p s. If a pivot is not positive, it and the elements of @f$ L @f$ below it are zero.
+	 */
+	constexpr explicit cholesky(sym_mat<N, T> const& s) noexcept;
+
+	/**
+	 * @brief Whether the factorized matrix is positive-definite.
+	 *
+	 * This returns @c false if any of the pivots is not positive, in which case the factorization is incomplete.
+	 */
+	[[nodiscard]]
+	constexpr auto positive_definite(this auto const& self) noexcept -> bool;
+
+	/**
+	 * @brief Factor @f$ L @f$ of the decomposition.
+	 */
+	[[nodiscard]]
+	constexpr auto factor(this auto const& self) noexcept -> factor_type const&;
+
+	/**
+	 * @brief The determinant of the factorized matrix.
+	 *
+	 * This calculates the square of the product of the diagonal of @f$ L @f$.
+	 */
+	[[nodiscard]]
+	constexpr auto determinant(this auto const& self) noexcept -> value_type;
+
+	/**
+	 * @brief The inverse of the factorized matrix.
+	 *
+	 * This calculates @f$ L^{-T} L^{-1} @f$, which is symmetric.
+	 *
+	 * @warning Behavior is undefined if the factorized matrix is not positive-definite.
+	 */
+	[[nodiscard]]
+	constexpr auto inverse(this auto const& self) noexcept -> sym_mat_type;
+
+	/**
+	 * @brief Solution of a system of linear equations.
+	 *
+	 * This calculates @f$ x @f$ such that @f$ S x = b @f$ by solving @f$ L y = b @f$ and then @f$ L^T x = y @f$.
+	 *
+	 * @warning Behavior is undefined if the factorized matrix is not positive-definite.
+	 */
+	[[nodiscard]]
+	constexpr auto solve(this auto const& self, vec<N, T> const& b) noexcept -> vec_type;
+
+	/**
+	 * @brief Solution of a system of linear equations with multiple right-hand sides.
+	 *
+	 * This calculates @f$ X @f$ such that @f$ S X = B @f$, solving for each column of @p b.
+	 *
+	 * @warning Behavior is undefined if the factorized matrix is not positive-definite.
+	 */
+	template <std::size_t K>
+	[[nodiscard]]
+	constexpr auto solve(this auto const& self, mat<N, K, T> const& b) noexcept -> mat<N, K, T>;
+
+protected:
+	/// Factor @f$ L @f$.
+	factor_type factor_{};
+
+	/// Reciprocals of the diagonal of @f$ L @f$, by which substitutions multiply.
+	std::array<value_type, N> inverse_diagonal_{};
+
+	/// Whether all of the pivots are positive.
+	bool positive_definite_ = true;
+};
+
+template <std::size_t N, typename T>
+cholesky(sym_mat<N, T> const&) -> cholesky<N, T>;
+}
+
+#include "cholesky.inl"
+
+#endif
@@ -0,0 +1,112 @@
+#include "ndml/instrument/zone.hpp"
+#include "ndml/math/function.hpp"
+#include "ndml/math/precision.hpp"
+#include "ndml/meta/unroll.hpp"
+
+namespace ndml
+{
+template <std::size_t N, typename T>
+constexpr cholesky<N, T>::cholesky(sym_mat<N, T> const& s) noexcept
+{
+	NDML_INSTRUMENT_ZONE(cholesky);
+
+	auto& l = factor_;
+	auto& d = inverse_diagonal_;
+
+	// L_ij = (S_ij - sum_{k<j} L_ik L_jk) / L_jj for j < i, and L_ii = sqrt(S_ii - sum_{k<i} L_ik^2);
+	// once a pivot is not positive, its reciprocal is left zero, so that the remaining elements are zero rather than undefined
+	auto const element = [&s, &l, &d, this]<std::size_t I, std::size_t J>(meta::index_constant<I>, meta::index_constant<J>) {
+		auto const sum = s[J, I] - meta::unroll<J>([&l](auto... k) { return (T{0} + ... + (l[k, I] * l[k, J])); });
+
+		if constexpr (J < I)
+		{
+			l[J, I] = sum * d[J];
+		}
+		else if (sum > T{0})
+		{
+			l[I, I] = math::sqrt(sum, math::precise);
+			d[I]    = T{1} / l[I, I];
+		}
+		else
+		{
+			positive_definite_ = false;
+		}
+	};
+
+	// rows of L are calculated in order, as they are stored
+	meta::unroll<N>([&element](auto... i) { (meta::unroll<decltype(i)::value + 1>([&element, i](auto... j) { (element(i, j), ...); }), ...); });
+}
+
+template <std::size_t N, typename T>
+constexpr auto cholesky<N, T>::positive_definite(this auto const& self) noexcept -> bool
+{
+	return self.positive_definite_;
+}
+
+template <std::size_t N, typename T>
+constexpr auto cholesky<N, T>::factor(this auto const& self) noexcept -> factor_type const&
+{
+	return self.factor_;
+}
+
+template <std::size_t N, typename T>
+constexpr auto cholesky<N, T>::determinant(this auto const& self) noexcept -> value_type
+{
+	auto const det = ndml::determinant(self.factor_);
+
+	return det * det;
+}
+
+template <std::size_t N, typename T>
+constexpr auto cholesky<N, T>::inverse(this auto const& self) noexcept -> sym_mat_type
+{
+	return gram(ndml::solve(self.factor_, mat<N, N, T>{1}));
+}
+
+template <std::size_t N, typename T>
+constexpr auto cholesky<N, T>::solve(this auto const& self, vec<N, T> const& b) noexcept -> vec_type
+{
+	using accumulator_type = math::accumulator_t<T>;
+
+	auto const& l = self.factor_;
+	auto const& d = self.inverse_diagonal_;
+
+	auto x = meta::unroll<N>([&b](auto... i) { return std::array<accumulator_type, N>{static_cast<accumulator_type>(get<i>(b))...}; });
+
+	// forward substitution by rows of L, then backward substitution by columns of L, i.e. by rows of its transpose,
+	// multiplying by the reciprocals of the pivots rather than dividing by the pivots
+	auto const forward = [&l, &d, &x]<std::size_t I>(meta::index_constant<I>) {
+		auto const sum = meta::unroll<I>([&l, &x](auto... j) { return (accumulator_type{0} + ... + (static_cast<accumulator_type>(l[j, I]) * x[j])); });
+
+		x[I] = (x[I] - sum) * static_cast<accumulator_type>(d[I]);
+	};
+
+	auto const backward = [&l, &d, &x]<std::size_t K>(meta::index_constant<K>) {
+		constexpr auto i = N - 1 - K;
+
+		auto const sum = meta::unroll<K>([&l, &x](auto... k) {
+			return (accumulator_type{0} + ... + (static_cast<accumulator_type>(l[i, i + 1 + k]) * x[i + 1 + k]));
+		});
+
+		x[i] = (x[i] - sum) * static_cast<accumulator_type>(d[i]);
+	};
+
+	meta::unroll<N>([&forward](auto... i) { (forward(i), ...); });
+	meta::unroll<N>([&backward](auto... k) { (backward(k), ...); });
+
+	return meta::unroll<N>([&x](auto... i) { return vec_type{static_cast<T>(x[i])...}; });
+}
+
+template <std::size_t N, typename T>
+template <std::size_t K>
+constexpr auto cholesky<N, T>::solve(this auto const& self, mat<N, K, T> const& b) noexcept -> mat<N, K, T>
+{
+	mat<N, K, T> x;
+	for (std::size_t j = 0; j < K; ++j)
+	{
+		x[j] = self.solve(b[j]);
+	}
+
+	return x;
+}
+}
@@ -0,0 +1,73 @@
+#ifndef NDML_MAT_EIGEN_HPP
+#define NDML_MAT_EIGEN_HPP
+
+#include "sym.hpp"
+
+#include <concepts>
+#include <cstddef>
+
+namespace ndml
+{
+/**
+ * @brief Eigendecomposition of a symmetric matrix.
+ *
+ * This factorizes a matrix @f$ S @f$ into @f$ S = V \Lambda V^T @f$, where @f$ \Lambda @f$ is the diagonal matrix of eigenvalues,
+ * and @f$ V @f$ is the orthogonal matrix of the corresponding eigenvectors, e.g. for principal axes of inertia or covariance.
+ *
+ * The decomposition is calculated by the cyclic Jacobi method, which annihilates each off-diagonal element in turn by a plane rotation,
+ * sweeping over all of them until their sum of squares is negligible relative to the matrix, which takes a few sweeps
+ * as convergence is quadratic. Eigenvalues are calculated to high relative accuracy, and eigenvectors are orthogonal to working precision.
+ *
+ * @tparam N number of rows and columns
+ * @tparam T floating-point element type
+ */
+template <std::size_t N, std::floating_point T>
+struct eigen
+{
+	using mat_type   = mat<N, N, T>;
+	using vec_type   = vec<N, T>;
+	using value_type = T;
+
+	/**
+	 * @brief Maximum number of sweeps.
+	 *
+	 * It is only reached for matrices of non-finite elements, others converging in far fewer.
+	 */
+	static constexpr std::size_t max_sweeps = 32;
+
+	/**
+	 * @brief Constructor from a symmetric matrix.
+	 *
+	 * This decomposes @p s.
+	 */
+	constexpr explicit eigen(sym_mat<N, T> const& s) noexcept;
+
+	/**
+	 * @brief Eigenvalues, in ascending order.
+	 */
+	[[nodiscard]]
+	constexpr auto values(this auto const& self) noexcept -> vec_type const&;
+
+	/**
+	 * @brief Eigenvectors.
+	 *
+	 * Column @c i is the unit eigenvector of eigenvalue @c values()[i].
+	 */
+	[[nodiscard]]
+	constexpr auto vectors(this auto const& self) noexcept -> mat_type const&;
+
+protected:
+	/// Eigenvalues.
+	vec_type values_{};
+
+	/// Eigenvectors, stored as columns.
+	mat_type vectors_{1};
+};
+
+template <std::size_t N, typename T>
+eigen(sym_mat<N, T> const&) -> eigen<N, T>;
+}
+
+#include "eigen.inl"
+
+#endif
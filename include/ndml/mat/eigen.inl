@@ -0,0 +1,128 @@
+#include "ndml/instrument/zone.hpp"
+#include "ndml/math/function.hpp"
+
+#include <limits>
+#include <utility>
+
+namespace ndml
+{
+template <std::size_t N, std::floating_point T>
+constexpr eigen<N, T>::eigen(sym_mat<N, T> const& s) noexcept
+{
+	NDML_INSTRUMENT_ZONE(eigen);
+
+	auto  a = static_cast<mat_type>(s);
+	auto& v = vectors_;
+
+	// sum of squares of all elements, which rotations preserve
+	T total{0};
+	for (std::size_t k = 0; k < s.element_count; ++k)
+	{
+		total += s.data()[k] * s.data()[k];
+	}
+
+	constexpr auto epsilon = std::numeric_limits<T>::epsilon();
+
+	for (std::size_t sweep = 0; sweep < max_sweeps; ++sweep)
+	{
+		T off{0};
+		for (std::size_t q = 1; q < N; ++q)
+		{
+			for (std::size_t p = 0; p < q; ++p)
+			{
+				off += a[q, p] * a[q, p];
+			}
+		}
+
+		if (!(off > epsilon * epsilon * total))
+		{
+			break;
+		}
+
+		for (std::size_t q = 1; q < N; ++q)
+		{
+			for (std::size_t p = 0; p < q; ++p)
+			{
+				auto const apq = a[q, p];
+
+				if (apq == T{0})
+				{
+					continue;
+				}
+
+				// rotation by the smaller angle annihilating a_pq, with t = tan(angle)
+				auto const theta = (a[q, q] - a[p, p]) / (2 * apq);
+				auto       t     = T{1} / (detail::abs(theta) + math::sqrt(theta * theta + T{1}, math::precise));
+				if (theta < T{0})
+				{
+					t = -t;
+				}
+
+				auto const c = T{1} / math::sqrt(t * t + T{1}, math::precise);
+				auto const u = t * c;
+
+				a[p, p] -= t * apq;
+				a[q, q] += t * apq;
+				a[q, p] = T{0};
+				a[p, q] = T{0};
+
+				for (std::size_t r = 0; r < N; ++r)
+				{
+					if (r != p && r != q)
+					{
+						auto const arp = a[p, r];
+						auto const arq = a[q, r];
+
+						a[p, r] = a[r, p] = c * arp - u * arq;
+						a[q, r] = a[r, q] = u * arp + c * arq;
+					}
+
+					auto const vrp = v[p, r];
+					auto const vrq = v[q, r];
+
+					v[p, r] = c * vrp - u * vrq;
+					v[q, r] = u * vrp + c * vrq;
+				}
+			}
+		}
+	}
+
+	for (std::size_t i = 0; i < N; ++i)
+	{
+		values_[i] = a[i, i];
+	}
+
+	// selection sort, as there are few eigenvalues, each swapped with its eigenvector at most once
+	for (std::size_t i = 0; i + 1 < N; ++i)
+	{
+		auto min = i;
+		for (std::size_t j = i + 1; j < N; ++j)
+		{
+			if (values_[j] < values_[min])
+			{
+				min = j;
+			}
+		}
+
+		if (min != i)
+		{
+			using std::swap;
+
+			swap(values_[i], values_[min]);
+			swap(v[i], v[min]);
+		}
+	}
+}
+
+template <std::size_t N, std::floating_point T>
+constexpr auto eigen<N, T>::values(this auto const& self) noexcept -> vec_type const&
+{
+	return self.values_;
+}
+
+template <std::size_t N, std::floating_point T>
+constexpr auto eigen<N, T>::vectors(this auto const& self) noexcept -> mat_type const&
+{
+	return self.vectors_;
+}
+}
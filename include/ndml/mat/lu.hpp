@@ -0,0 +1,123 @@
+#ifndef NDML_MAT_LU_HPP
+#define NDML_MAT_LU_HPP
+
+#include "mat.hpp"
+
+#include <array>
+#include <cstddef>
+
+namespace ndml
+{
+/**
+ * @brief LU decomposition of a square matrix with partial pivoting.
+ *
+ * This factorizes a matrix @f$ A @f$ into @f$ P A = L U @f$, where @f$ P @f$ is a row permutation,
+ * @f$ L @f$ is a unit lower triangular matrix, and @f$ U @f$ is an upper triangular matrix.
+ * At each step, the row with the greatest absolute value in the current column is chosen as the pivot.
+ *
+ * The factorization is calculated once in @f$ O(N^3) @f$, after which every system @f$ A x = b @f$
+ * is solved in @f$ O(N^2) @f$.
+ *
+ * @tparam N number of rows and columns
+ * @tparam T element type
+ */
+template <std::size_t N, typename T>
+struct lu
+{
+	using mat_type         = mat<N, N, T>;
+	using vec_type         = vec<N, T>;
+	using value_type       = T;
+	using permutation_type = std::array<std::size_t, N>;
+
+	/**
+	 * @brief Constructor from a matrix.
+	 *
+	 * This factorizes @p m.
+	 */
+	constexpr explicit lu(mat<N, N, T> const& m) noexcept;
+
+	/**
+	 * @brief Whether the factorized matrix is singular.
+	 *
+	 * This returns @c true if any of the pivots is zero.
+	 */
+	[[nodiscard]]
+	constexpr auto singular(this auto const& self) noexcept -> bool;
+
+	/**
+	 * @brief Factors of the decomposition.
+	 *
+	 * This returns a matrix with @f$ U @f$ on and above the main diagonal,
+	 * and @f$ L @f$ without its unit diagonal below the main diagonal.
+	 */
+	[[nodiscard]]
+	constexpr auto factors(this auto const& self) noexcept -> mat_type;
+
+	/**
+	 * @brief Row permutation of the decomposition.
+	 *
+	 * Row @c i of @f$ P A @f$ is row @c permutation()[i] of @f$ A @f$.
+	 */
+	[[nodiscard]]
+	constexpr auto permutation(this auto const& self) noexcept -> permutation_type const&;
+
+	/**
+	 * @brief The determinant of the factorized matrix.
+	 *
+	 * This calculates the product of the diagonal of @f$ U @f$, negated for odd permutations.
+	 */
+	[[nodiscard]]
+	constexpr auto determinant(this auto const& self) noexcept -> value_type;
+
+	/**
+	 * @brief The inverse of the factorized matrix.
+	 *
+	 * This solves the system for each column of the identity matrix.
+	 *
+	 * @warning Behavior is undefined if the factorized matrix is singular.
+	 */
+	[[nodiscard]]
+	constexpr auto inverse(this auto const& self) noexcept -> mat_type;
+
+	/**
+	 * @brief Solution of a system of linear equations.
+	 *
+	 * This calculates @f$ x @f$ such that @f$ A x = b @f$ by forward and backward substitution.
+	 *
+	 * @warning Behavior is undefined if the factorized matrix is singular.
+	 */
+	[[nodiscard]]
+	constexpr auto solve(this auto const& self, vec<N, T> const& b) noexcept -> vec_type;
+
+	/**
+	 * @brief Solution of a system of linear equations with multiple right-hand sides.
+	 *
+	 * This calculates @f$ X @f$ such that @f$ A X = B @f$, solving for each column of @p b.
+	 *
+	 * @warning Behavior is undefined if the factorized matrix is singular.
+	 */
+	template <std::size_t K>
+	[[nodiscard]]
+	constexpr auto solve(this auto const& self, mat<N, K, T> const& b) noexcept -> mat<N, K, T>;
+
+protected:
+	/// Combined @f$ L @f$ and @f$ U @f$ factors, stored column-major.
+	std::array<std::array<value_type, N>, N> factors_{};
+
+	/// Row permutation.
+	permutation_type permutation_{};
+
+	/// Whether the permutation is odd.
+	bool odd_{};
+
+	/// Whether any of the pivots is zero.
+	bool singular_{};
+};
+
+template <std::size_t N, typename T>
+lu(mat<N, N, T> const&) -> lu<N, T>;
+}
+
+#include "lu.inl"
+
+#endif
@@ -0,0 +1,158 @@
+#include "ndml/instrument/zone.hpp"
+#include "ndml/meta/unroll.hpp"
+
+#include <utility>
+
+namespace ndml
+{
+namespace detail
+{
+/**
+ * @brief Absolute value usable in constant expressions.
+ */
+template <typename T>
+constexpr auto abs(T const& value) noexcept -> T
+{
+	return value < T{0} ? -value : value;
+}
+}
+
+template <std::size_t N, typename T>
+constexpr lu<N, T>::lu(mat<N, N, T> const& m) noexcept
+{
+	NDML_INSTRUMENT_ZONE(lu);
+
+	auto& a = factors_;
+
+	meta::unroll<N * N>([&a, &m](auto... k) { ((a[k / N][k % N] = get<k % N>(m[k / N])), ...); });
+
+	for (std::size_t i = 0; i < N; ++i)
+	{
+		permutation_[i] = i;
+	}
+
+	for (std::size_t k = 0; k < N; ++k)
+	{
+		auto pivot = k;
+		for (std::size_t i = k + 1; i < N; ++i)
+		{
+			if (detail::abs(a[k][i]) > detail::abs(a[k][pivot]))
+			{
+				pivot = i;
+			}
+		}
+
+		if (a[k][pivot] == T{0})
+		{
+			singular_ = true;
+			continue;
+		}
+
+		if (pivot != k)
+		{
+			using std::swap;
+
+			for (std::size_t j = 0; j < N; ++j)
+			{
+				swap(a[j][k], a[j][pivot]);
+			}
+
+			swap(permutation_[k], permutation_[pivot]);
+			odd_ = !odd_;
+		}
+
+		for (std::size_t i = k + 1; i < N; ++i)
+		{
+			a[k][i] /= a[k][k];
+
+			for (std::size_t j = k + 1; j < N; ++j)
+			{
+				a[j][i] -= a[k][i] * a[j][k];
+			}
+		}
+	}
+}
+
+template <std::size_t N, typename T>
+constexpr auto lu<N, T>::singular(this auto const& self) noexcept -> bool
+{
+	return self.singular_;
+}
+
+template <std::size_t N, typename T>
+constexpr auto lu<N, T>::factors(this auto const& self) noexcept -> mat_type
+{
+	mat_type m;
+	meta::unroll<N * N>([&m, &a = self.factors_](auto... k) { ((get<k % N>(m[k / N]) = a[k / N][k % N]), ...); });
+
+	return m;
+}
+
+template <std::size_t N, typename T>
+constexpr auto lu<N, T>::permutation(this auto const& self) noexcept -> permutation_type const&
+{
+	return self.permutation_;
+}
+
+template <std::size_t N, typename T>
+constexpr auto lu<N, T>::determinant(this auto const& self) noexcept -> value_type
+{
+	value_type det{1};
+	for (std::size_t i = 0; i < N; ++i)
+	{
+		det *= self.factors_[i][i];
+	}
+
+	return self.odd_ ? -det : det;
+}
+
+template <std::size_t N, typename T>
+constexpr auto lu<N, T>::inverse(this auto const& self) noexcept -> mat_type
+{
+	return self.solve(mat_type{1});
+}
+
+template <std::size_t N, typename T>
+constexpr auto lu<N, T>::solve(this auto const& self, vec<N, T> const& b) noexcept -> vec_type
+{
+	auto const& a = self.factors_;
+
+	auto const rhs = meta::unroll<N>([&b](auto... i) { return std::array<value_type, N>{get<i>(b)...}; });
+
+	std::array<value_type, N> x;
+	for (std::size_t i = 0; i < N; ++i)
+	{
+		x[i] = rhs[self.permutation_[i]];
+
+		for (std::size_t j = 0; j < i; ++j)
+		{
+			x[i] -= a[j][i] * x[j];
+		}
+	}
+
+	for (std::size_t i = N; i-- > 0;)
+	{
+		for (std::size_t j = i + 1; j < N; ++j)
+		{
+			x[i] -= a[j][i] * x[j];
+		}
+
+		x[i] /= a[i][i];
+	}
+
+	return meta::unroll<N>([&x](auto... i) { return vec_type{x[i]...}; });
+}
+
+template <std::size_t N, typename T>
+template <std::size_t K>
+constexpr auto lu<N, T>::solve(this auto const& self, mat<N, K, T> const& b) noexcept -> mat<N, K, T>
+{
+	mat<N, K, T> x;
+	for (std::size_t j = 0; j < K; ++j)
+	{
+		x[j] = self.solve(b[j]);
+	}
+
+	return x;
+}
+}
@@ -1,6 +1,7 @@
 #ifndef NDML_MAT_MAT_HPP
 #define NDML_MAT_MAT_HPP
 
+#include "ndml/meta/layout.hpp"
 #include "ndml/vec.hpp"
 
 #include <array>
@@ -16,7 +17,10 @@ namespace ndml
  * @tparam C number of columns
  * @tparam T element type
  *
- * @note Matrix is stored column-major, i.e. given matrix @c m, @c m[i] is the i-th column of @c m.
+ * @note Matrix is stored column-major, i.e. given matrix @c m, @c m[i] is the i-th column of @c m,
+ *       and it is laid out exactly as an array of @p R * @p C elements of type @p T.
+ *
+ * @sa ndml::meta::array_layout
  */
 template <std::size_t R, std::size_t C, typename T>
 struct mat
@@ -27,6 +31,8 @@ struct mat
 	using column_type = vec_type;
 	using value_type  = column_type::value_type;
 
+	static_assert(meta::array_layout<std::array<column_type, C>, value_type, R * C>, "matrix elements must be laid out as an array");
+
 	/**
 	 * @brief Number of rows.
 	 *
@@ -92,7 +98,7 @@ struct mat
 	 */
 	template <typename FromT>
 	constexpr explicit mat(FromT const& scale) noexcept
-		requires std::convertible_to<FromT, value_type>;
+		requires std::constructible_from<value_type, FromT const&>;
 
 	/**
 	 * @brief Converting copy constructor from a matrix of another type.
@@ -108,7 +114,7 @@ struct mat
 	 */
 	template <std::size_t FromR, std::size_t FromC, typename FromT>
 	constexpr explicit mat(mat<FromR, FromC, FromT> const& m) noexcept
-		requires (FromR <= R && FromC <= C && std::convertible_to<FromT, value_type>);
+		requires (FromR <= R && FromC <= C && std::constructible_from<value_type, FromT const&>);
 
 	/**
 	 * @brief Converting move constructor from a matrix of another type.
@@ -124,7 +130,7 @@ struct mat
 	 */
 	template <std::size_t FromR, std::size_t FromC, typename FromT>
 	constexpr explicit mat(mat<FromR, FromC, FromT>&& m) noexcept
-		requires (FromR <= R && FromC <= C && std::convertible_to<FromT, value_type>);
+		requires (FromR <= R && FromC <= C && std::constructible_from<value_type, FromT>);
 
 	/**
 	 * @brief Copy-assignment operator.
@@ -169,6 +175,20 @@ struct mat
 	[[nodiscard]]
 	constexpr auto operator[](this auto&& self, std::size_t column, std::size_t row) noexcept -> decltype(auto);
 
+	/**
+	 * @brief Pointer to the elements.
+	 *
+	 * This retrieves the pointer to the first element, elements being laid out contiguously in column-major order.
+	 * Access through it is unchecked.
+	 *
+	 * @return pointer to the element at the intersection of the first column and the first row
+	 *
+	 * @warning Access to elements other than the first one through the returned pointer
+	 *          is not allowed in constant evaluation, use the subscript operators instead.
+	 */
+	[[nodiscard]]
+	constexpr auto data(this auto&& self) noexcept -> decltype(auto);
+
 	/**
 	 * @brief Iterator to the first column.
 	 *
@@ -15,7 +15,7 @@ constexpr mat<R, C, T>::mat(FromTs... columns) noexcept
 template <std::size_t R, std::size_t C, typename T>
 template <typename FromT>
 constexpr mat<R, C, T>::mat(FromT const& scale) noexcept
-	requires std::convertible_to<FromT, value_type>
+	requires std::constructible_from<value_type, FromT const&>
 {
 	for (std::size_t i = 0; i < column_count; ++i)
 	{
@@ -26,7 +26,7 @@ constexpr mat<R, C, T>::mat(FromT const& scale) noexcept
 template <std::size_t R, std::size_t C, typename T>
 template <std::size_t FromR, std::size_t FromC, typename FromT>
 constexpr mat<R, C, T>::mat(mat<FromR, FromC, FromT> const& m) noexcept
-	requires (FromR <= R && FromC <= C && std::convertible_to<FromT, value_type>)
+	requires (FromR <= R && FromC <= C && std::constructible_from<value_type, FromT const&>)
 {
 	for (std::size_t i = 0; i < m.column_count; ++i)
 	{
@@ -37,7 +37,7 @@ constexpr mat<R, C, T>::mat(mat<FromR, FromC, FromT> const& m) noexcept
 template <std::size_t R, std::size_t C, typename T>
 template <std::size_t FromR, std::size_t FromC, typename FromT>
 constexpr mat<R, C, T>::mat(mat<FromR, FromC, FromT>&& m) noexcept
-	requires (FromR <= R && FromC <= C && std::convertible_to<FromT, value_type>)
+	requires (FromR <= R && FromC <= C && std::constructible_from<value_type, FromT>)
 {
 	for (std::size_t i = 0; i < m.column_count; ++i)
 	{
@@ -63,6 +63,14 @@ constexpr auto mat<R, C, T>::operator[](this auto&& self, std::size_t column, st
 	return self[column][row];
 }
 
+template <std::size_t R, std::size_t C, typename T>
+constexpr auto mat<R, C, T>::data(this auto&& self) noexcept -> decltype(auto)
+{
+	static_assert(meta::array_layout<mat, value_type, R * C>, "matrix elements must be laid out as an array");
+
+	return self.columns_.front().data();
+}
+
 template <std::size_t R, std::size_t C, typename T>
 constexpr auto mat<R, C, T>::begin(this auto&& self) noexcept -> decltype(auto)
 {
@@ -2,6 +2,12 @@
 #define NDML_MAT_OPERATION_HPP
 
 #include "mat.hpp"
+#include "view.hpp"
+
+#include <array>
+#include <span>
+#include <type_traits>
+#include <utility>
 
 namespace ndml
 {
@@ -26,7 +32,7 @@ constexpr auto transpose(mat<R, C, T> const& m) noexcept -> mat<C, R, T>;
  * @brief The row echelon form of a matrix.
  *
  * This calculates the row echelon form of @p m, i.e. @p m with first non-zero entries
- * of all rows forming a staircase pattern.
+ * of all rows forming a staircase pattern. Rows are pivoted on the greatest absolute value in each column.
  *
  * @tparam R number of rows
  * @tparam C number of columns
@@ -43,7 +49,8 @@ constexpr auto row_echelon_form(mat<N, N, T> const& m) noexcept -> mat<N, N, T>;
 /**
  * @brief The determinant of a matrix.
  *
- * This calculates the determinant of a matrix.
+ * This calculates the determinant of a matrix. Matrices of up to four rows are handled in closed form,
+ * larger ones via LU decomposition with partial pivoting.
  *
  * @tparam R number of rows
  * @tparam C number of columns
@@ -60,7 +67,8 @@ constexpr auto determinant(mat<N, N, T> const& m) noexcept -> mat<N, N, T>::valu
 /**
  * @brief The inverse of a matrix.
  *
- * This calculates the inverse of a matrix via a method called Gauss-Jordan elimination.
+ * This calculates the inverse of a matrix. Matrices of up to four rows are inverted in closed form
+ * via the adjugate and a single reciprocal of the determinant, larger ones via LU decomposition with partial pivoting.
  *
  * @tparam R number of rows
  * @tparam C number of columns
@@ -74,6 +82,62 @@ template <std::size_t N, typename T>
 [[nodiscard]]
 constexpr auto inverse(mat<N, N, T> const& m) noexcept -> mat<N, N, T>;
 
+/**
+ * @brief The inverse and the determinant of a matrix.
+ *
+ * This calculates both at the cost of the inverse alone, which is divided by the determinant anyway,
+ * e.g. for rejecting nearly singular matrices before using their inverses:
+ *
+ * @code
+ * auto const [inv, det] = inverse_and_determinant(m);
+ * if (abs(det) > epsilon) { ... }
+ * @endcode
+ *
+ * @tparam N number of rows and columns
+ * @tparam T element type
+ *
+ * @param m matrix
+ *
+ * @return the inverse of @p m, the elements of which are not finite if @p m is singular, and the determinant of @p m
+ */
+template <std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto inverse_and_determinant(mat<N, N, T> const& m) noexcept -> std::pair<mat<N, N, T>, T>;
+
+/**
+ * @brief The inverse of an affine transformation matrix.
+ *
+ * This calculates the inverse of a matrix whose last row is @f$ (0, 0, 0, 1) @f$
+ * by inverting its upper-left three-by-three block @f$ L @f$ and translation @f$ t @f$ separately,
+ * giving a matrix with block @f$ L^{-1} @f$ and translation @f$ -L^{-1} t @f$.
+ *
+ * @tparam T element type
+ *
+ * @param m affine transformation matrix
+ *
+ * @return the inverse of @p m
+ */
+template <typename T>
+[[nodiscard]]
+constexpr auto affine_inverse(mat<4, 4, T> const& m) noexcept -> mat<4, 4, T>;
+
+/**
+ * @brief The inverse of a rigid transformation matrix.
+ *
+ * This calculates the inverse of a matrix whose last row is @f$ (0, 0, 0, 1) @f$
+ * and whose upper-left three-by-three block @f$ R @f$ is orthonormal, i.e. a rotation with an optional reflection,
+ * giving a matrix with block @f$ R^T @f$ and translation @f$ -R^T t @f$.
+ *
+ * @tparam T element type
+ *
+ * @param m rigid transformation matrix
+ *
+ * @return the inverse of @p m
+ */
+template <typename T>
+[[nodiscard]]
+constexpr auto rigid_inverse(mat<4, 4, T> const& m) noexcept -> mat<4, 4, T>;
+
 /**
  * @brief The trace of a matrix.
  *
@@ -193,6 +257,9 @@ constexpr auto operator-(mat<R, C, T> const& lhs, mat<R, C, T> const& rhs) noexc
  * @brief Matrix multiplication operator.
  *
  * Performs matrix multiplication for @p lhs and @p rhs and returns the result.
+ *
+ * Products with more than eight rows are accumulated in tiles of up to twelve rows and four columns
+ * outside of constant evaluation. Columns of elements accumulated in another type are calculated as matrix-vector products.
  */
 template <std::size_t N, std::size_t M, std::size_t K, typename T>
 [[nodiscard]]
@@ -201,7 +268,8 @@ constexpr auto operator*(mat<N, M, T> const& lhs, mat<M, K, T> const& rhs) noexc
 /**
  * @brief Matrix-vector multiplication operator.
  *
- * Multiplies @p m by @p v and returns the result.
+ * Multiplies @p m by @p v and returns the result. Products are summed in @c math::accumulator_t<T>,
+ * e.g. in @c float for half-precision elements, and only the result is rounded to @p T.
  */
 template <std::size_t N, std::size_t M, typename T>
 [[nodiscard]]
@@ -224,6 +292,87 @@ constexpr auto operator*(mat<R, C, T> const& m, typename mat<R, C, T>::value_typ
 template <std::size_t R, std::size_t C, typename T>
 [[nodiscard]]
 constexpr auto operator*(typename mat<R, C, T>::value_type const& scale, mat<R, C, T> const& m) noexcept -> mat<R, C, T>;
+
+/**
+ * @brief Batch matrix-vector multiplication.
+ *
+ * Multiplies @p m by each vector of @p in and stores the products to the respective vectors of @p out.
+ * @p in and @p out may refer to the same vectors if @p m is square.
+ *
+ * @warning Behavior is undefined if @p out is shorter than @p in.
+ *
+ * @return the first @c in.size() vectors of @p out
+ */
+template <std::size_t N, std::size_t M, typename T>
+constexpr auto transform(mat<N, M, T> const& m, std::type_identity_t<std::span<vec<M, T> const>> in, std::type_identity_t<std::span<vec<N, T>>> out) noexcept
+	-> std::span<vec<N, T>>;
+
+/**
+ * @brief Batch matrix-vector multiplication in structure of arrays form.
+ *
+ * Multiplies @p m by each vector whose components are the respective elements of spans of @p in,
+ * and stores the components of the products to the respective elements of spans of @p out, e.g.
+ * @code
+ * transform(m, {xs, ys, zs, ws}, {xs, ys, zs, ws});
+ * @endcode
+ * @p in and @p out may refer to the same elements if @p m is square.
+ *
+ * @warning Behavior is undefined if any of spans of @p in or @p out is shorter than the first span of @p in.
+ */
+template <std::size_t N, std::size_t M, typename T>
+constexpr auto transform(
+	mat<N, M, T> const&                                            m,
+	std::type_identity_t<std::array<std::span<T const>, M>> const& in,
+	std::type_identity_t<std::array<std::span<T>, N>> const&       out
+) noexcept -> void;
+
+/**
+ * @brief Transposition of a matrix view.
+ */
+template <std::size_t R, std::size_t C, typename T>
+[[nodiscard]]
+constexpr auto transpose(mat_view<R, C, T> const& m) noexcept -> mat<C, R, std::remove_cv_t<T>>;
+
+/**
+ * @brief Determinant of a square matrix view.
+ */
+template <std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto determinant(mat_view<N, N, T> const& m) noexcept -> mat_view<N, N, T>::value_type;
+
+/**
+ * @brief Inverse of a square matrix view.
+ *
+ * @warning Behavior is undefined if the viewed matrix is singular.
+ */
+template <std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto inverse(mat_view<N, N, T> const& m) noexcept -> mat_view<N, N, T>::mat_type;
+
+/**
+ * @brief Inverse and determinant of a square matrix view.
+ */
+template <std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto inverse_and_determinant(mat_view<N, N, T> const& m) noexcept
+	-> std::pair<typename mat_view<N, N, T>::mat_type, typename mat_view<N, N, T>::value_type>;
+
+/**
+ * @brief Trace of a square matrix view.
+ */
+template <std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto trace(mat_view<N, N, T> const& m) noexcept -> mat_view<N, N, T>::value_type;
+
+/**
+ * @brief Multiplication operator for operands at least one of which is a view.
+ *
+ * This loads viewed elements and multiplies the resulting matrices or the resulting matrix and vector.
+ */
+template <typename L, typename R>
+[[nodiscard]]
+constexpr auto operator*(L const& lhs, R const& rhs) noexcept -> detail::product_t<L, R>
+	requires viewed_product<L, R>;
 }
 
 #include "operation.inl"
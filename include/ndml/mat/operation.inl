@@ -1,3 +1,13 @@
+#include "lu.hpp"
+
+#include "ndml/instrument/zone.hpp"
+#include "ndml/math/precision.hpp"
+#include "ndml/meta/unroll.hpp"
+#include "ndml/simd/batch.hpp"
+#include "ndml/simd/mat.hpp"
+
+#include <utility>
+
 namespace ndml
 {
 template <std::size_t R, std::size_t C, typename T>
@@ -5,13 +15,7 @@ constexpr auto transpose(mat<R, C, T> const& m) noexcept -> mat<C, R, T>
 {
 	mat<C, R, T> t;
 
-	for (std::size_t i = 0; i < m.column_count; ++i)
-	{
-		for (std::size_t j = 0; j < m.row_count; ++j)
-		{
-			t[j, i] = m[i, j];
-		}
-	}
+	meta::unroll<R * C>([&t, &m](auto... k) { ((get<k / R>(t[k % R]) = get<k % R>(m[k / R])), ...); });
 
 	return t;
 }
@@ -19,10 +23,36 @@ constexpr auto transpose(mat<R, C, T> const& m) noexcept -> mat<C, R, T>
 template <std::size_t N, typename T>
 constexpr auto row_echelon_form(mat<N, N, T> const& m) noexcept -> mat<N, N, T>
 {
+	NDML_INSTRUMENT_ZONE(row_echelon_form);
+
 	mat ref{m};
 
 	for (std::size_t i = 0; i < ref.column_count; ++i)
 	{
+		auto pivot = i;
+		for (std::size_t j = i + 1; j < ref.row_count; ++j)
+		{
+			if (detail::abs(ref[i, j]) > detail::abs(ref[i, pivot]))
+			{
+				pivot = j;
+			}
+		}
+
+		if (ref[i, pivot] == T{0})
+		{
+			continue;
+		}
+
+		if (pivot != i)
+		{
+			using std::swap;
+
+			for (std::size_t k = i; k < ref.column_count; ++k)
+			{
+				swap(ref[k, i], ref[k, pivot]);
+			}
+		}
+
 		for (std::size_t j = i + 1; j < ref.row_count; ++j)
 		{
 			auto const scale = ref[i, j] / ref[i, i];
@@ -55,6 +85,8 @@ constexpr auto determinant(mat<2, 2, T> const& m) noexcept -> mat<2, 2, T>::valu
 template <typename T>
 constexpr auto determinant(mat<3, 3, T> const& m) noexcept -> mat<3, 3, T>::value_type
 {
+	NDML_INSTRUMENT_ZONE(determinant);
+
 	auto const& m0  = m[0];
 	auto const& m00 = m0[0];
 	auto const& m01 = m0[1];
@@ -73,24 +105,37 @@ constexpr auto determinant(mat<3, 3, T> const& m) noexcept -> mat<3, 3, T>::valu
 	return (m02 * m10 * m21) + (m00 * m11 * m22) + (m01 * m12 * m20) - (m01 * m10 * m22) - (m02 * m11 * m20) - (m00 * m12 * m21);
 }
 
+template <typename T>
+constexpr auto determinant(mat<4, 4, T> const& m) noexcept -> mat<4, 4, T>::value_type
+{
+	NDML_INSTRUMENT_ZONE(determinant);
+
+	auto const a = m[0].xyz();
+	auto const b = m[1].xyz();
+	auto const c = m[2].xyz();
+	auto const d = m[3].xyz();
+
+	// Laplace expansion along the upper and lower row pairs, with the same 2x2 subdeterminants as the inverse
+	auto const s = cross(a, b);
+	auto const t = cross(c, d);
+	auto const u = a * m[1, 3] - b * m[0, 3];
+	auto const v = c * m[3, 3] - d * m[2, 3];
+
+	return dot(s, v) + dot(t, u);
+}
+
 template <std::size_t N, typename T>
 constexpr auto determinant(mat<N, N, T> const& m) noexcept -> mat<N, N, T>::value_type
 {
-	T det{1};
-
-	auto const ref = row_echelon_form(m);
-	for (std::size_t i = 0; i < N; ++i)
-	{
-		det *= ref[i, i];
-	}
+	NDML_INSTRUMENT_ZONE(determinant);
 
-	return det;
+	return lu{m}.determinant();
 }
 
 template <typename T>
 constexpr auto inverse(mat<1, 1, T> const& m) noexcept -> mat<1, 1, T>
 {
-	return {T{1} / m[0, 0]};
+	return mat<1, 1, T>{T{1} / m[0, 0]};
 }
 
 template <typename T>
@@ -104,7 +149,7 @@ constexpr auto inverse(mat<2, 2, T> const& m) noexcept -> mat<2, 2, T>
 	auto const& m10 = m1[0];
 	auto const& m11 = m1[1];
 
-	auto const det = m00 * m11 - m01 * m11;
+	auto const det = m00 * m11 - m10 * m01;
 
 	return mat{
 		       vec{ m11, -m01},
@@ -113,51 +158,194 @@ constexpr auto inverse(mat<2, 2, T> const& m) noexcept -> mat<2, 2, T>
 	       det;
 }
 
+namespace detail
+{
+/**
+ * @brief Inverse and determinant of a three-by-three matrix, which share the cross products of pairs of its columns.
+ */
+template <typename T>
+constexpr auto inverse_and_determinant(mat<3, 3, T> const& m) noexcept -> std::pair<mat<3, 3, T>, T>
+{
+	auto const& a = m[0];
+	auto const& b = m[1];
+	auto const& c = m[2];
+
+	auto const bc      = cross(b, c);
+	auto const det     = dot(a, bc);
+	auto const inv_det = T{1} / det;
+
+	// rows of the inverse are cross products of pairs of columns
+	auto const inv = transpose(mat{
+		bc * inv_det,
+		cross(c, a) * inv_det,
+		cross(a, b) * inv_det,
+	});
+
+	return {inv, det};
+}
+
+/**
+ * @brief Inverse and determinant of a four-by-four matrix, which share the 2x2 subdeterminants of its upper and lower row pairs.
+ */
+template <typename T>
+constexpr auto inverse_and_determinant(mat<4, 4, T> const& m) noexcept -> std::pair<mat<4, 4, T>, T>
+{
+	auto const a = m[0].xyz();
+	auto const b = m[1].xyz();
+	auto const c = m[2].xyz();
+	auto const d = m[3].xyz();
+
+	auto const x = m[0, 3];
+	auto const y = m[1, 3];
+	auto const z = m[2, 3];
+	auto const w = m[3, 3];
+
+	// all of the 2x2 subdeterminants of the upper and lower row pairs
+	auto s = cross(a, b);
+	auto t = cross(c, d);
+	auto u = a * y - b * x;
+	auto v = c * w - d * z;
+
+	auto const det     = dot(s, v) + dot(t, u);
+	auto const inv_det = T{1} / det;
+
+	s *= inv_det;
+	t *= inv_det;
+	u *= inv_det;
+	v *= inv_det;
+
+	auto const r0 = cross(b, v) + t * y;
+	auto const r1 = cross(v, a) - t * x;
+	auto const r2 = cross(d, u) + s * w;
+	auto const r3 = cross(u, c) - s * z;
+
+	auto const inv = transpose(mat{
+		vec<4, T>{r0.x, r0.y, r0.z, -dot(b, t)},
+		vec<4, T>{r1.x, r1.y, r1.z,  dot(a, t)},
+		vec<4, T>{r2.x, r2.y, r2.z, -dot(d, s)},
+		vec<4, T>{r3.x, r3.y, r3.z,  dot(c, s)},
+	});
+
+	return {inv, det};
+}
+}
+
+template <typename T>
+constexpr auto inverse(mat<3, 3, T> const& m) noexcept -> mat<3, 3, T>
+{
+	NDML_INSTRUMENT_ZONE(inverse);
+
+	return detail::inverse_and_determinant(m).first;
+}
+
+template <typename T>
+constexpr auto inverse(mat<4, 4, T> const& m) noexcept -> mat<4, 4, T>
+{
+	NDML_INSTRUMENT_ZONE(inverse);
+
+	return detail::inverse_and_determinant(m).first;
+}
+
 template <std::size_t N, typename T>
 constexpr auto inverse(mat<N, N, T> const& m) noexcept -> mat<N, N, T>
 {
-	mat<N, N, T> inv{1};
-	mat          id{m};
+	NDML_INSTRUMENT_ZONE(inverse);
 
-	for (std::size_t i = 0; i < id.column_count; ++i)
-	{
-		auto const pivot = id[i, i];
+	return lu{m}.inverse();
+}
 
-		for (std::size_t j = 0; j < id.column_count; ++j)
-		{
-			id[j, i]  /= pivot;
-			inv[j, i] /= pivot;
-		}
+template <typename T>
+constexpr auto inverse_and_determinant(mat<1, 1, T> const& m) noexcept -> std::pair<mat<1, 1, T>, T>
+{
+	return {inverse(m), m[0, 0]};
+}
 
-		for (std::size_t j = 0; j < id.row_count; ++j)
-		{
-			if (i == j)
-			{
-				continue;
-			}
+template <typename T>
+constexpr auto inverse_and_determinant(mat<2, 2, T> const& m) noexcept -> std::pair<mat<2, 2, T>, T>
+{
+	return {inverse(m), determinant(m)};
+}
 
-			auto const scale = id[i, j];
+template <typename T>
+constexpr auto inverse_and_determinant(mat<3, 3, T> const& m) noexcept -> std::pair<mat<3, 3, T>, T>
+{
+	NDML_INSTRUMENT_ZONE(inverse_and_determinant);
 
-			for (std::size_t k = 0; k < id.column_count; ++k)
-			{
-				id[k, j]  -= scale * id[k, i];
-				inv[k, j] -= scale * inv[k, i];
-			}
-		}
-	}
+	return detail::inverse_and_determinant(m);
+}
+
+template <typename T>
+constexpr auto inverse_and_determinant(mat<4, 4, T> const& m) noexcept -> std::pair<mat<4, 4, T>, T>
+{
+	NDML_INSTRUMENT_ZONE(inverse_and_determinant);
+
+	return detail::inverse_and_determinant(m);
+}
+
+template <std::size_t N, typename T>
+constexpr auto inverse_and_determinant(mat<N, N, T> const& m) noexcept -> std::pair<mat<N, N, T>, T>
+{
+	NDML_INSTRUMENT_ZONE(inverse_and_determinant);
+
+	lu const decomposition{m};
+
+	return {decomposition.inverse(), decomposition.determinant()};
+}
+
+namespace detail
+{
+/**
+ * @brief Affine transformation matrix with upper-left block @p l and translation @f$ -l t @f$,
+ * given @f$ t @f$ the translation of @p m.
+ */
+template <typename T>
+constexpr auto affine_inverse(mat<3, 3, T> const& l, mat<4, 4, T> const& m) noexcept -> mat<4, 4, T>
+{
+	auto const t = -(l * m[3].xyz());
+
+	return {
+		vec<4, T>{l[0, 0], l[0, 1], l[0, 2], T{0}},
+		vec<4, T>{l[1, 0], l[1, 1], l[1, 2], T{0}},
+		vec<4, T>{l[2, 0], l[2, 1], l[2, 2], T{0}},
+		vec<4, T>{    t.x,     t.y,     t.z, T{1}},
+	};
+}
 
-	return inv;
+/**
+ * @brief Upper-left three-by-three block of @p m.
+ */
+template <typename T>
+constexpr auto linear_block(mat<4, 4, T> const& m) noexcept -> mat<3, 3, T>
+{
+	return {
+		m[0].xyz(),
+		m[1].xyz(),
+		m[2].xyz(),
+	};
+}
+}
+
+template <typename T>
+constexpr auto affine_inverse(mat<4, 4, T> const& m) noexcept -> mat<4, 4, T>
+{
+	NDML_INSTRUMENT_ZONE(affine_inverse);
+
+	return detail::affine_inverse(inverse(detail::linear_block(m)), m);
+}
+
+template <typename T>
+constexpr auto rigid_inverse(mat<4, 4, T> const& m) noexcept -> mat<4, 4, T>
+{
+	NDML_INSTRUMENT_ZONE(rigid_inverse);
+
+	return detail::affine_inverse(transpose(detail::linear_block(m)), m);
 }
 
 template <std::size_t N, typename T>
 constexpr auto trace(mat<N, N, T> const& m) noexcept -> mat<N, N, T>::value_type
 {
 	T tr{};
-
-	for (std::size_t i = 0; i < m.column_count; ++i)
-	{
-		tr += m[i, i];
-	}
+	meta::unroll<N>([&tr, &m](auto... i) { ((tr += get<i>(m[i])), ...); });
 
 	return tr;
 }
@@ -255,39 +443,143 @@ constexpr auto operator-(mat<R, C, T> const& lhs, mat<R, C, T> const& rhs) noexc
 	return tmp -= rhs;
 }
 
+namespace detail
+{
+/**
+ * @brief Largest divisor of @p n not greater than @p max, or @p n itself if it is not greater than @p max.
+ */
+consteval auto tile_size(std::size_t n, std::size_t max) noexcept -> std::size_t
+{
+	if (n <= max)
+	{
+		return n;
+	}
+
+	for (std::size_t t = max; t > 1; --t)
+	{
+		if (n % t == 0)
+		{
+			return t;
+		}
+	}
+
+	return 1;
+}
+
+/**
+ * @brief Accumulates a tile of @p TR rows and @p TC columns of the product of @p lhs and @p rhs in registers.
+ *
+ * The tile is accumulated over @p depth columns of @p lhs and stored to @p p at column @p j and row @p i.
+ * Both operands are walked in column order and each loaded element is used for a whole tile row or column.
+ * Operands may be of any column-major types whose columns provide contiguous @c data().
+ */
+template <std::size_t TR, std::size_t TC, typename L, typename R, typename P>
+auto multiply_tile(L const& lhs, R const& rhs, P&& p, std::size_t i, std::size_t j, std::size_t depth) noexcept -> void
+{
+	using value_type = std::remove_cvref_t<decltype(*lhs[0].data())>;
+
+	value_type acc[TC][TR]{};
+
+	for (std::size_t k = 0; k < depth; ++k)
+	{
+		auto const* const a = lhs[k].data() + i;
+
+		auto const accumulate = [&acc, &rhs, a, j, k](auto jj)
+		{
+			auto const s = rhs[j + jj].data()[k];
+			meta::unroll<TR>([&acc, a, s, jj](auto... ii) { ((acc[jj][ii] += a[ii] * s), ...); });
+		};
+
+		meta::unroll<TC>([&accumulate](auto... jj) { (accumulate(jj), ...); });
+	}
+
+	auto const store = [&acc, &p, i, j](auto jj)
+	{
+		auto* const c = p[j + jj].data() + i;
+		meta::unroll<TR>([&acc, c, jj](auto... ii) { ((c[ii] = acc[jj][ii]), ...); });
+	};
+
+	meta::unroll<TC>([&store](auto... jj) { (store(jj), ...); });
+}
+
+/**
+ * @brief Matrix multiplication accumulating tiles of @p TR rows and @p TC columns of the product in registers.
+ */
+template <std::size_t TR, std::size_t TC, std::size_t N, std::size_t M, std::size_t K, typename T>
+auto multiply_tiled(mat<N, M, T> const& lhs, mat<M, K, T> const& rhs) noexcept -> mat<N, K, T>
+{
+	static_assert(N % TR == 0 && K % TC == 0, "tiles must partition the product");
+
+	mat<N, K, T> p;
+
+	for (std::size_t j = 0; j < K; j += TC)
+	{
+		for (std::size_t i = 0; i < N; i += TR)
+		{
+			multiply_tile<TR, TC>(lhs, rhs, p, i, j, M);
+		}
+	}
+
+	return p;
+}
+}
+
 template <std::size_t N, std::size_t M, std::size_t K, typename T>
 constexpr auto operator*(mat<N, M, T> const& lhs, mat<M, K, T> const& rhs) noexcept -> mat<N, K, T>
 {
-	mat<N, K, T> p;
+	if constexpr (N == M && M == K && simd::enabled<mat<N, M, T>>)
+	{
+		if !consteval
+		{
+			return simd::kernel<mat<N, M, T>>::multiply(lhs, rhs);
+		}
+	}
 
-	for (std::size_t i = 0; i < lhs.row_count; ++i)
+	if constexpr (N > 8 && !math::widened<T>)
 	{
-		for (std::size_t j = 0; j < rhs.column_count; ++j)
+		if !consteval
 		{
-			for (std::size_t k = 0; k < lhs.column_count; ++k)
-			{
-				p[j, i] += lhs[k, i] * rhs[j, k];
-			}
+			return detail::multiply_tiled<detail::tile_size(N, 12), detail::tile_size(K, 4)>(lhs, rhs);
 		}
 	}
 
+	mat<N, K, T> p;
+
+	for (std::size_t j = 0; j < rhs.column_count; ++j)
+	{
+		p[j] = lhs * rhs[j];
+	}
+
 	return p;
 }
 
 template <std::size_t N, std::size_t M, typename T>
 constexpr auto operator*(mat<N, M, T> const& m, vec<M, T> const& v) noexcept -> vec<N, T>
 {
-	vec<N, T> p;
-
-	for (std::size_t i = 0; i < m.row_count; ++i)
+	if constexpr (N == M && simd::enabled<mat<N, M, T>>)
 	{
-		for (std::size_t k = 0; k < m.column_count; ++k)
+		if !consteval
 		{
-			p[i] += m[k, i] * v[k];
+			return simd::kernel<mat<N, M, T>>::multiply(m, v);
 		}
 	}
 
-	return p;
+	if constexpr (math::widened<T>)
+	{
+		using accumulator_type = math::accumulator_t<T>;
+
+		vec<N, accumulator_type> p;
+		meta::unroll<M>([&p, &m, &v](auto... k) { ((p += vec<N, accumulator_type>{m[k]} * static_cast<accumulator_type>(get<k>(v))), ...); });
+
+		return vec<N, T>{p};
+	}
+	else
+	{
+		vec<N, T> p;
+		meta::unroll<M>([&p, &m, &v](auto... k) { ((p += m[k] * get<k>(v)), ...); });
+
+		return p;
+	}
 }
 
 template <std::size_t R, std::size_t C, typename T>
@@ -309,4 +601,98 @@ constexpr auto operator/(mat<R, C, T> const& m, typename mat<R, C, T>::value_typ
 	auto tmp{m};
 	return tmp /= scale;
 }
+
+template <std::size_t N, std::size_t M, typename T>
+constexpr auto transform(mat<N, M, T> const& m, std::type_identity_t<std::span<vec<M, T> const>> in, std::type_identity_t<std::span<vec<N, T>>> out) noexcept
+	-> std::span<vec<N, T>>
+{
+	NDML_INSTRUMENT_ZONE(mat_transform);
+
+	out = out.first(in.size());
+
+	if constexpr (N == M && simd::batch_enabled<mat<N, M, T>>)
+	{
+		if !consteval
+		{
+			simd::batch<mat<N, M, T>>::transform(m, in, out);
+			return out;
+		}
+	}
+
+	for (std::size_t i = 0; i < in.size(); ++i)
+	{
+		out[i] = m * in[i];
+	}
+
+	return out;
+}
+
+template <std::size_t N, std::size_t M, typename T>
+constexpr auto transform(
+	mat<N, M, T> const&                                            m,
+	std::type_identity_t<std::array<std::span<T const>, M>> const& in,
+	std::type_identity_t<std::array<std::span<T>, N>> const&       out
+) noexcept -> void
+{
+	NDML_INSTRUMENT_ZONE(mat_transform);
+
+	if constexpr (N == M && simd::batch_enabled<mat<N, M, T>>)
+	{
+		if !consteval
+		{
+			simd::batch<mat<N, M, T>>::transform(m, in, out);
+			return;
+		}
+	}
+
+	for (std::size_t i = 0; i < in[0].size(); ++i)
+	{
+		vec<M, T> v;
+		meta::unroll<M>([&v, &in, i](auto... k) { ((get<k>(v) = in[k][i]), ...); });
+
+		auto const p = m * v;
+		meta::unroll<N>([&p, &out, i](auto... r) { ((out[r][i] = get<r>(p)), ...); });
+	}
+}
+
+template <std::size_t R, std::size_t C, typename T>
+constexpr auto transpose(mat_view<R, C, T> const& m) noexcept -> mat<C, R, std::remove_cv_t<T>>
+{
+	return transpose(m.load());
+}
+
+template <std::size_t N, typename T>
+constexpr auto determinant(mat_view<N, N, T> const& m) noexcept -> mat_view<N, N, T>::value_type
+{
+	return determinant(m.load());
+}
+
+template <std::size_t N, typename T>
+constexpr auto inverse(mat_view<N, N, T> const& m) noexcept -> mat_view<N, N, T>::mat_type
+{
+	return inverse(m.load());
+}
+
+template <std::size_t N, typename T>
+constexpr auto inverse_and_determinant(mat_view<N, N, T> const& m) noexcept
+	-> std::pair<typename mat_view<N, N, T>::mat_type, typename mat_view<N, N, T>::value_type>
+{
+	return inverse_and_determinant(m.load());
+}
+
+template <std::size_t N, typename T>
+constexpr auto trace(mat_view<N, N, T> const& m) noexcept -> mat_view<N, N, T>::value_type
+{
+	typename mat_view<N, N, T>::value_type tr{};
+	meta::unroll<N>([&tr, &m](auto... i) { ((tr += m[i, i]), ...); });
+
+	return tr;
+}
+
+template <typename L, typename R>
+constexpr auto operator*(L const& lhs, R const& rhs) noexcept -> detail::product_t<L, R>
+	requires viewed_product<L, R>
+{
+	return detail::load(lhs) * detail::load(rhs);
+}
 }
@@ -0,0 +1,229 @@
+#ifndef NDML_MAT_SYM_HPP
+#define NDML_MAT_SYM_HPP
+
+#include "mat.hpp"
+#include "operation.hpp"
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+
+namespace ndml
+{
+/**
+ * @brief Symmetric matrix.
+ *
+ * Only the upper triangle of the matrix is stored, packed column by column, so that it occupies
+ * @f$ \frac {N (N + 1)} 2 @f$ rather than @f$ N^2 @f$ elements, e.g. 6 rather than 9 for a 3x3 covariance matrix.
+ * Operations on it read each stored element once, and those producing it calculate only its upper triangle.
+ *
+ * @tparam N number of rows and columns
+ * @tparam T element type
+ *
+ * @note Element @f$ (i, j) @f$ with @f$ i \le j @f$ is stored at index @f$ \frac {j (j + 1)} 2 + i @f$,
+ *       as in the packed upper storage of LAPACK.
+ *
+ * @sa ndml::cholesky
+ * @sa ndml::eigen
+ */
+template <std::size_t N, typename T>
+struct sym_mat
+{
+	static_assert(N > 0);
+
+	using mat_type   = mat<N, N, T>;
+	using vec_type   = vec<N, T>;
+	using value_type = T;
+
+	/**
+	 * @brief Number of rows and columns.
+	 */
+	static constexpr auto dimension = N;
+
+	/**
+	 * @brief Number of stored elements.
+	 */
+	static constexpr auto element_count = N * (N + 1) / 2;
+
+	/**
+	 * @brief Default constructor.
+	 *
+	 * Elements are value-initialized, i.e. the matrix will be equal to the zero matrix.
+	 */
+	constexpr sym_mat() noexcept = default;
+
+	/**
+	 * @brief Constructor from scale.
+	 *
+	 * This will initialize all entries along the main diagonal to @p scale.
+	 */
+	template <typename FromT>
+	constexpr explicit sym_mat(FromT const& scale) noexcept
+		requires std::constructible_from<value_type, FromT const&>;
+
+	/**
+	 * @brief Constructor from a matrix.
+	 *
+	 * This will initialize the matrix to the upper triangle of @p m, mirrored onto the lower one,
+	 * so that it is equal to @p m if @p m is symmetric.
+	 */
+	constexpr explicit sym_mat(mat_type const& m) noexcept;
+
+	/**
+	 * @brief Element subscript operator.
+	 *
+	 * This retrieves the element at the intersection of column @p column and row @p row,
+	 * which is the same as that at the intersection of column @p row and row @p column.
+	 *
+	 * @warning Behavior is undefined when @p column >= @p N or @p row >= @p N.
+	 */
+	[[nodiscard]]
+	constexpr auto operator[](this auto&& self, std::size_t column, std::size_t row) noexcept -> decltype(auto);
+
+	/**
+	 * @brief Pointer to the stored elements.
+	 *
+	 * This retrieves the pointer to the first of the @c element_count stored elements, laid out contiguously.
+	 */
+	[[nodiscard]]
+	constexpr auto data(this auto&& self) noexcept -> decltype(auto);
+
+	/**
+	 * @brief Conversion to a matrix.
+	 *
+	 * This expands the matrix to all of its @f$ N^2 @f$ elements.
+	 */
+	[[nodiscard]]
+	constexpr explicit operator mat_type(this sym_mat const& self) noexcept;
+
+protected:
+	/**
+	 * @brief Index of the stored element at the intersection of column @p column and row @p row.
+	 */
+	[[nodiscard]]
+	static constexpr auto index(std::size_t column, std::size_t row) noexcept -> std::size_t;
+
+	/// Elements of the upper triangle, packed column by column.
+	std::array<value_type, element_count> elements_{};
+};
+
+template <std::size_t N, typename T>
+sym_mat(mat<N, N, T> const&) -> sym_mat<N, T>;
+
+/**
+ * @brief Comparison operators.
+ */
+template <std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto operator==(sym_mat<N, T> const& lhs, sym_mat<N, T> const& rhs) noexcept -> bool;
+
+template <std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto operator!=(sym_mat<N, T> const& lhs, sym_mat<N, T> const& rhs) noexcept -> bool;
+
+/**
+ * @brief Negation operator.
+ */
+template <std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto operator-(sym_mat<N, T> const& s) noexcept -> sym_mat<N, T>;
+
+/**
+ * @brief Addition and subtraction operators.
+ *
+ * These operate on the stored elements only.
+ */
+template <std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto operator+(sym_mat<N, T> const& lhs, sym_mat<N, T> const& rhs) noexcept -> sym_mat<N, T>;
+
+template <std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto operator-(sym_mat<N, T> const& lhs, sym_mat<N, T> const& rhs) noexcept -> sym_mat<N, T>;
+
+template <std::size_t N, typename T>
+constexpr auto operator+=(sym_mat<N, T>& lhs, sym_mat<N, T> const& rhs) noexcept -> sym_mat<N, T>&;
+
+template <std::size_t N, typename T>
+constexpr auto operator-=(sym_mat<N, T>& lhs, sym_mat<N, T> const& rhs) noexcept -> sym_mat<N, T>&;
+
+/**
+ * @brief Scaling operators.
+ */
+template <std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto operator*(sym_mat<N, T> const& s, typename sym_mat<N, T>::value_type const& scale) noexcept -> sym_mat<N, T>;
+
+template <std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto operator*(typename sym_mat<N, T>::value_type const& scale, sym_mat<N, T> const& s) noexcept -> sym_mat<N, T>;
+
+template <std::size_t N, typename T>
+constexpr auto operator*=(sym_mat<N, T>& s, typename sym_mat<N, T>::value_type const& scale) noexcept -> sym_mat<N, T>&;
+
+/**
+ * @brief Symmetric matrix-vector multiplication operator.
+ *
+ * This gathers the columns of @p s from its stored upper triangle, and accumulates them as matrix-vector multiplication does.
+ */
+template <std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto operator*(sym_mat<N, T> const& s, vec<N, T> const& v) noexcept -> vec<N, T>;
+
+/**
+ * @brief Symmetric matrix-matrix multiplication operator.
+ *
+ * This multiplies @p s by each column of @p m.
+ */
+template <std::size_t N, std::size_t K, typename T>
+[[nodiscard]]
+constexpr auto operator*(sym_mat<N, T> const& s, mat<N, K, T> const& m) noexcept -> mat<N, K, T>;
+
+/**
+ * @brief The trace of a symmetric matrix.
+ */
+template <std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto trace(sym_mat<N, T> const& s) noexcept -> sym_mat<N, T>::value_type;
+
+/**
+ * @brief Gram matrix.
+ *
+ * This calculates @f$ M^T M @f$, i.e. the dot products of pairs of columns of @p m, each pair once,
+ * e.g. the normal matrix of a least-squares problem.
+ *
+ * @tparam R number of rows of @p m
+ * @tparam C number of columns of @p m
+ * @tparam T element type
+ */
+template <std::size_t R, std::size_t C, typename T>
+[[nodiscard]]
+constexpr auto gram(mat<R, C, T> const& m) noexcept -> sym_mat<C, T>;
+
+/**
+ * @brief Vector outer product of a vector with itself.
+ *
+ * This calculates @f$ v v^T @f$, e.g. the contribution of a sample to a covariance matrix.
+ */
+template <std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto outer_product(vec<N, T> const& v) noexcept -> sym_mat<N, T>;
+
+/**
+ * @brief Congruence transformation of a symmetric matrix.
+ *
+ * This calculates @f$ A S A^T @f$, e.g. the covariance of a linear transformation of random vectors of covariance @p s,
+ * as propagated by the prediction of a Kalman filter.
+ *
+ * @tparam R number of rows of @p a
+ * @tparam N number of columns of @p a
+ * @tparam T element type
+ */
+template <std::size_t R, std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto congruence(mat<R, N, T> const& a, sym_mat<N, T> const& s) noexcept -> sym_mat<R, T>;
+}
+
+#include "sym.inl"
+
+#endif
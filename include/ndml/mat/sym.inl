@@ -0,0 +1,248 @@
+#include "ndml/math/precision.hpp"
+#include "ndml/meta/unroll.hpp"
+
+#include <algorithm>
+
+namespace ndml
+{
+template <std::size_t N, typename T>
+template <typename FromT>
+constexpr sym_mat<N, T>::sym_mat(FromT const& scale) noexcept
+	requires std::constructible_from<value_type, FromT const&>
+{
+	for (std::size_t i = 0; i < N; ++i)
+	{
+		(*this)[i, i] = static_cast<value_type>(scale);
+	}
+}
+
+template <std::size_t N, typename T>
+constexpr sym_mat<N, T>::sym_mat(mat_type const& m) noexcept
+{
+	std::size_t k = 0;
+	for (std::size_t j = 0; j < N; ++j)
+	{
+		for (std::size_t i = 0; i <= j; ++i)
+		{
+			elements_[k++] = m[j, i];
+		}
+	}
+}
+
+template <std::size_t N, typename T>
+constexpr auto sym_mat<N, T>::operator[](this auto&& self, std::size_t column, std::size_t row) noexcept -> decltype(auto)
+{
+	return self.elements_[index(column, row)];
+}
+
+template <std::size_t N, typename T>
+constexpr auto sym_mat<N, T>::data(this auto&& self) noexcept -> decltype(auto)
+{
+	return self.elements_.data();
+}
+
+template <std::size_t N, typename T>
+constexpr sym_mat<N, T>::operator mat_type(this sym_mat const& self) noexcept
+{
+	mat_type m;
+
+	std::size_t k = 0;
+	for (std::size_t j = 0; j < N; ++j)
+	{
+		for (std::size_t i = 0; i <= j; ++i, ++k)
+		{
+			m[j, i] = self.elements_[k];
+			m[i, j] = self.elements_[k];
+		}
+	}
+
+	return m;
+}
+
+template <std::size_t N, typename T>
+constexpr auto sym_mat<N, T>::index(std::size_t column, std::size_t row) noexcept -> std::size_t
+{
+	auto const [i, j] = std::minmax(column, row);
+
+	return j * (j + 1) / 2 + i;
+}
+
+template <std::size_t N, typename T>
+constexpr auto operator==(sym_mat<N, T> const& lhs, sym_mat<N, T> const& rhs) noexcept -> bool
+{
+	return std::equal(lhs.data(), lhs.data() + lhs.element_count, rhs.data());
+}
+
+template <std::size_t N, typename T>
+constexpr auto operator!=(sym_mat<N, T> const& lhs, sym_mat<N, T> const& rhs) noexcept -> bool
+{
+	return !(lhs == rhs);
+}
+
+template <std::size_t N, typename T>
+constexpr auto operator-(sym_mat<N, T> const& s) noexcept -> sym_mat<N, T>
+{
+	sym_mat<N, T> n;
+	meta::unroll<sym_mat<N, T>::element_count>([&n, &s](auto... k) { ((n.data()[k] = -s.data()[k]), ...); });
+
+	return n;
+}
+
+template <std::size_t N, typename T>
+constexpr auto operator+(sym_mat<N, T> const& lhs, sym_mat<N, T> const& rhs) noexcept -> sym_mat<N, T>
+{
+	auto s = lhs;
+
+	return s += rhs;
+}
+
+template <std::size_t N, typename T>
+constexpr auto operator-(sym_mat<N, T> const& lhs, sym_mat<N, T> const& rhs) noexcept -> sym_mat<N, T>
+{
+	auto s = lhs;
+
+	return s -= rhs;
+}
+
+template <std::size_t N, typename T>
+constexpr auto operator+=(sym_mat<N, T>& lhs, sym_mat<N, T> const& rhs) noexcept -> sym_mat<N, T>&
+{
+	meta::unroll<sym_mat<N, T>::element_count>([&lhs, &rhs](auto... k) { ((lhs.data()[k] += rhs.data()[k]), ...); });
+
+	return lhs;
+}
+
+template <std::size_t N, typename T>
+constexpr auto operator-=(sym_mat<N, T>& lhs, sym_mat<N, T> const& rhs) noexcept -> sym_mat<N, T>&
+{
+	meta::unroll<sym_mat<N, T>::element_count>([&lhs, &rhs](auto... k) { ((lhs.data()[k] -= rhs.data()[k]), ...); });
+
+	return lhs;
+}
+
+template <std::size_t N, typename T>
+constexpr auto operator*(sym_mat<N, T> const& s, typename sym_mat<N, T>::value_type const& scale) noexcept -> sym_mat<N, T>
+{
+	auto p = s;
+
+	return p *= scale;
+}
+
+template <std::size_t N, typename T>
+constexpr auto operator*(typename sym_mat<N, T>::value_type const& scale, sym_mat<N, T> const& s) noexcept -> sym_mat<N, T>
+{
+	return s * scale;
+}
+
+template <std::size_t N, typename T>
+constexpr auto operator*=(sym_mat<N, T>& s, typename sym_mat<N, T>::value_type const& scale) noexcept -> sym_mat<N, T>&
+{
+	meta::unroll<sym_mat<N, T>::element_count>([&s, &scale](auto... k) { ((s.data()[k] *= scale), ...); });
+
+	return s;
+}
+
+template <std::size_t N, typename T>
+constexpr auto operator*(sym_mat<N, T> const& s, vec<N, T> const& v) noexcept -> vec<N, T>
+{
+	// columns are gathered from the upper triangle at compile-time indices, and accumulated as by matrix-vector multiplication
+	auto const column = [&s]<std::size_t J>(meta::index_constant<J>) { return meta::unroll<N>([&s](auto... i) { return vec<N, T>{s[J, i]...}; }); };
+
+	if constexpr (math::widened<T>)
+	{
+		using accumulator_type = math::accumulator_t<T>;
+
+		vec<N, accumulator_type> p;
+		meta::unroll<N>([&p, &v, &column](auto... j) { ((p += vec<N, accumulator_type>{column(j)} * static_cast<accumulator_type>(get<j>(v))), ...); });
+
+		return vec<N, T>{p};
+	}
+	else
+	{
+		vec<N, T> p;
+		meta::unroll<N>([&p, &v, &column](auto... j) { ((p += column(j) * get<j>(v)), ...); });
+
+		return p;
+	}
+}
+
+template <std::size_t N, std::size_t K, typename T>
+constexpr auto operator*(sym_mat<N, T> const& s, mat<N, K, T> const& m) noexcept -> mat<N, K, T>
+{
+	mat<N, K, T> p;
+	for (std::size_t j = 0; j < K; ++j)
+	{
+		p[j] = s * m[j];
+	}
+
+	return p;
+}
+
+template <std::size_t N, typename T>
+constexpr auto trace(sym_mat<N, T> const& s) noexcept -> sym_mat<N, T>::value_type
+{
+	return meta::unroll<N>([&s](auto... i) { return (s[i, i] + ...); });
+}
+
+template <std::size_t R, std::size_t C, typename T>
+constexpr auto gram(mat<R, C, T> const& m) noexcept -> sym_mat<C, T>
+{
+	sym_mat<C, T> g;
+
+	auto* e = g.data();
+	for (std::size_t j = 0; j < C; ++j)
+	{
+		for (std::size_t i = 0; i <= j; ++i)
+		{
+			*e++ = dot(m[i], m[j]);
+		}
+	}
+
+	return g;
+}
+
+template <std::size_t N, typename T>
+constexpr auto outer_product(vec<N, T> const& v) noexcept -> sym_mat<N, T>
+{
+	sym_mat<N, T> s;
+
+	auto* e = s.data();
+	for (std::size_t j = 0; j < N; ++j)
+	{
+		for (std::size_t i = 0; i <= j; ++i)
+		{
+			*e++ = v[i] * v[j];
+		}
+	}
+
+	return s;
+}
+
+template <std::size_t R, std::size_t N, typename T>
+constexpr auto congruence(mat<R, N, T> const& a, sym_mat<N, T> const& s) noexcept -> sym_mat<R, T>
+{
+	using accumulator_type = math::accumulator_t<T>;
+
+	// columns of S A^T, the dot products of rows of A with which are the elements of A S A^T
+	auto const t = s * transpose(a);
+
+	sym_mat<R, T> c;
+
+	auto* e = c.data();
+	for (std::size_t j = 0; j < R; ++j)
+	{
+		for (std::size_t i = 0; i <= j; ++i)
+		{
+			accumulator_type sum{0};
+			for (std::size_t k = 0; k < N; ++k)
+			{
+				sum += static_cast<accumulator_type>(a[k, i]) * static_cast<accumulator_type>(t[j, k]);
+			}
+
+			*e++ = static_cast<T>(sum);
+		}
+	}
+
+	return c;
+}
+}
@@ -3,6 +3,10 @@
 
 #include "mat.hpp"
 
+#include "ndml/math/policy.hpp"
+
+#include <concepts>
+
 namespace ndml
 {
 /**
@@ -76,14 +80,16 @@ constexpr auto translation(vec<N, T> const& v) noexcept -> mat<N + 1, N + 1, T>;
  * gives a vector @c u rotated @c angle radians in the two-dimensional Cartesian plane.
  *
  * @tparam T element type
+ * @tparam P math policy of sine and cosine calculation
  *
- * @param angle angle in radians
+ * @param angle  angle in radians
+ * @param policy math policy of sine and cosine calculation
  *
  * @return the two-dimensional rotation by angle @p angle matrix
  */
-template <typename T>
+template <typename T, math::policy P = math::default_policy>
 [[nodiscard]]
-constexpr auto rotation(T const& angle) noexcept -> mat<3, 3, T>;
+constexpr auto rotation(T const& angle, P policy = P{}) noexcept -> mat<3, 3, T>;
 
 /**
  * @brief Three-dimensional rotation matrix.
@@ -92,15 +98,40 @@ constexpr auto rotation(T const& angle) noexcept -> mat<3, 3, T>;
  * gives a vector @c u rotated @c angle radians along the axis @p axis.
  *
  * @tparam T element type
+ * @tparam P math policy of sine and cosine calculation
  *
- * @param axis  rotation axis
- * @param angle angle in radians
+ * @param axis   rotation axis
+ * @param angle  angle in radians
+ * @param policy math policy of sine and cosine calculation
  *
  * @return the three-dimensional rotation by angle @p angle along axis @p axis matrix
  */
+template <typename T, math::policy P = math::default_policy>
+[[nodiscard]]
+constexpr auto rotation(vec<3, T> const& axis, typename vec<3, T>::value_type const& angle, P policy = P{}) noexcept -> mat<4, 4, T>;
+
+/**
+ * @brief Three-dimensional rotation matrix from precomputed sine and cosine.
+ *
+ * This calculates the same matrix as @c rotation(axis, angle) given @p sin_angle and @p cos_angle
+ * equal to the sine and cosine of the angle, so that rotations by the same angle along different axes
+ * do not repeat the trigonometry.
+ *
+ * @tparam T element type
+ *
+ * @param axis      rotation axis
+ * @param sin_angle sine of the angle
+ * @param cos_angle cosine of the angle
+ *
+ * @return the three-dimensional rotation along axis @p axis matrix
+ */
 template <typename T>
 [[nodiscard]]
-constexpr auto rotation(vec<3, T> const& axis, typename vec<3, T>::value_type const& angle) noexcept -> mat<4, 4, T>;
+constexpr auto rotation(
+	vec<3, T> const&                      axis,
+	typename vec<3, T>::value_type const& sin_angle,
+	typename vec<3, T>::value_type const& cos_angle
+) noexcept -> mat<4, 4, T>;
 
 /**
  * @brief Look-at matrix.
@@ -147,17 +178,39 @@ constexpr auto ortho(T const& left, T const& right, T const& bottom, T const& up
  * given a vertical FOV and aspect ratio.
  *
  * @tparam T element type
+ * @tparam P math policy of tangent calculation
  *
  * @param vertical_fov vertical field of view in radians
  * @param aspect_ratio width to height ratio
  * @param near         near plane depth
  * @param far          far plane depth
+ * @param policy       math policy of tangent calculation
  *
  * @return perspective projection matrix
  */
-template <typename T>
+template <typename T, math::policy P = math::default_policy>
+[[nodiscard]]
+constexpr auto perspective(T const& vertical_fov, T const& aspect_ratio, T const& near, T const& far, P policy = P{}) noexcept -> mat<4, 4, T>;
+
+/**
+ * @brief Composition of transformations.
+ *
+ * This calculates the product of @p first and @p rest in order, i.e. the transformation applying the last of them first.
+ * As all of the transformations are usable in constant expressions, so is their composition, which therefore folds a chain
+ * of transformations known at compile time into a single constant, e.g.
+ * @code
+ * constexpr auto model = compose(translation(position), rotation(axis, angle), scale(size));
+ * @endcode
+ *
+ * @tparam M  transformation type, e.g. @c mat, @c affine, @c quat, or @c dual_quat
+ * @tparam Ms types of the rest of transformations, all equal to @p M
+ */
+template <typename M, typename... Ms>
 [[nodiscard]]
-constexpr auto perspective(T const& vertical_fov, T const& aspect_ratio, T const& near, T const& far) noexcept -> mat<4, 4, T>;
+constexpr auto compose(M const& first, Ms const&... rest) noexcept -> M
+	requires (std::same_as<Ms, M> && ...) && requires(M const& m) {
+		{ m * m } -> std::convertible_to<M>;
+	};
 }
 
 #include "transform.inl"
@@ -1,4 +1,5 @@
-#include <cmath>
+#include "ndml/instrument/zone.hpp"
+#include "ndml/math/function.hpp"
 
 namespace ndml
 {
@@ -59,11 +60,12 @@ constexpr auto translation(vec<N, T> const& v) noexcept -> mat<N + 1, N + 1, T>
 	return t;
 }
 
-template <typename T>
-constexpr auto rotation(T const& angle) noexcept -> mat<3, 3, T>
+template <typename T, math::policy P>
+constexpr auto rotation(T const& angle, P policy) noexcept -> mat<3, 3, T>
 {
-	auto const cos_angle = static_cast<T>(std::cos(angle));
-	auto const sin_angle = static_cast<T>(std::sin(angle));
+	NDML_INSTRUMENT_ZONE(rotation);
+
+	auto const [sin_angle, cos_angle] = math::sin_cos(angle, policy);
 
 	return {
 		vec{ cos_angle, sin_angle, T{0}},
@@ -72,22 +74,54 @@ constexpr auto rotation(T const& angle) noexcept -> mat<3, 3, T>
 	};
 }
 
+template <typename T, math::policy P>
+constexpr auto rotation(vec<3, T> const& axis, typename vec<3, T>::value_type const& angle, P policy) noexcept -> mat<4, 4, T>
+{
+	auto const [sin_angle, cos_angle] = math::sin_cos(angle, policy);
+	return rotation(axis, sin_angle, cos_angle);
+}
+
 template <typename T>
-constexpr auto rotation(vec<3, T> const& axis, typename vec<3, T>::value_type const& angle) noexcept -> mat<4, 4, T>
+constexpr auto rotation(
+	vec<3, T> const&                      axis,
+	typename vec<3, T>::value_type const& sin_angle,
+	typename vec<3, T>::value_type const& cos_angle
+) noexcept -> mat<4, 4, T>
 {
-	auto const cos_angle = std::cos(angle);
-	auto const sin_angle = std::sin(angle);
-	auto const cross     = cross_matrix(axis);
+	NDML_INSTRUMENT_ZONE(rotation);
 
-	mat<4, 4, T> r{mat<3, 3, T>{1} + (T{1} - cos_angle) * cross * cross + sin_angle * cross};
-	r[3, 3] = T{1};
+	// entries of I + (1 - cos) K^2 + sin K, where K is the cross matrix of the axis
+	auto const t = T{1} - cos_angle;
 
-	return r;
+	auto const x = axis.x;
+	auto const y = axis.y;
+	auto const z = axis.z;
+
+	auto const tx = t * x;
+	auto const ty = t * y;
+	auto const tz = t * z;
+
+	auto const txy = tx * y;
+	auto const txz = tx * z;
+	auto const tyz = ty * z;
+
+	auto const sx = sin_angle * x;
+	auto const sy = sin_angle * y;
+	auto const sz = sin_angle * z;
+
+	return {
+		vec<4, T>{T{1} - (ty * y + tz * z),                 txy + sz,                 txz - sy, T{0}},
+		vec<4, T>{                txy - sz, T{1} - (tx * x + tz * z),                 tyz + sx, T{0}},
+		vec<4, T>{                txz + sy,                 tyz - sx, T{1} - (tx * x + ty * y), T{0}},
+		vec<4, T>{                    T{0},                     T{0},                     T{0}, T{1}},
+	};
 }
 
 template <typename T>
 constexpr auto look_at(vec<3, T> const& eye, vec<3, T> const& target, vec<3, T> const& up) noexcept -> mat<4, 4, T>
 {
+	NDML_INSTRUMENT_ZONE(look_at);
+
 	auto const f{normal(target - eye)};
 	auto const r{normal(cross(f, up))};
 	auto const u{cross(r, f)};
@@ -103,6 +137,8 @@ constexpr auto look_at(vec<3, T> const& eye, vec<3, T> const& target, vec<3, T>
 template <typename T>
 constexpr auto ortho(T const& left, T const& right, T const& bottom, T const& up, T const& near, T const& far) noexcept -> mat<4, 4, T>
 {
+	NDML_INSTRUMENT_ZONE(ortho);
+
 	auto const dx{right - left};
 	auto const dy{up - bottom};
 	auto const dz{far - near};
@@ -115,10 +151,12 @@ constexpr auto ortho(T const& left, T const& right, T const& bottom, T const& up
 	};
 }
 
-template <typename T>
-constexpr auto perspective(T const& vertical_fov, T const& aspect_ratio, T const& near, T const& far) noexcept -> mat<4, 4, T>
+template <typename T, math::policy P>
+constexpr auto perspective(T const& vertical_fov, T const& aspect_ratio, T const& near, T const& far, P policy) noexcept -> mat<4, 4, T>
 {
-	T const tan_half_fov{std::tan(vertical_fov / T{2})};
+	NDML_INSTRUMENT_ZONE(perspective);
+
+	T const tan_half_fov{math::tan(vertical_fov / T{2}, policy)};
 
 	auto const dx{tan_half_fov * aspect_ratio};
 	auto const dy{tan_half_fov};
@@ -131,4 +169,13 @@ constexpr auto perspective(T const& vertical_fov, T const& aspect_ratio, T const
 		vec{     T{0},      T{0}, -T{2} * far * near / dz,  T{0}},
 	};
 }
+
+template <typename M, typename... Ms>
+constexpr auto compose(M const& first, Ms const&... rest) noexcept -> M
+	requires (std::same_as<Ms, M> && ...) && requires(M const& m) {
+		{ m * m } -> std::convertible_to<M>;
+	}
+{
+	return (first * ... * rest);
+}
 }
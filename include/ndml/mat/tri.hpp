@@ -0,0 +1,211 @@
+#ifndef NDML_MAT_TRI_HPP
+#define NDML_MAT_TRI_HPP
+
+#include "mat.hpp"
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+
+namespace ndml
+{
+/**
+ * @brief Triangle of a matrix.
+ */
+enum class triangular
+{
+	/// Elements on and below the main diagonal.
+	lower,
+
+	/// Elements on and above the main diagonal.
+	upper,
+};
+
+/**
+ * @brief Triangular matrix.
+ *
+ * Only the triangle @p Part of the matrix is stored, packed, the other elements being zero,
+ * so that it occupies @f$ \frac {N (N + 1)} 2 @f$ rather than @f$ N^2 @f$ elements.
+ * Multiplications skip the zero elements, and systems of linear equations are solved by a single substitution.
+ *
+ * @tparam N    number of rows and columns
+ * @tparam T    element type
+ * @tparam Part stored triangle
+ *
+ * @note Lower triangular matrices are packed row by row, and upper ones column by column,
+ *       so that the transpose of either is stored as the original, and both are traversed contiguously
+ *       by forward and backward substitution.
+ *
+ * @sa ndml::lower_mat
+ * @sa ndml::upper_mat
+ */
+template <std::size_t N, typename T, triangular Part>
+struct tri_mat
+{
+	static_assert(N > 0);
+
+	using mat_type   = mat<N, N, T>;
+	using vec_type   = vec<N, T>;
+	using value_type = T;
+
+	/**
+	 * @brief Number of rows and columns.
+	 */
+	static constexpr auto dimension = N;
+
+	/**
+	 * @brief Stored triangle.
+	 */
+	static constexpr auto part = Part;
+
+	/**
+	 * @brief Number of stored elements.
+	 */
+	static constexpr auto element_count = N * (N + 1) / 2;
+
+	/**
+	 * @brief Default constructor.
+	 *
+	 * Elements are value-initialized, i.e. the matrix will be equal to the zero matrix.
+	 */
+	constexpr tri_mat() noexcept = default;
+
+	/**
+	 * @brief Constructor from scale.
+	 *
+	 * This will initialize all entries along the main diagonal to @p scale.
+	 */
+	template <typename FromT>
+	constexpr explicit tri_mat(FromT const& scale) noexcept
+		requires std::constructible_from<value_type, FromT const&>;
+
+	/**
+	 * @brief Constructor from a matrix.
+	 *
+	 * This will initialize the matrix to the triangle @p Part of @p m, discarding the other elements.
+	 */
+	constexpr explicit tri_mat(mat_type const& m) noexcept;
+
+	/**
+	 * @brief Element subscript operator.
+	 *
+	 * This retrieves the element at the intersection of column @p column and row @p row.
+	 *
+	 * @warning Behavior is undefined when @p column >= @p N or @p row >= @p N, or the element is not of the triangle @p Part.
+	 */
+	[[nodiscard]]
+	constexpr auto operator[](this auto&& self, std::size_t column, std::size_t row) noexcept -> decltype(auto);
+
+	/**
+	 * @brief Pointer to the stored elements.
+	 *
+	 * This retrieves the pointer to the first of the @c element_count stored elements, laid out contiguously.
+	 */
+	[[nodiscard]]
+	constexpr auto data(this auto&& self) noexcept -> decltype(auto);
+
+	/**
+	 * @brief Conversion to a matrix.
+	 *
+	 * This expands the matrix to all of its @f$ N^2 @f$ elements.
+	 */
+	[[nodiscard]]
+	constexpr explicit operator mat_type(this tri_mat const& self) noexcept;
+
+protected:
+	/**
+	 * @brief Index of the stored element at the intersection of column @p column and row @p row.
+	 */
+	[[nodiscard]]
+	static constexpr auto index(std::size_t column, std::size_t row) noexcept -> std::size_t;
+
+	/// Elements of the triangle, packed.
+	std::array<value_type, element_count> elements_{};
+};
+
+/**
+ * @brief Lower triangular matrix.
+ */
+template <std::size_t N, typename T>
+using lower_mat = tri_mat<N, T, triangular::lower>;
+
+/**
+ * @brief Upper triangular matrix.
+ */
+template <std::size_t N, typename T>
+using upper_mat = tri_mat<N, T, triangular::upper>;
+
+/**
+ * @brief Comparison operators.
+ */
+template <std::size_t N, typename T, triangular Part>
+[[nodiscard]]
+constexpr auto operator==(tri_mat<N, T, Part> const& lhs, tri_mat<N, T, Part> const& rhs) noexcept -> bool;
+
+template <std::size_t N, typename T, triangular Part>
+[[nodiscard]]
+constexpr auto operator!=(tri_mat<N, T, Part> const& lhs, tri_mat<N, T, Part> const& rhs) noexcept -> bool;
+
+/**
+ * @brief The transpose of a triangular matrix.
+ *
+ * This is a triangular matrix of the other triangle, the stored elements of which are the same.
+ */
+template <std::size_t N, typename T, triangular Part>
+[[nodiscard]]
+constexpr auto transpose(tri_mat<N, T, Part> const& t) noexcept -> tri_mat<N, T, Part == triangular::lower ? triangular::upper : triangular::lower>;
+
+/**
+ * @brief The determinant of a triangular matrix.
+ *
+ * This calculates the product of the main diagonal.
+ */
+template <std::size_t N, typename T, triangular Part>
+[[nodiscard]]
+constexpr auto determinant(tri_mat<N, T, Part> const& t) noexcept -> tri_mat<N, T, Part>::value_type;
+
+/**
+ * @brief Triangular matrix-vector multiplication operator.
+ *
+ * This multiplies the stored elements only, i.e. about half as many as a matrix-vector multiplication.
+ */
+template <std::size_t N, typename T, triangular Part>
+[[nodiscard]]
+constexpr auto operator*(tri_mat<N, T, Part> const& t, vec<N, T> const& v) noexcept -> vec<N, T>;
+
+/**
+ * @brief Triangular matrix-matrix multiplication operator.
+ *
+ * This multiplies @p t by each column of @p m.
+ */
+template <std::size_t N, std::size_t K, typename T, triangular Part>
+[[nodiscard]]
+constexpr auto operator*(tri_mat<N, T, Part> const& t, mat<N, K, T> const& m) noexcept -> mat<N, K, T>;
+
+/**
+ * @brief Solution of a triangular system of linear equations.
+ *
+ * This calculates @f$ x @f$ such that @f$ T x = b @f$ by forward substitution for lower triangular matrices,
+ * and by backward substitution for upper ones, in @f$ O(N^2) @f$.
+ *
+ * @warning Behavior is undefined if any element of the main diagonal of @p t is zero.
+ */
+template <std::size_t N, typename T, triangular Part>
+[[nodiscard]]
+constexpr auto solve(tri_mat<N, T, Part> const& t, vec<N, T> const& b) noexcept -> vec<N, T>;
+
+/**
+ * @brief Solution of a triangular system of linear equations with multiple right-hand sides.
+ *
+ * This calculates @f$ X @f$ such that @f$ T X = B @f$, solving for each column of @p b.
+ *
+ * @warning Behavior is undefined if any element of the main diagonal of @p t is zero.
+ */
+template <std::size_t N, std::size_t K, typename T, triangular Part>
+[[nodiscard]]
+constexpr auto solve(tri_mat<N, T, Part> const& t, mat<N, K, T> const& b) noexcept -> mat<N, K, T>;
+}
+
+#include "tri.inl"
+
+#endif
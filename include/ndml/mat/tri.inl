@@ -0,0 +1,175 @@
+#include "ndml/math/precision.hpp"
+#include "ndml/meta/unroll.hpp"
+
+#include <algorithm>
+
+namespace ndml
+{
+template <std::size_t N, typename T, triangular Part>
+template <typename FromT>
+constexpr tri_mat<N, T, Part>::tri_mat(FromT const& scale) noexcept
+	requires std::constructible_from<value_type, FromT const&>
+{
+	for (std::size_t i = 0; i < N; ++i)
+	{
+		(*this)[i, i] = static_cast<value_type>(scale);
+	}
+}
+
+template <std::size_t N, typename T, triangular Part>
+constexpr tri_mat<N, T, Part>::tri_mat(mat_type const& m) noexcept
+{
+	for (std::size_t j = 0; j < N; ++j)
+	{
+		for (std::size_t i = 0; i <= j; ++i)
+		{
+			if constexpr (Part == triangular::lower)
+			{
+				(*this)[i, j] = m[i, j];
+			}
+			else
+			{
+				(*this)[j, i] = m[j, i];
+			}
+		}
+	}
+}
+
+template <std::size_t N, typename T, triangular Part>
+constexpr auto tri_mat<N, T, Part>::operator[](this auto&& self, std::size_t column, std::size_t row) noexcept -> decltype(auto)
+{
+	return self.elements_[index(column, row)];
+}
+
+template <std::size_t N, typename T, triangular Part>
+constexpr auto tri_mat<N, T, Part>::data(this auto&& self) noexcept -> decltype(auto)
+{
+	return self.elements_.data();
+}
+
+template <std::size_t N, typename T, triangular Part>
+constexpr tri_mat<N, T, Part>::operator mat_type(this tri_mat const& self) noexcept
+{
+	mat_type m;
+
+	for (std::size_t j = 0; j < N; ++j)
+	{
+		for (std::size_t i = 0; i <= j; ++i)
+		{
+			if constexpr (Part == triangular::lower)
+			{
+				m[i, j] = self[i, j];
+			}
+			else
+			{
+				m[j, i] = self[j, i];
+			}
+		}
+	}
+
+	return m;
+}
+
+template <std::size_t N, typename T, triangular Part>
+constexpr auto tri_mat<N, T, Part>::index(std::size_t column, std::size_t row) noexcept -> std::size_t
+{
+	// rows of lower triangles are packed as columns of upper ones
+	auto const [i, j] = std::minmax(column, row);
+
+	return j * (j + 1) / 2 + i;
+}
+
+template <std::size_t N, typename T, triangular Part>
+constexpr auto operator==(tri_mat<N, T, Part> const& lhs, tri_mat<N, T, Part> const& rhs) noexcept -> bool
+{
+	return std::equal(lhs.data(), lhs.data() + lhs.element_count, rhs.data());
+}
+
+template <std::size_t N, typename T, triangular Part>
+constexpr auto operator!=(tri_mat<N, T, Part> const& lhs, tri_mat<N, T, Part> const& rhs) noexcept -> bool
+{
+	return !(lhs == rhs);
+}
+
+template <std::size_t N, typename T, triangular Part>
+constexpr auto transpose(tri_mat<N, T, Part> const& t) noexcept -> tri_mat<N, T, Part == triangular::lower ? triangular::upper : triangular::lower>
+{
+	tri_mat<N, T, Part == triangular::lower ? triangular::upper : triangular::lower> u;
+	std::copy(t.data(), t.data() + t.element_count, u.data());
+
+	return u;
+}
+
+template <std::size_t N, typename T, triangular Part>
+constexpr auto determinant(tri_mat<N, T, Part> const& t) noexcept -> tri_mat<N, T, Part>::value_type
+{
+	return meta::unroll<N>([&t](auto... i) { return (t[i, i] * ...); });
+}
+
+template <std::size_t N, typename T, triangular Part>
+constexpr auto operator*(tri_mat<N, T, Part> const& t, vec<N, T> const& v) noexcept -> vec<N, T>
+{
+	using accumulator_type = math::accumulator_t<T>;
+
+	// each component is the dot product of the stored part of its row with the vector
+	auto const component = [&t, &v]<std::size_t I>(meta::index_constant<I>) {
+		constexpr std::size_t first = Part == triangular::lower ? 0 : I;
+		constexpr std::size_t last  = Part == triangular::lower ? I : N - 1;
+
+		return static_cast<T>(meta::unroll<last - first + 1>([&t, &v](auto... k) {
+			return ((static_cast<accumulator_type>(t[first + k, I]) * static_cast<accumulator_type>(get<first + k>(v))) + ...);
+		}));
+	};
+
+	return meta::unroll<N>([&component](auto... i) { return vec<N, T>{component(i)...}; });
+}
+
+template <std::size_t N, std::size_t K, typename T, triangular Part>
+constexpr auto operator*(tri_mat<N, T, Part> const& t, mat<N, K, T> const& m) noexcept -> mat<N, K, T>
+{
+	mat<N, K, T> p;
+	for (std::size_t j = 0; j < K; ++j)
+	{
+		p[j] = t * m[j];
+	}
+
+	return p;
+}
+
+template <std::size_t N, typename T, triangular Part>
+constexpr auto solve(tri_mat<N, T, Part> const& t, vec<N, T> const& b) noexcept -> vec<N, T>
+{
+	using accumulator_type = math::accumulator_t<T>;
+
+	auto x = meta::unroll<N>([&b](auto... i) { return std::array<accumulator_type, N>{static_cast<accumulator_type>(get<i>(b))...}; });
+
+	// components are solved for from the first row for lower triangular matrices, and from the last one for upper ones,
+	// each after subtracting the products of the other elements of its row with the components already solved for
+	auto const step = [&t, &x]<std::size_t K>(meta::index_constant<K>) {
+		constexpr auto i     = Part == triangular::lower ? K : N - 1 - K;
+		[[maybe_unused]] constexpr auto first = Part == triangular::lower ? 0 : i + 1;
+
+		auto const sum = meta::unroll<K>([&t, &x](auto... k) {
+			return (accumulator_type{0} + ... + (static_cast<accumulator_type>(t[first + k, i]) * x[first + k]));
+		});
+
+		x[i] = (x[i] - sum) / static_cast<accumulator_type>(t[i, i]);
+	};
+
+	meta::unroll<N>([&step](auto... k) { (step(k), ...); });
+
+	return meta::unroll<N>([&x](auto... i) { return vec<N, T>{static_cast<T>(x[i])...}; });
+}
+
+template <std::size_t N, std::size_t K, typename T, triangular Part>
+constexpr auto solve(tri_mat<N, T, Part> const& t, mat<N, K, T> const& b) noexcept -> mat<N, K, T>
+{
+	mat<N, K, T> x;
+	for (std::size_t j = 0; j < K; ++j)
+	{
+		x[j] = solve(t, b[j]);
+	}
+
+	return x;
+}
+}
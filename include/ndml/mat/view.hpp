@@ -0,0 +1,270 @@
+#ifndef NDML_MAT_VIEW_HPP
+#define NDML_MAT_VIEW_HPP
+
+#include "mat.hpp"
+
+#include "ndml/vec/view.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+
+namespace ndml
+{
+/**
+ * @brief Non-owning strided view of a matrix.
+ *
+ * It refers to @p R by @p C elements of an external buffer, element at column @c c and row @c r being
+ * @c c * column_stride() + r * row_stride() elements past the first one, similarly to @c std::mdspan with @c std::layout_stride.
+ * Operations on matrices accept views in place of matrices, so that such buffers are operated on without staging copies.
+ *
+ * @tparam R number of rows
+ * @tparam C number of columns
+ * @tparam T element type, const-qualified for read-only views
+ */
+template <std::size_t R, std::size_t C, typename T>
+struct mat_view
+{
+	static_assert(R > 0 && C > 0);
+
+	using element_type = T;
+	using value_type   = std::remove_cv_t<T>;
+	using mat_type     = mat<R, C, value_type>;
+	using column_type  = vec_view<R, element_type>;
+
+	/**
+	 * @brief Number of rows.
+	 */
+	static constexpr auto row_count = R;
+
+	/**
+	 * @brief Number of columns.
+	 */
+	static constexpr auto column_count = C;
+
+	/**
+	 * @brief Default constructor.
+	 *
+	 * The view refers to no elements, and it is undefined behavior to access them.
+	 */
+	constexpr mat_view() noexcept = default;
+
+	/**
+	 * @brief Constructor from a pointer and strides.
+	 *
+	 * The default strides describe contiguous column-major elements.
+	 *
+	 * @param data          pointer to the element at the intersection of the first column and the first row
+	 * @param column_stride distance between consecutive columns, in elements
+	 * @param row_stride    distance between consecutive rows, in elements
+	 */
+	constexpr explicit mat_view(element_type* data, std::ptrdiff_t column_stride = R, std::ptrdiff_t row_stride = 1) noexcept;
+
+	/**
+	 * @brief Constructor from a matrix.
+	 *
+	 * The view refers to the elements of @p m.
+	 */
+	constexpr mat_view(mat_type& m) noexcept;
+
+	/**
+	 * @brief Constructor from a constant matrix.
+	 *
+	 * The view refers to the elements of @p m.
+	 */
+	constexpr mat_view(mat_type const& m) noexcept
+		requires std::is_const_v<element_type>;
+
+	/**
+	 * @brief Converting constructor from a view of mutable elements.
+	 */
+	template <typename FromT>
+	constexpr mat_view(mat_view<R, C, FromT> const& v) noexcept
+		requires (!std::same_as<FromT, element_type> && std::convertible_to<FromT (*)[], element_type (*)[]>);
+
+	/**
+	 * @brief Size of view.
+	 *
+	 * @return the number of columns
+	 */
+	[[nodiscard]]
+	static consteval auto size() noexcept -> std::size_t;
+
+	/**
+	 * @brief Distance between consecutive columns, in elements.
+	 */
+	[[nodiscard]]
+	constexpr auto column_stride(this mat_view const& self) noexcept -> std::ptrdiff_t;
+
+	/**
+	 * @brief Distance between consecutive rows, in elements.
+	 */
+	[[nodiscard]]
+	constexpr auto row_stride(this mat_view const& self) noexcept -> std::ptrdiff_t;
+
+	/**
+	 * @brief Pointer to the element at the intersection of the first column and the first row.
+	 */
+	[[nodiscard]]
+	constexpr auto data(this mat_view const& self) noexcept -> element_type*;
+
+	/**
+	 * @brief Column subscript operator.
+	 *
+	 * This retrieves a view of the column at index @p column.
+	 *
+	 * @warning Behavior is undefined when @p column >= @p C.
+	 */
+	[[nodiscard]]
+	constexpr auto operator[](this mat_view const& self, std::size_t column) noexcept -> column_type;
+
+	/**
+	 * @brief Element subscript operator.
+	 *
+	 * This retrieves the element at the intersection of column @p column and row @p row.
+	 *
+	 * @warning Behavior is undefined when @p column >= @p C or @p row >= @p R.
+	 */
+	[[nodiscard]]
+	constexpr auto operator[](this mat_view const& self, std::size_t column, std::size_t row) noexcept -> element_type&;
+
+	/**
+	 * @brief Copy of the viewed elements.
+	 */
+	[[nodiscard]]
+	constexpr auto load(this mat_view const& self) noexcept -> mat_type;
+
+	/**
+	 * @brief Stores elements of @p m to the viewed ones.
+	 */
+	constexpr auto store(this mat_view const& self, mat_type const& m) noexcept -> void
+		requires (!std::is_const_v<element_type>);
+
+private:
+	/// Pointer to the first element.
+	element_type* data_{};
+
+	/// Distance between consecutive columns.
+	std::ptrdiff_t column_stride_{R};
+
+	/// Distance between consecutive rows.
+	std::ptrdiff_t row_stride_{1};
+};
+
+template <std::size_t R, std::size_t C, typename T>
+mat_view(mat<R, C, T>&) -> mat_view<R, C, T>;
+
+template <std::size_t R, std::size_t C, typename T>
+mat_view(mat<R, C, T> const&) -> mat_view<R, C, T const>;
+
+namespace detail
+{
+/**
+ * @brief Dimensions and element type of a matrix or of a matrix view.
+ */
+template <typename M>
+struct matrix_traits
+{
+};
+
+template <std::size_t R, std::size_t C, typename T>
+struct matrix_traits<mat<R, C, T>>
+{
+	static constexpr auto rows    = R;
+	static constexpr auto columns = C;
+
+	using value_type = T;
+	using view       = std::false_type;
+};
+
+template <std::size_t R, std::size_t C, typename T>
+struct matrix_traits<mat_view<R, C, T>>
+{
+	static constexpr auto rows    = R;
+	static constexpr auto columns = C;
+
+	using value_type = std::remove_cv_t<T>;
+	using view       = std::true_type;
+};
+
+/**
+ * @brief Matrix itself.
+ */
+template <std::size_t R, std::size_t C, typename T>
+constexpr auto load(mat<R, C, T> const& m) noexcept -> mat<R, C, T> const&
+{
+	return m;
+}
+
+/**
+ * @brief Copy of the elements viewed by @p m.
+ */
+template <std::size_t R, std::size_t C, typename T>
+constexpr auto load(mat_view<R, C, T> const& m) noexcept -> mat<R, C, std::remove_cv_t<T>>
+{
+	return m.load();
+}
+
+/**
+ * @brief Type of the product of a matrix or a matrix view by a matrix, a vector, or a view of either.
+ */
+template <typename L, typename R>
+struct product
+{
+};
+
+template <typename L, typename R>
+	requires requires { matrix_traits<L>::rows, matrix_traits<R>::rows; }
+struct product<L, R>
+{
+	using type = mat<matrix_traits<L>::rows, matrix_traits<R>::columns, typename matrix_traits<L>::value_type>;
+};
+
+template <typename L, typename R>
+	requires requires { matrix_traits<L>::rows, vector_traits<R>::size; }
+struct product<L, R>
+{
+	using type = vec<matrix_traits<L>::rows, typename matrix_traits<L>::value_type>;
+};
+
+template <typename L, typename R>
+using product_t = product<std::remove_cvref_t<L>, std::remove_cvref_t<R>>::type;
+
+/**
+ * @brief Whether @p L and @p R are operands of a matrix product at least one of which is a view.
+ */
+template <typename L, typename R>
+inline constexpr bool is_viewed_product = false;
+
+template <typename L, typename R>
+	requires requires { matrix_traits<L>::rows, matrix_traits<R>::rows; }
+inline constexpr bool is_viewed_product<L, R> = (matrix_traits<L>::view::value || matrix_traits<R>::view::value)
+	&& matrix_traits<L>::columns == matrix_traits<R>::rows
+	&& std::same_as<typename matrix_traits<L>::value_type, typename matrix_traits<R>::value_type>;
+
+template <typename L, typename R>
+	requires requires { matrix_traits<L>::rows, vector_traits<R>::size; }
+inline constexpr bool is_viewed_product<L, R> = (matrix_traits<L>::view::value || vector_traits<R>::view::value)
+	&& matrix_traits<L>::columns == vector_traits<R>::size
+	&& std::same_as<typename matrix_traits<L>::value_type, typename vector_traits<R>::value_type>;
+}
+
+/**
+ * @brief Matrix or matrix view.
+ */
+template <typename M>
+concept matrix_like = requires { detail::matrix_traits<std::remove_cvref_t<M>>::rows; };
+
+/**
+ * @brief Operands of a matrix product at least one of which is a view.
+ *
+ * The left operand must be a matrix or a matrix view, and the right one either a matrix, a vector, or a view of either,
+ * the number of columns of the former agreeing with the number of rows of the latter. Both must be of the same element type.
+ */
+template <typename L, typename R>
+concept viewed_product = detail::is_viewed_product<std::remove_cvref_t<L>, std::remove_cvref_t<R>>;
+}
+
+#include "view.inl"
+
+#endif
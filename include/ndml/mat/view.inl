@@ -0,0 +1,82 @@
+#include "ndml/meta/unroll.hpp"
+
+namespace ndml
+{
+template <std::size_t R, std::size_t C, typename T>
+constexpr mat_view<R, C, T>::mat_view(element_type* data, std::ptrdiff_t column_stride, std::ptrdiff_t row_stride) noexcept
+	: data_{data}
+	, column_stride_{column_stride}
+	, row_stride_{row_stride}
+{
+}
+
+template <std::size_t R, std::size_t C, typename T>
+constexpr mat_view<R, C, T>::mat_view(mat_type& m) noexcept
+	: mat_view{m.data()}
+{
+}
+
+template <std::size_t R, std::size_t C, typename T>
+constexpr mat_view<R, C, T>::mat_view(mat_type const& m) noexcept
+	requires std::is_const_v<element_type>
+	: mat_view{m.data()}
+{
+}
+
+template <std::size_t R, std::size_t C, typename T>
+template <typename FromT>
+constexpr mat_view<R, C, T>::mat_view(mat_view<R, C, FromT> const& v) noexcept
+	requires (!std::same_as<FromT, element_type> && std::convertible_to<FromT (*)[], element_type (*)[]>)
+	: mat_view{v.data(), v.column_stride(), v.row_stride()}
+{
+}
+
+template <std::size_t R, std::size_t C, typename T>
+consteval auto mat_view<R, C, T>::size() noexcept -> std::size_t
+{
+	return C;
+}
+
+template <std::size_t R, std::size_t C, typename T>
+constexpr auto mat_view<R, C, T>::column_stride(this mat_view const& self) noexcept -> std::ptrdiff_t
+{
+	return self.column_stride_;
+}
+
+template <std::size_t R, std::size_t C, typename T>
+constexpr auto mat_view<R, C, T>::row_stride(this mat_view const& self) noexcept -> std::ptrdiff_t
+{
+	return self.row_stride_;
+}
+
+template <std::size_t R, std::size_t C, typename T>
+constexpr auto mat_view<R, C, T>::data(this mat_view const& self) noexcept -> element_type*
+{
+	return self.data_;
+}
+
+template <std::size_t R, std::size_t C, typename T>
+constexpr auto mat_view<R, C, T>::operator[](this mat_view const& self, std::size_t column) noexcept -> column_type
+{
+	return column_type{self.data_ + static_cast<std::ptrdiff_t>(column) * self.column_stride_, self.row_stride_};
+}
+
+template <std::size_t R, std::size_t C, typename T>
+constexpr auto mat_view<R, C, T>::operator[](this mat_view const& self, std::size_t column, std::size_t row) noexcept -> element_type&
+{
+	return self.data_[static_cast<std::ptrdiff_t>(column) * self.column_stride_ + static_cast<std::ptrdiff_t>(row) * self.row_stride_];
+}
+
+template <std::size_t R, std::size_t C, typename T>
+constexpr auto mat_view<R, C, T>::load(this mat_view const& self) noexcept -> mat_type
+{
+	return meta::unroll<C>([&self](auto... i) { return mat_type{self[i].load()...}; });
+}
+
+template <std::size_t R, std::size_t C, typename T>
+constexpr auto mat_view<R, C, T>::store(this mat_view const& self, mat_type const& m) noexcept -> void
+	requires (!std::is_const_v<element_type>)
+{
+	meta::unroll<C>([&self, &m](auto... i) { (self[i].store(m[i]), ...); });
+}
+}
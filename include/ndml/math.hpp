@@ -0,0 +1,9 @@
+#ifndef NDML_MATH_HPP
+#define NDML_MATH_HPP
+
+#include "math/fixed.hpp"
+#include "math/function.hpp"
+#include "math/policy.hpp"
+#include "math/precision.hpp"
+
+#endif
@@ -0,0 +1,279 @@
+#ifndef NDML_MATH_FIXED_HPP
+#define NDML_MATH_FIXED_HPP
+
+#include "function.hpp"
+
+#include <bit>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace ndml::math
+{
+namespace detail
+{
+/**
+ * @brief Signed and unsigned integer types of twice the width of @p Rep, in which products of fixed-point numbers are calculated.
+ *
+ * It is only defined for representations of up to 64 bits, the latter requiring a 128-bit integer type,
+ * which GCC and Clang provide on 64-bit targets.
+ */
+template <typename Rep>
+struct wide_integer;
+}
+
+/**
+ * @brief Binary fixed-point number.
+ *
+ * The number is stored as an integer of type @p Rep scaled by @f$ 2^{-F} @f$, @f$ F @f$ being @p FractionBits,
+ * so that arithmetic is integer arithmetic, and its results are bit-identical across platforms and compilers.
+ * Products are rounded to nearest, quotients are truncated towards zero, and results out of range wrap around.
+ *
+ * Square root, sine, and cosine are evaluated by integer kernels via @c numeric_traits, regardless of the math policy,
+ * so that vectors, matrices, and quaternions of fixed-point elements are normalized and rotated without floating-point arithmetic.
+ *
+ * @tparam Rep          signed integer representation of up to 64 bits
+ * @tparam FractionBits number of fractional bits, less than the number of bits of @p Rep minus two
+ *
+ * @sa ndml::math::q16_16
+ * @sa ndml::math::q32_32
+ */
+template <std::signed_integral Rep, std::size_t FractionBits>
+struct fixed
+{
+	static_assert(FractionBits > 0 && FractionBits + 2 < std::numeric_limits<Rep>::digits + 1, "fixed-point numbers must have integer bits for their kernels");
+
+	/**
+	 * @brief Integer representation type.
+	 */
+	using rep_type = Rep;
+
+	/**
+	 * @brief Number of fractional bits.
+	 */
+	static constexpr std::size_t fraction_bits = FractionBits;
+
+	/**
+	 * @brief Default constructor.
+	 *
+	 * This will initialize the number to zero.
+	 */
+	constexpr fixed() noexcept = default;
+
+	/**
+	 * @brief Converting constructor from an integer.
+	 *
+	 * It is implicit, as integers are represented exactly unless out of range, so that e.g. @c 2 * x is a fixed-point product.
+	 */
+	template <std::integral I>
+	constexpr fixed(I integer) noexcept;
+
+	/**
+	 * @brief Converting constructor from a floating-point number.
+	 *
+	 * This rounds @p real to the nearest representable number, half away from zero.
+	 * It is explicit, so that floating-point arithmetic is not mixed with fixed-point arithmetic inadvertently.
+	 *
+	 * @warning Behavior is undefined if @p real is not finite or out of range.
+	 */
+	template <std::floating_point F>
+	constexpr explicit fixed(F real) noexcept;
+
+	/**
+	 * @brief Number of given integer representation.
+	 *
+	 * @param raw integer representation, which is the number scaled by @f$ 2^F @f$
+	 */
+	[[nodiscard]]
+	static constexpr auto from_raw(rep_type raw) noexcept -> fixed;
+
+	/**
+	 * @brief Integer representation.
+	 *
+	 * @return the number scaled by @f$ 2^F @f$
+	 */
+	[[nodiscard]]
+	constexpr auto raw(this fixed self) noexcept -> rep_type;
+
+	/**
+	 * @brief Conversion to floating-point number.
+	 */
+	template <std::floating_point F>
+	[[nodiscard]]
+	constexpr explicit operator F(this fixed self) noexcept;
+
+	/**
+	 * @brief Conversion to integer, rounding towards negative infinity.
+	 */
+	template <std::integral I>
+	[[nodiscard]]
+	constexpr explicit operator I(this fixed self) noexcept;
+
+private:
+	/// Integer representation.
+	rep_type raw_{};
+};
+
+/**
+ * @brief Fixed-point number of 16 integer and 16 fractional bits.
+ */
+using q16_16 = fixed<std::int32_t, 16>;
+
+#if defined(__SIZEOF_INT128__)
+/**
+ * @brief Fixed-point number of 32 integer and 32 fractional bits.
+ *
+ * @note Its products are calculated in 128-bit integers, so it is only defined where these are available.
+ */
+using q32_32 = fixed<std::int64_t, 32>;
+#endif
+
+/**
+ * @brief Comparison operators.
+ */
+template <typename Rep, std::size_t F>
+[[nodiscard]]
+constexpr auto operator==(fixed<Rep, F> lhs, fixed<Rep, F> rhs) noexcept -> bool;
+
+template <typename Rep, std::size_t F>
+[[nodiscard]]
+constexpr auto operator<=>(fixed<Rep, F> lhs, fixed<Rep, F> rhs) noexcept -> std::strong_ordering;
+
+/**
+ * @brief Unary plus operator.
+ */
+template <typename Rep, std::size_t F>
+[[nodiscard]]
+constexpr auto operator+(fixed<Rep, F> x) noexcept -> fixed<Rep, F>;
+
+/**
+ * @brief Negation operator.
+ */
+template <typename Rep, std::size_t F>
+[[nodiscard]]
+constexpr auto operator-(fixed<Rep, F> x) noexcept -> fixed<Rep, F>;
+
+/**
+ * @brief Addition operators.
+ */
+template <typename Rep, std::size_t F>
+[[nodiscard]]
+constexpr auto operator+(fixed<Rep, F> lhs, fixed<Rep, F> rhs) noexcept -> fixed<Rep, F>;
+
+template <typename Rep, std::size_t F, std::integral I>
+[[nodiscard]]
+constexpr auto operator+(fixed<Rep, F> lhs, I rhs) noexcept -> fixed<Rep, F>;
+
+template <typename Rep, std::size_t F, std::integral I>
+[[nodiscard]]
+constexpr auto operator+(I lhs, fixed<Rep, F> rhs) noexcept -> fixed<Rep, F>;
+
+/**
+ * @brief Subtraction operators.
+ */
+template <typename Rep, std::size_t F>
+[[nodiscard]]
+constexpr auto operator-(fixed<Rep, F> lhs, fixed<Rep, F> rhs) noexcept -> fixed<Rep, F>;
+
+template <typename Rep, std::size_t F, std::integral I>
+[[nodiscard]]
+constexpr auto operator-(fixed<Rep, F> lhs, I rhs) noexcept -> fixed<Rep, F>;
+
+template <typename Rep, std::size_t F, std::integral I>
+[[nodiscard]]
+constexpr auto operator-(I lhs, fixed<Rep, F> rhs) noexcept -> fixed<Rep, F>;
+
+/**
+ * @brief Multiplication operators.
+ *
+ * Products of two fixed-point numbers are calculated in integers of twice the width and rounded to nearest,
+ * whereas products by integers are exact unless out of range.
+ */
+template <typename Rep, std::size_t F>
+[[nodiscard]]
+constexpr auto operator*(fixed<Rep, F> lhs, fixed<Rep, F> rhs) noexcept -> fixed<Rep, F>;
+
+template <typename Rep, std::size_t F, std::integral I>
+[[nodiscard]]
+constexpr auto operator*(fixed<Rep, F> lhs, I rhs) noexcept -> fixed<Rep, F>;
+
+template <typename Rep, std::size_t F, std::integral I>
+[[nodiscard]]
+constexpr auto operator*(I lhs, fixed<Rep, F> rhs) noexcept -> fixed<Rep, F>;
+
+/**
+ * @brief Division operators.
+ *
+ * Quotients are truncated towards zero. Quotients of two fixed-point numbers are calculated in integers of twice the width.
+ *
+ * @warning Behavior is undefined if @p rhs is zero.
+ */
+template <typename Rep, std::size_t F>
+[[nodiscard]]
+constexpr auto operator/(fixed<Rep, F> lhs, fixed<Rep, F> rhs) noexcept -> fixed<Rep, F>;
+
+template <typename Rep, std::size_t F, std::integral I>
+[[nodiscard]]
+constexpr auto operator/(fixed<Rep, F> lhs, I rhs) noexcept -> fixed<Rep, F>;
+
+template <typename Rep, std::size_t F, std::integral I>
+[[nodiscard]]
+constexpr auto operator/(I lhs, fixed<Rep, F> rhs) noexcept -> fixed<Rep, F>;
+
+/**
+ * @brief Compound assignment operators.
+ *
+ * These assign the result of the respective operator of @p lhs and @p rhs to @p lhs.
+ */
+template <typename Rep, std::size_t F>
+constexpr auto operator+=(fixed<Rep, F>& lhs, std::type_identity_t<fixed<Rep, F>> rhs) noexcept -> fixed<Rep, F>&;
+
+template <typename Rep, std::size_t F>
+constexpr auto operator-=(fixed<Rep, F>& lhs, std::type_identity_t<fixed<Rep, F>> rhs) noexcept -> fixed<Rep, F>&;
+
+template <typename Rep, std::size_t F>
+constexpr auto operator*=(fixed<Rep, F>& lhs, std::type_identity_t<fixed<Rep, F>> rhs) noexcept -> fixed<Rep, F>&;
+
+template <typename Rep, std::size_t F>
+constexpr auto operator/=(fixed<Rep, F>& lhs, std::type_identity_t<fixed<Rep, F>> rhs) noexcept -> fixed<Rep, F>&;
+
+/**
+ * @brief Evaluation of functions of fixed-point numbers by integer kernels.
+ */
+template <typename Rep, std::size_t F>
+struct numeric_traits<fixed<Rep, F>>
+{
+	using value_type = fixed<Rep, F>;
+
+	/**
+	 * @brief Square root.
+	 *
+	 * This calculates the integer square root of the representation of @p x scaled by @f$ 2^F @f$ digit by digit,
+	 * rounded to nearest, so that the result is exact to half of its least significant bit.
+	 *
+	 * @return the square root of @p x, or zero if @p x is not positive
+	 */
+	[[nodiscard]]
+	static constexpr auto sqrt(value_type const& x) noexcept -> value_type;
+
+	/**
+	 * @brief Sine and cosine.
+	 *
+	 * The angle is reduced to @f$ r \in [-\frac \pi 4, \frac \pi 4] @f$ such that @f$ x = k \frac \pi 2 + r @f$
+	 * in fixed-point numbers of all but two bits of @p Rep fractional, in which the Taylor series of sine and cosine of @f$ r @f$
+	 * are summed until their terms are below their least significant bit. The results are rounded to @p F fractional bits,
+	 * being accurate to about their least significant bit over the whole range of @p x.
+	 *
+	 * @param x angle in radians
+	 */
+	[[nodiscard]]
+	static constexpr auto sin_cos(value_type const& x) noexcept -> sin_cos_result<value_type>;
+};
+}
+
+#include "fixed.inl"
+
+#endif
@@ -0,0 +1,344 @@
+namespace ndml::math
+{
+namespace detail
+{
+template <typename Rep>
+	requires (sizeof(Rep) <= 4)
+struct wide_integer<Rep>
+{
+	using type          = std::int64_t;
+	using unsigned_type = std::uint64_t;
+};
+
+#if defined(__SIZEOF_INT128__)
+template <typename Rep>
+	requires (sizeof(Rep) == 8)
+struct wide_integer<Rep>
+{
+	// the keyword marks the types as extensions, which are otherwise diagnosed by pedantic warnings
+	__extension__ typedef __int128 type;
+	__extension__ typedef unsigned __int128 unsigned_type;
+};
+#endif
+
+/**
+ * @brief Unsigned type in which sums and products of @p Rep wrap around instead of overflowing.
+ */
+template <typename Rep>
+using wrapping_t = std::make_unsigned_t<decltype(+Rep{})>;
+
+/**
+ * @brief Number of terms of Taylor series of sine and cosine on @f$ [-\frac \pi 4, \frac \pi 4] @f$ at given number of fractional bits.
+ *
+ * Terms are added until the first omitted term of the cosine series, which exceeds that of the sine series,
+ * is below half of the least significant bit.
+ */
+consteval auto series_terms(std::size_t fraction_bits) -> int
+{
+	constexpr double pi_over_four_squared = 0.616850275068084913677155687492;
+
+	double half_lsb = 0.5;
+	for (std::size_t i = 0; i < fraction_bits; ++i)
+	{
+		half_lsb /= 2;
+	}
+
+	int    n    = 0;
+	double term = 1;
+
+	while ((term *= pi_over_four_squared / ((2 * n + 1) * (2 * n + 2))) >= half_lsb)
+	{
+		++n;
+	}
+
+	return n;
+}
+}
+
+template <std::signed_integral Rep, std::size_t FractionBits>
+template <std::integral I>
+constexpr fixed<Rep, FractionBits>::fixed(I integer) noexcept
+	: raw_{static_cast<rep_type>(static_cast<detail::wrapping_t<rep_type>>(integer) << FractionBits)}
+{
+}
+
+template <std::signed_integral Rep, std::size_t FractionBits>
+template <std::floating_point F>
+constexpr fixed<Rep, FractionBits>::fixed(F real) noexcept
+	: raw_{static_cast<rep_type>(real * static_cast<F>(rep_type{1} << FractionBits) + (real < F{0} ? F{-0.5} : F{0.5}))}
+{
+}
+
+template <std::signed_integral Rep, std::size_t FractionBits>
+constexpr auto fixed<Rep, FractionBits>::from_raw(rep_type raw) noexcept -> fixed
+{
+	fixed x;
+	x.raw_ = raw;
+
+	return x;
+}
+
+template <std::signed_integral Rep, std::size_t FractionBits>
+constexpr auto fixed<Rep, FractionBits>::raw(this fixed self) noexcept -> rep_type
+{
+	return self.raw_;
+}
+
+template <std::signed_integral Rep, std::size_t FractionBits>
+template <std::floating_point F>
+constexpr fixed<Rep, FractionBits>::operator F(this fixed self) noexcept
+{
+	// the scale is a power of two, so that its reciprocal is exact
+	return static_cast<F>(self.raw_) * (F{1} / static_cast<F>(rep_type{1} << FractionBits));
+}
+
+template <std::signed_integral Rep, std::size_t FractionBits>
+template <std::integral I>
+constexpr fixed<Rep, FractionBits>::operator I(this fixed self) noexcept
+{
+	return static_cast<I>(self.raw_ >> FractionBits);
+}
+
+template <typename Rep, std::size_t F>
+constexpr auto operator==(fixed<Rep, F> lhs, fixed<Rep, F> rhs) noexcept -> bool
+{
+	return lhs.raw() == rhs.raw();
+}
+
+template <typename Rep, std::size_t F>
+constexpr auto operator<=>(fixed<Rep, F> lhs, fixed<Rep, F> rhs) noexcept -> std::strong_ordering
+{
+	return lhs.raw() <=> rhs.raw();
+}
+
+template <typename Rep, std::size_t F>
+constexpr auto operator+(fixed<Rep, F> x) noexcept -> fixed<Rep, F>
+{
+	return x;
+}
+
+template <typename Rep, std::size_t F>
+constexpr auto operator-(fixed<Rep, F> x) noexcept -> fixed<Rep, F>
+{
+	using wrapping_type = detail::wrapping_t<Rep>;
+
+	return fixed<Rep, F>::from_raw(static_cast<Rep>(wrapping_type{0} - static_cast<wrapping_type>(x.raw())));
+}
+
+template <typename Rep, std::size_t F>
+constexpr auto operator+(fixed<Rep, F> lhs, fixed<Rep, F> rhs) noexcept -> fixed<Rep, F>
+{
+	using wrapping_type = detail::wrapping_t<Rep>;
+
+	return fixed<Rep, F>::from_raw(static_cast<Rep>(static_cast<wrapping_type>(lhs.raw()) + static_cast<wrapping_type>(rhs.raw())));
+}
+
+template <typename Rep, std::size_t F, std::integral I>
+constexpr auto operator+(fixed<Rep, F> lhs, I rhs) noexcept -> fixed<Rep, F>
+{
+	return lhs + fixed<Rep, F>{rhs};
+}
+
+template <typename Rep, std::size_t F, std::integral I>
+constexpr auto operator+(I lhs, fixed<Rep, F> rhs) noexcept -> fixed<Rep, F>
+{
+	return fixed<Rep, F>{lhs} + rhs;
+}
+
+template <typename Rep, std::size_t F>
+constexpr auto operator-(fixed<Rep, F> lhs, fixed<Rep, F> rhs) noexcept -> fixed<Rep, F>
+{
+	using wrapping_type = detail::wrapping_t<Rep>;
+
+	return fixed<Rep, F>::from_raw(static_cast<Rep>(static_cast<wrapping_type>(lhs.raw()) - static_cast<wrapping_type>(rhs.raw())));
+}
+
+template <typename Rep, std::size_t F, std::integral I>
+constexpr auto operator-(fixed<Rep, F> lhs, I rhs) noexcept -> fixed<Rep, F>
+{
+	return lhs - fixed<Rep, F>{rhs};
+}
+
+template <typename Rep, std::size_t F, std::integral I>
+constexpr auto operator-(I lhs, fixed<Rep, F> rhs) noexcept -> fixed<Rep, F>
+{
+	return fixed<Rep, F>{lhs} - rhs;
+}
+
+template <typename Rep, std::size_t F>
+constexpr auto operator*(fixed<Rep, F> lhs, fixed<Rep, F> rhs) noexcept -> fixed<Rep, F>
+{
+	using wide_type = detail::wide_integer<Rep>::type;
+
+	auto const product = static_cast<wide_type>(lhs.raw()) * static_cast<wide_type>(rhs.raw());
+
+	return fixed<Rep, F>::from_raw(static_cast<Rep>((product + (wide_type{1} << (F - 1))) >> F));
+}
+
+template <typename Rep, std::size_t F, std::integral I>
+constexpr auto operator*(fixed<Rep, F> lhs, I rhs) noexcept -> fixed<Rep, F>
+{
+	using wrapping_type = detail::wrapping_t<Rep>;
+
+	return fixed<Rep, F>::from_raw(static_cast<Rep>(static_cast<wrapping_type>(lhs.raw()) * static_cast<wrapping_type>(rhs)));
+}
+
+template <typename Rep, std::size_t F, std::integral I>
+constexpr auto operator*(I lhs, fixed<Rep, F> rhs) noexcept -> fixed<Rep, F>
+{
+	return rhs * lhs;
+}
+
+template <typename Rep, std::size_t F>
+constexpr auto operator/(fixed<Rep, F> lhs, fixed<Rep, F> rhs) noexcept -> fixed<Rep, F>
+{
+	using wide_type = detail::wide_integer<Rep>::type;
+
+	return fixed<Rep, F>::from_raw(static_cast<Rep>((static_cast<wide_type>(lhs.raw()) << F) / static_cast<wide_type>(rhs.raw())));
+}
+
+template <typename Rep, std::size_t F, std::integral I>
+constexpr auto operator/(fixed<Rep, F> lhs, I rhs) noexcept -> fixed<Rep, F>
+{
+	using wide_type = detail::wide_integer<Rep>::type;
+
+	// the quotient is calculated in the wide type, so that dividing the least number by minus one wraps around
+	return fixed<Rep, F>::from_raw(static_cast<Rep>(static_cast<wide_type>(lhs.raw()) / static_cast<wide_type>(rhs)));
+}
+
+template <typename Rep, std::size_t F, std::integral I>
+constexpr auto operator/(I lhs, fixed<Rep, F> rhs) noexcept -> fixed<Rep, F>
+{
+	return fixed<Rep, F>{lhs} / rhs;
+}
+
+template <typename Rep, std::size_t F>
+constexpr auto operator+=(fixed<Rep, F>& lhs, std::type_identity_t<fixed<Rep, F>> rhs) noexcept -> fixed<Rep, F>&
+{
+	lhs = lhs + rhs;
+	return lhs;
+}
+
+template <typename Rep, std::size_t F>
+constexpr auto operator-=(fixed<Rep, F>& lhs, std::type_identity_t<fixed<Rep, F>> rhs) noexcept -> fixed<Rep, F>&
+{
+	lhs = lhs - rhs;
+	return lhs;
+}
+
+template <typename Rep, std::size_t F>
+constexpr auto operator*=(fixed<Rep, F>& lhs, std::type_identity_t<fixed<Rep, F>> rhs) noexcept -> fixed<Rep, F>&
+{
+	lhs = lhs * rhs;
+	return lhs;
+}
+
+template <typename Rep, std::size_t F>
+constexpr auto operator/=(fixed<Rep, F>& lhs, std::type_identity_t<fixed<Rep, F>> rhs) noexcept -> fixed<Rep, F>&
+{
+	lhs = lhs / rhs;
+	return lhs;
+}
+
+template <typename Rep, std::size_t F>
+constexpr auto numeric_traits<fixed<Rep, F>>::sqrt(value_type const& x) noexcept -> value_type
+{
+	using unsigned_type = detail::wide_integer<Rep>::unsigned_type;
+
+	if (x.raw() <= 0)
+	{
+		return {};
+	}
+
+	// the square root of the representation scaled by 2^F is that of the number scaled by 2^F
+	auto remainder = static_cast<unsigned_type>(x.raw()) << F;
+
+	// digits are calculated from the greatest power of four not exceeding the argument
+	auto const width = static_cast<std::size_t>(std::bit_width(static_cast<std::make_unsigned_t<Rep>>(x.raw()))) + F;
+
+	unsigned_type root{0};
+	unsigned_type bit = unsigned_type{1} << ((width - 1) & ~std::size_t{1});
+
+	while (bit != 0)
+	{
+		// digits are unpredictable for branches, so that they are selected without them
+		auto const trial = root + bit;
+		auto const digit = remainder >= trial;
+
+		remainder -= digit ? trial : unsigned_type{0};
+		root = (root >> 1) + (digit ? bit : unsigned_type{0});
+
+		bit >>= 2;
+	}
+
+	// the remainder exceeds the root if the square of the root plus one half is less than the argument
+	if (remainder > root)
+	{
+		++root;
+	}
+
+	return value_type::from_raw(static_cast<Rep>(root));
+}
+
+template <typename Rep, std::size_t F>
+constexpr auto numeric_traits<fixed<Rep, F>>::sin_cos(value_type const& x) noexcept -> sin_cos_result<value_type>
+{
+	using wide_type = detail::wide_integer<Rep>::type;
+
+	constexpr auto bits = static_cast<std::size_t>(std::numeric_limits<Rep>::digits + 1);
+
+	// the angle is reduced with all but two bits fractional, which fit the reduced angle, and the sine and cosine thereof
+	constexpr auto precision = bits - 2;
+
+	constexpr auto pi_over_two = [] {
+		constexpr std::uint64_t pi_over_two_62 = 0x6487ED5110B4611A;
+
+		if constexpr (bits == 64)
+		{
+			return static_cast<Rep>(pi_over_two_62);
+		}
+		else
+		{
+			return static_cast<Rep>((pi_over_two_62 + (std::uint64_t{1} << (63 - bits))) >> (64 - bits));
+		}
+	}();
+
+	auto const angle = static_cast<wide_type>(x.raw()) << (precision - F);
+
+	auto const k = (angle + (angle < 0 ? -(pi_over_two / 2) : pi_over_two / 2)) / pi_over_two;
+	auto const r = static_cast<Rep>(angle - k * pi_over_two);
+
+	auto const multiply = [](Rep lhs, Rep rhs) {
+		return static_cast<Rep>((static_cast<wide_type>(lhs) * rhs + (wide_type{1} << (precision - 1))) >> precision);
+	};
+
+	constexpr Rep one = Rep{1} << precision;
+
+	auto const z = multiply(r, r);
+
+	Rep s = one;
+	Rep c = one;
+
+	for (Rep i = detail::series_terms(precision); i > 0; --i)
+	{
+		s = one - multiply(z, s) / ((2 * i) * (2 * i + 1));
+		c = one - multiply(z, c) / ((2 * i - 1) * (2 * i));
+	}
+
+	s = multiply(r, s);
+
+	auto const round = [](Rep y) { return value_type::from_raw(static_cast<Rep>((y + (Rep{1} << (precision - F - 1))) >> (precision - F))); };
+
+	switch (static_cast<int>(k & 3))
+	{
+	case 0:
+		return {round(s), round(c)};
+	case 1:
+		return {round(c), -round(s)};
+	case 2:
+		return {-round(s), -round(c)};
+	default:
+		return {-round(c), round(s)};
+	}
+}
+}
@@ -0,0 +1,133 @@
+#ifndef NDML_MATH_FUNCTION_HPP
+#define NDML_MATH_FUNCTION_HPP
+
+#include "policy.hpp"
+
+#include <concepts>
+#include <type_traits>
+
+namespace ndml::math
+{
+/**
+ * @brief Sine and cosine of the same angle.
+ */
+template <typename T>
+struct sin_cos_result
+{
+	/// Sine.
+	T sin;
+
+	/// Cosine.
+	T cos;
+};
+
+/**
+ * @brief Evaluation of functions of elements of type @p T.
+ *
+ * It is empty for all types, so that functions are evaluated by the standard library, or by the portable implementations
+ * in constant expressions. It may be specialized for numeric types which are not floating-point, e.g. for fixed-point types
+ * of deterministic simulations, by providing static member functions @c sqrt and @c sin_cos of the same signatures
+ * as @ref ndml::math::sqrt and @ref ndml::math::sin_cos without the math policy, which are then used regardless of the policy.
+ *
+ * @tparam T element type
+ *
+ * @sa ndml::math::fixed
+ */
+template <typename T>
+struct numeric_traits
+{
+};
+
+/**
+ * @brief Whether functions of elements of type @p T are evaluated by a specialization of @c numeric_traits.
+ */
+template <typename T>
+concept custom_numeric = requires(T const& x) {
+	{ numeric_traits<T>::sqrt(x) } -> std::same_as<T>;
+	{ numeric_traits<T>::sin_cos(x) } -> std::same_as<sin_cos_result<T>>;
+};
+
+/**
+ * @brief Type of real-valued results of functions of elements of type @p T computed without a math policy, e.g. of @c norm(v).
+ *
+ * It is @p T itself for custom numeric types, so that their results do not depend on floating-point evaluation, and @c double otherwise.
+ */
+template <typename T>
+using real_t = std::conditional_t<custom_numeric<T>, T, double>;
+
+/**
+ * @brief Square root.
+ *
+ * @return the square root of @p x converted to @p T
+ */
+template <typename T, policy P = default_policy>
+[[nodiscard]]
+constexpr auto sqrt(T const& x, P policy = P{}) noexcept -> T;
+
+/**
+ * @brief Reciprocal square root.
+ *
+ * Given the fast policy and a floating-point @p x, this refines a hardware estimate, where available,
+ * or a bit-level one via Newton-Raphson iterations, without a square root or a division.
+ *
+ * @return the reciprocal of the square root of @p x
+ *
+ * @warning Behavior is undefined if @p x is not positive.
+ */
+template <typename T, policy P = default_policy>
+[[nodiscard]]
+constexpr auto rsqrt(T const& x, P policy = P{}) noexcept -> T;
+
+/**
+ * @brief Sine.
+ *
+ * Given the fast policy and a floating-point @p x, this reduces @p x to a quarter-period and evaluates a minimax polynomial,
+ * absolute error being about @c 1e-7 for @p x of magnitude up to about @c 8192. Behavior is defined for any @p x,
+ * but the error grows with the magnitude of larger arguments, results being meaningless for single-precision @p x beyond about @c 1e6.
+ *
+ * @param x angle in radians
+ */
+template <typename T, policy P = default_policy>
+[[nodiscard]]
+constexpr auto sin(T const& x, P policy = P{}) noexcept -> T;
+
+/**
+ * @brief Cosine.
+ *
+ * Given the fast policy and a floating-point @p x, this reduces @p x to a quarter-period and evaluates a minimax polynomial,
+ * absolute error being about @c 1e-7 for @p x of magnitude up to about @c 8192. Behavior is defined for any @p x,
+ * but the error grows with the magnitude of larger arguments, results being meaningless for single-precision @p x beyond about @c 1e6.
+ *
+ * @param x angle in radians
+ */
+template <typename T, policy P = default_policy>
+[[nodiscard]]
+constexpr auto cos(T const& x, P policy = P{}) noexcept -> T;
+
+/**
+ * @brief Sine and cosine.
+ *
+ * Given the fast policy and a floating-point @p x, both are evaluated from the same reduction of @p x,
+ * so this is cheaper than calling @ref sin and @ref cos separately.
+ *
+ * @param x angle in radians
+ */
+template <typename T, policy P = default_policy>
+[[nodiscard]]
+constexpr auto sin_cos(T const& x, P policy = P{}) noexcept -> sin_cos_result<T>;
+
+/**
+ * @brief Tangent.
+ *
+ * Given the fast policy and a floating-point @p x, this is the ratio of the fast sine and cosine of @p x.
+ *
+ * @param x angle in radians
+ */
+template <typename T, policy P = default_policy>
+[[nodiscard]]
+constexpr auto tan(T const& x, P policy = P{}) noexcept -> T;
+}
+
+#include "function.inl"
+
+#endif
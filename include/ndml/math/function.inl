@@ -0,0 +1,351 @@
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#	include <xmmintrin.h>
+#	define NDML_MATH_RSQRT_SSE 1
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#	include <arm_neon.h>
+#	define NDML_MATH_RSQRT_NEON 1
+#endif
+
+namespace ndml::math
+{
+namespace detail
+{
+/**
+ * @brief Whether the fast policy approximates functions of type @p T.
+ */
+template <typename T>
+inline constexpr bool approximated = std::same_as<T, float> || std::same_as<T, double>;
+
+/**
+ * @brief Reciprocal square root estimate refined via Newton-Raphson iterations.
+ */
+template <typename T>
+constexpr auto fast_rsqrt(T x) noexcept -> T
+{
+	auto const half_x = x * T{0.5};
+
+	if !consteval
+	{
+		// the estimate is of single precision, so double-precision arguments are estimated as such,
+		// its relative error of at most 1.5 * 2^-12 being squared by a single iteration,
+		// unless they are out of the normal range of single precision, for which it would be zero or infinite
+		if (std::same_as<T, float> || (x >= std::numeric_limits<float>::min() && x <= std::numeric_limits<float>::max()))
+		{
+#if defined(NDML_MATH_RSQRT_SSE)
+			auto const y = static_cast<T>(_mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(static_cast<float>(x)))));
+			return y * (T{1.5} - half_x * y * y);
+#elif defined(NDML_MATH_RSQRT_NEON)
+			auto const xf = static_cast<float>(x);
+
+			auto y = vrsqrtes_f32(xf);
+			y *= vrsqrtss_f32(xf * y, y);
+
+			auto const yt = static_cast<T>(y);
+			return yt * (T{1.5} - half_x * yt * yt);
+#endif
+		}
+	}
+
+	T y;
+
+	if constexpr (std::same_as<T, float>)
+	{
+		y = std::bit_cast<T>(std::uint32_t{0x5f375a86} - (std::bit_cast<std::uint32_t>(x) >> 1));
+	}
+	else
+	{
+		y = std::bit_cast<T>(std::uint64_t{0x5fe6eb50c7b537a9} - (std::bit_cast<std::uint64_t>(x) >> 1));
+	}
+
+	for (int i = 0; i < 3; ++i)
+	{
+		y *= T{1.5} - half_x * y * y;
+	}
+
+	return y;
+}
+
+/**
+ * @brief Sine and cosine polynomial approximation.
+ *
+ * The angle is reduced to @f$ r \in [-\frac \pi 4, \frac \pi 4] @f$ such that @f$ x = k \frac \pi 2 + r @f$,
+ * @f$ \frac \pi 2 @f$ being split into three parts so that their products by @f$ k @f$ are exact,
+ * and the quadrant @f$ k \bmod 4 @f$ selects the signs and the order of polynomials approximating sine and cosine of @f$ r @f$.
+ * @f$ k @f$ is rounded in floating point, so that arguments of any magnitude, including non-finite ones, are well-defined.
+ */
+template <typename T>
+constexpr auto fast_sin_cos(T x) noexcept -> sin_cos_result<T>
+{
+	constexpr T two_over_pi(0.636619772367581343075535053490057448);
+
+	constexpr T pi_over_two_1 = std::same_as<T, float> ? T(1.5703125) : T(1.57079625129699707031e0);
+	constexpr T pi_over_two_2 = std::same_as<T, float> ? T(4.837512969970703125e-4) : T(7.54978941586159635335e-8);
+	constexpr T pi_over_two_3 = std::same_as<T, float> ? T(7.54978995489188216e-8) : T(5.39030252995776476554e-15);
+
+	// rounding to the nearest integer by adding and subtracting 1.5 times the power of two whose ulp is one,
+	// which leaves the integer in the low mantissa bits, is defined for any x, unlike a conversion to an integer
+	using bits_type = std::conditional_t<std::same_as<T, float>, std::uint32_t, std::uint64_t>;
+
+	constexpr T round_shift = std::same_as<T, float> ? T(12582912.0) : T(6755399441055744.0);
+
+	auto const shifted = x * two_over_pi + round_shift;
+	auto const k       = std::bit_cast<bits_type>(shifted);
+	auto const kt      = shifted - round_shift;
+
+	auto const r = ((x - kt * pi_over_two_1) - kt * pi_over_two_2) - kt * pi_over_two_3;
+	auto const z = r * r;
+
+	auto const s = r + r * z * ((T(-1.9515295891e-4) * z + T(8.3321608736e-3)) * z + T(-1.6666654611e-1));
+	auto const c = T{1} - T{0.5} * z + z * z * ((T(2.443315711809948e-5) * z + T(-1.388731625493765e-3)) * z + T(4.166664568298827e-2));
+
+	// quadrants are selected via bitwise operations, as they are unpredictable for branches
+	constexpr auto sign_shift = sizeof(bits_type) * 8 - 2;
+
+	auto const s_bits = std::bit_cast<bits_type>(s);
+	auto const c_bits = std::bit_cast<bits_type>(c);
+
+	auto const swap = bits_type{0} - (k & 1);
+
+	auto const sin_sign = (k & 2) << sign_shift;
+	auto const cos_sign = ((k + 1) & 2) << sign_shift;
+
+	return {
+		std::bit_cast<T>(((s_bits & ~swap) | (c_bits & swap)) ^ sin_sign),
+		std::bit_cast<T>(((c_bits & ~swap) | (s_bits & swap)) ^ cos_sign),
+	};
+}
+
+/**
+ * @brief Floating-point type in which functions of @p T are evaluated in constant expressions.
+ */
+template <typename T>
+using evaluation_t = std::conditional_t<std::same_as<T, long double>, long double, double>;
+
+/**
+ * @brief Square root usable in constant expressions.
+ *
+ * The exponent of @p x is halved for an initial estimate, which is refined via Newton-Raphson iterations until it no longer changes.
+ * Arguments beyond the range of @c double are not supported.
+ */
+template <typename F>
+constexpr auto constant_sqrt(F x) noexcept -> F
+{
+	if (!(x > F{0}) || x == std::numeric_limits<F>::infinity())
+	{
+		return x == F{0} || x == std::numeric_limits<F>::infinity() ? x : std::numeric_limits<F>::quiet_NaN();
+	}
+
+	auto y = static_cast<F>(std::bit_cast<double>((std::bit_cast<std::uint64_t>(static_cast<double>(x)) >> 1) + std::uint64_t{0x1ff8000000000000}));
+
+	for (int i = 0; i < 64; ++i)
+	{
+		auto const next = (y + x / y) / F{2};
+
+		if (next == y)
+		{
+			break;
+		}
+
+		y = next;
+	}
+
+	return y;
+}
+
+/**
+ * @brief Sine and cosine usable in constant expressions.
+ *
+ * The angle is reduced as by @ref fast_sin_cos, with @f$ \frac \pi 2 @f$ split into four parts of which the first three have 33 significant bits,
+ * and the Taylor series of sine and cosine are summed up to the terms of degree 23 and 22, which is accurate to about double precision
+ * for @p x of magnitude up to about @c 1e9.
+ */
+template <typename F>
+constexpr auto constant_sin_cos(F x) noexcept -> sin_cos_result<F>
+{
+	if (!(x - x == F{0}))
+	{
+		return {std::numeric_limits<F>::quiet_NaN(), std::numeric_limits<F>::quiet_NaN()};
+	}
+
+	constexpr F two_over_pi(0.636619772367581343075535053490057448L);
+
+	constexpr F pi_over_two_1(1.57079632673412561417e+00L);
+	constexpr F pi_over_two_2(6.07710050630396597660e-11L);
+	constexpr F pi_over_two_3(2.02226624871116645580e-21L);
+	constexpr F pi_over_two_4(8.47842766036889956997e-32L);
+
+	auto const k  = static_cast<std::int64_t>(x * two_over_pi + (x < F{0} ? F{-0.5} : F{0.5}));
+	auto const kt = static_cast<F>(k);
+
+	auto const r = (((x - kt * pi_over_two_1) - kt * pi_over_two_2) - kt * pi_over_two_3) - kt * pi_over_two_4;
+	auto const z = r * r;
+
+	F s = r;
+	F c{1};
+
+	F s_term = r;
+	F c_term{1};
+
+	for (int i = 1; i <= 11; ++i)
+	{
+		s_term *= -z / static_cast<F>((2 * i) * (2 * i + 1));
+		c_term *= -z / static_cast<F>((2 * i - 1) * (2 * i));
+
+		s += s_term;
+		c += c_term;
+	}
+
+	switch (k & 3)
+	{
+	case 0:
+		return {s, c};
+	case 1:
+		return {c, -s};
+	case 2:
+		return {-s, -c};
+	default:
+		return {-c, s};
+	}
+}
+}
+
+template <typename T, policy P>
+constexpr auto sqrt(T const& x, P) noexcept -> T
+{
+	if constexpr (custom_numeric<T>)
+	{
+		return numeric_traits<T>::sqrt(x);
+	}
+	else
+	{
+		// square root is a single instruction on common targets, at least as fast as an approximation
+		if consteval
+		{
+			return static_cast<T>(detail::constant_sqrt(static_cast<detail::evaluation_t<T>>(x)));
+		}
+		else
+		{
+			return static_cast<T>(std::sqrt(x));
+		}
+	}
+}
+
+template <typename T, policy P>
+constexpr auto rsqrt(T const& x, P) noexcept -> T
+{
+	if constexpr (std::same_as<P, fast_t> && detail::approximated<T>)
+	{
+		return detail::fast_rsqrt(x);
+	}
+	else
+	{
+		return T{1} / sqrt(x, precise);
+	}
+}
+
+template <typename T, policy P>
+constexpr auto sin(T const& x, P) noexcept -> T
+{
+	if constexpr (custom_numeric<T>)
+	{
+		return numeric_traits<T>::sin_cos(x).sin;
+	}
+	else if constexpr (std::same_as<P, fast_t> && detail::approximated<T>)
+	{
+		return detail::fast_sin_cos(x).sin;
+	}
+	else
+	{
+		if consteval
+		{
+			return static_cast<T>(detail::constant_sin_cos(static_cast<detail::evaluation_t<T>>(x)).sin);
+		}
+		else
+		{
+			return static_cast<T>(std::sin(x));
+		}
+	}
+}
+
+template <typename T, policy P>
+constexpr auto cos(T const& x, P) noexcept -> T
+{
+	if constexpr (custom_numeric<T>)
+	{
+		return numeric_traits<T>::sin_cos(x).cos;
+	}
+	else if constexpr (std::same_as<P, fast_t> && detail::approximated<T>)
+	{
+		return detail::fast_sin_cos(x).cos;
+	}
+	else
+	{
+		if consteval
+		{
+			return static_cast<T>(detail::constant_sin_cos(static_cast<detail::evaluation_t<T>>(x)).cos);
+		}
+		else
+		{
+			return static_cast<T>(std::cos(x));
+		}
+	}
+}
+
+template <typename T, policy P>
+constexpr auto sin_cos(T const& x, P) noexcept -> sin_cos_result<T>
+{
+	if constexpr (custom_numeric<T>)
+	{
+		return numeric_traits<T>::sin_cos(x);
+	}
+	else if constexpr (std::same_as<P, fast_t> && detail::approximated<T>)
+	{
+		return detail::fast_sin_cos(x);
+	}
+	else
+	{
+		if consteval
+		{
+			auto const [s, c] = detail::constant_sin_cos(static_cast<detail::evaluation_t<T>>(x));
+			return {static_cast<T>(s), static_cast<T>(c)};
+		}
+		else
+		{
+			return {static_cast<T>(std::sin(x)), static_cast<T>(std::cos(x))};
+		}
+	}
+}
+
+template <typename T, policy P>
+constexpr auto tan(T const& x, P) noexcept -> T
+{
+	if constexpr (custom_numeric<T>)
+	{
+		auto const [s, c] = numeric_traits<T>::sin_cos(x);
+		return s / c;
+	}
+	else if constexpr (std::same_as<P, fast_t> && detail::approximated<T>)
+	{
+		auto const [s, c] = detail::fast_sin_cos(x);
+		return s / c;
+	}
+	else
+	{
+		if consteval
+		{
+			auto const [s, c] = detail::constant_sin_cos(static_cast<detail::evaluation_t<T>>(x));
+			return static_cast<T>(s / c);
+		}
+		else
+		{
+			return static_cast<T>(std::tan(x));
+		}
+	}
+}
+}
@@ -0,0 +1,72 @@
+#ifndef NDML_MATH_POLICY_HPP
+#define NDML_MATH_POLICY_HPP
+
+#include <concepts>
+
+/**
+ * @def NDML_FAST_MATH
+ *
+ * @brief Opt-in switch for approximate math by default.
+ *
+ * When defined, operations taking a math policy use @c ndml::math::fast unless given one explicitly,
+ * e.g. @c normal(v) normalizes via an approximate reciprocal square root, and @c rotation(axis, angle)
+ * evaluates polynomial approximations of sine and cosine.
+ *
+ * @note It changes the default for the whole translation unit, so it should be defined consistently
+ *       across translation units sharing inline functions which rely on the default.
+ */
+
+namespace ndml::math
+{
+/**
+ * @brief Precise math policy.
+ *
+ * Functions are evaluated as accurately as by the standard library. Functions of the standard library are not usable
+ * in constant expressions before C++26, so there they are evaluated by portable implementations accurate to about double precision,
+ * e.g. for initialization of @c constexpr rotation and projection matrices.
+ */
+struct precise_t
+{
+	explicit precise_t() = default;
+};
+
+/**
+ * @brief Fast math policy.
+ *
+ * Functions of floating-point arguments are approximated to about single-precision accuracy,
+ * i.e. to relative error of about @c 1e-6 or less, trading accuracy for throughput.
+ */
+struct fast_t
+{
+	explicit fast_t() = default;
+};
+
+/**
+ * @brief Precise math policy tag.
+ */
+inline constexpr precise_t precise{};
+
+/**
+ * @brief Fast math policy tag.
+ */
+inline constexpr fast_t fast{};
+
+/**
+ * @brief Whether @p P is a math policy.
+ */
+template <typename P>
+concept policy = std::same_as<P, precise_t> || std::same_as<P, fast_t>;
+
+/**
+ * @brief Policy used when none is given explicitly.
+ *
+ * It is @c fast_t when @c NDML_FAST_MATH is defined, and @c precise_t otherwise.
+ */
+#if defined(NDML_FAST_MATH)
+using default_policy = fast_t;
+#else
+using default_policy = precise_t;
+#endif
+}
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef NDML_MATH_PRECISION_HPP
+#define NDML_MATH_PRECISION_HPP
+
+#include <concepts>
+
+#if __has_include(<stdfloat>)
+#	include <stdfloat>
+#endif
+
+namespace ndml::math
+{
+/**
+ * @brief Type in which sums of products of elements of type @p T are accumulated.
+ *
+ * It is @p T itself, except for storage types of lower precision than @c float, i.e. @c std::float16_t and @c std::bfloat16_t
+ * where supported, which accumulate in @c float so that reductions such as @c dot, @c norm, and matrix products
+ * do not round each partial sum to a few significant digits. It may be specialized for other such types.
+ *
+ * @tparam T element type
+ */
+template <typename T>
+struct accumulator
+{
+	using type = T;
+};
+
+#if defined(__STDCPP_FLOAT16_T__)
+template <>
+struct accumulator<std::float16_t>
+{
+	using type = float;
+};
+#endif
+
+#if defined(__STDCPP_BFLOAT16_T__)
+template <>
+struct accumulator<std::bfloat16_t>
+{
+	using type = float;
+};
+#endif
+
+/**
+ * @brief Type in which sums of products of elements of type @p T are accumulated.
+ *
+ * @sa ndml::math::accumulator
+ */
+template <typename T>
+using accumulator_t = accumulator<T>::type;
+
+/**
+ * @brief Whether elements of type @p T are accumulated in another type.
+ */
+template <typename T>
+concept widened = !std::same_as<accumulator_t<T>, T>;
+}
+
+#endif
@@ -3,5 +3,7 @@
 
 #include "meta/burn.hpp"
 #include "meta/functional.hpp"
+#include "meta/layout.hpp"
+#include "meta/unroll.hpp"
 
 #endif
@@ -0,0 +1,74 @@
+#ifndef NDML_META_LAYOUT_HPP
+#define NDML_META_LAYOUT_HPP
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+
+/**
+ * @def NDML_NO_UNIQUE_ADDRESS
+ *
+ * @brief Portable spelling of @c [[no_unique_address]].
+ *
+ * MSVC accepts and ignores the standard attribute for the sake of ABI stability, honoring @c [[msvc::no_unique_address]] instead.
+ */
+#if defined(_MSC_VER) && __has_cpp_attribute(msvc::no_unique_address)
+#	define NDML_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#else
+#	define NDML_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+
+namespace ndml::meta
+{
+/**
+ * @brief Whether objects of type @p V are laid out exactly as arrays of @p N elements of type @p T.
+ *
+ * Such objects occupy no more storage and require no stricter alignment than the array,
+ * and they are standard-layout and trivially copyable whenever @p T is. Contiguous ranges of them can therefore
+ * be copied to and from buffers of @p T with @c std::memcpy, e.g. for uploading to GPU buffers.
+ *
+ * @tparam V object type
+ * @tparam T element type
+ * @tparam N number of elements
+ */
+template <typename V, typename T, std::size_t N>
+concept array_layout = sizeof(V) == N * sizeof(T) && alignof(V) == alignof(T)
+                    && (!std::is_standard_layout_v<T> || std::is_standard_layout_v<V>)
+                    && (!std::is_trivially_copyable_v<T> || std::is_trivially_copyable_v<V>);
+
+/**
+ * @brief Over-aligned variant of a type.
+ *
+ * It is @p V aligned to and padded to a multiple of @p Alignment bytes, e.g. so that each of contiguous @c vec<3,float>
+ * occupies a 16-byte slot, as expected by aligned SIMD loads and by @c std140 GPU buffer layouts.
+ * Since it derives from @p V, it is accepted by all of the operations on @p V, results of which convert back to it.
+ *
+ * @tparam V           vector or matrix type
+ * @tparam Alignment   alignment in bytes, a power of two no less than the alignment of @p V
+ */
+template <typename V, std::size_t Alignment = 16>
+struct alignas(Alignment) aligned : V
+{
+	static_assert(std::has_single_bit(Alignment) && Alignment >= alignof(V));
+
+	using V::V;
+
+	/**
+	 * @brief Default constructor.
+	 */
+	constexpr aligned() noexcept(std::is_nothrow_default_constructible_v<V>) = default;
+
+	/**
+	 * @brief Converting constructor.
+	 *
+	 * This copies @p v.
+	 */
+	constexpr aligned(V const& v) noexcept(std::is_nothrow_copy_constructible_v<V>)
+		: V{v}
+	{
+	}
+};
+}
+
+#endif
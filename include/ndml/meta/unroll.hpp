@@ -0,0 +1,38 @@
+#ifndef NDML_META_UNROLL_HPP
+#define NDML_META_UNROLL_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace ndml::meta
+{
+/**
+ * @brief Compile-time index constant.
+ *
+ * @tparam I index
+ */
+template <std::size_t I>
+using index_constant = std::integral_constant<std::size_t, I>;
+
+/**
+ * @brief Invokes a functor with a pack of compile-time indices.
+ *
+ * This calls @p f with @c index_constant<I>{}... for every @c I in @f$ [0, N) @f$,
+ * so that the functor may expand an operation for every index with a fold expression
+ * instead of iterating over the indices at runtime.
+ *
+ * @tparam N  number of indices
+ * @tparam Fn functor type
+ *
+ * @param f functor
+ *
+ * @return the result of invoking @p f
+ */
+template <std::size_t N, typename Fn>
+constexpr auto unroll(Fn&& f) -> decltype(auto);
+}
+
+#include "unroll.inl"
+
+#endif
@@ -0,0 +1,10 @@
+namespace ndml::meta
+{
+template <std::size_t N, typename Fn>
+constexpr auto unroll(Fn&& f) -> decltype(auto)
+{
+	return [&f]<std::size_t... I>(std::index_sequence<I...>) -> decltype(auto) {
+		return std::forward<Fn>(f)(index_constant<I>{}...);
+	}(std::make_index_sequence<N>{});
+}
+}
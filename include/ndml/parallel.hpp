@@ -0,0 +1,7 @@
+#ifndef NDML_PARALLEL_HPP
+#define NDML_PARALLEL_HPP
+
+#include "parallel/pool.hpp"
+#include "parallel/algorithm.hpp"
+
+#endif
@@ -0,0 +1,219 @@
+#ifndef NDML_PARALLEL_ALGORITHM_HPP
+#define NDML_PARALLEL_ALGORITHM_HPP
+
+#include "pool.hpp"
+
+#include "ndml/affine/operation.hpp"
+#include "ndml/geometry/shape.hpp"
+#include "ndml/mat/operation.hpp"
+#include "ndml/quat/operation.hpp"
+#include "ndml/vec/operation.hpp"
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+namespace ndml::parallel
+{
+/**
+ * @brief Number of bytes of input per chunk.
+ *
+ * Inputs are split into chunks of as many elements as fit in this many bytes, i.e. a block small enough to stay in cache
+ * while it is processed, and large enough for the cost of claiming it to be negligible.
+ * As the split depends only on the number and size of elements, and not on the number of threads or on scheduling,
+ * so do the groupings of reductions, whose results are thus reproducible from run to run and from machine to machine.
+ */
+inline constexpr std::size_t block_size = 64 * 1024;
+
+/**
+ * @brief Parallel batch matrix-vector multiplication.
+ *
+ * Same as @c ndml::transform, with chunks of @p in processed across the threads of @p p.
+ *
+ * @warning Behavior is undefined if @p out is shorter than @p in.
+ *
+ * @return the first @c in.size() vectors of @p out
+ */
+template <std::size_t N, std::size_t M, typename T>
+auto transform(pool& p, mat<N, M, T> const& m, std::type_identity_t<std::span<vec<M, T> const>> in, std::type_identity_t<std::span<vec<N, T>>> out)
+	-> std::span<vec<N, T>>;
+
+/**
+ * @brief Parallel batch matrix-vector multiplication in structure of arrays form.
+ *
+ * Same as @c ndml::transform, with chunks of spans of @p in processed across the threads of @p p.
+ *
+ * @warning Behavior is undefined if any of spans of @p in or @p out is shorter than the first span of @p in.
+ */
+template <std::size_t N, std::size_t M, typename T>
+auto transform(
+	pool&                                                          p,
+	mat<N, M, T> const&                                            m,
+	std::type_identity_t<std::array<std::span<T const>, M>> const& in,
+	std::type_identity_t<std::array<std::span<T>, N>> const&       out
+) -> void;
+
+/**
+ * @brief Parallel batch conjugation of vectors by quaternion.
+ *
+ * Same as @c ndml::transform, with chunks of @p in processed across the threads of @p p.
+ *
+ * @warning Behavior is undefined if @p out is shorter than @p in.
+ *
+ * @return the first @c in.size() vectors of @p out
+ */
+template <typename T>
+auto transform(pool& p, quat<T> const& q, std::type_identity_t<std::span<vec<3, T> const>> in, std::type_identity_t<std::span<vec<3, T>>> out)
+	-> std::span<vec<3, T>>;
+
+/**
+ * @brief Parallel batch conjugation of vectors by quaternion in structure of arrays form.
+ *
+ * Same as @c ndml::transform, with chunks of spans of @p in processed across the threads of @p p.
+ *
+ * @warning Behavior is undefined if any of spans of @p in or @p out is shorter than the first span of @p in.
+ */
+template <typename T>
+auto transform(
+	pool&                                                          p,
+	quat<T> const&                                                 q,
+	std::type_identity_t<std::array<std::span<T const>, 3>> const& in,
+	std::type_identity_t<std::array<std::span<T>, 3>> const&       out
+) -> void;
+
+/**
+ * @brief Parallel batch transformation of points.
+ *
+ * Same as @c ndml::transform, with chunks of @p in processed across the threads of @p p.
+ *
+ * @warning Behavior is undefined if @p out is shorter than @p in.
+ *
+ * @return the first @c in.size() points of @p out
+ */
+template <std::size_t N, typename T>
+auto transform(pool& p, affine<N, T> const& a, std::type_identity_t<std::span<vec<N, T> const>> in, std::type_identity_t<std::span<vec<N, T>>> out)
+	-> std::span<vec<N, T>>;
+
+/**
+ * @brief Parallel transformation and reduction.
+ *
+ * This reduces the results of @p transform for each element of @p in with @p reduce, starting from @p init, e.g.
+ * @code
+ * auto const scatter = transform_reduce<vec<3, float>>(p, points, mat<3, 3, float>{}, std::plus<>{}, [](auto const& q) { return outer_product(q, q); });
+ * @endcode
+ * Each chunk of @p in is reduced in order on a single thread, and the results of chunks are reduced in order once all of them are done,
+ * so that the result does not depend on the number of threads. It may differ from that of the sequential reduction of all elements
+ * if @p reduce is not associative, e.g. due to rounding of floating-point sums, but is the same for each run on given @p in.
+ *
+ * @tparam In element type
+ *
+ * @param p         thread pool
+ * @param in        elements
+ * @param init      initial value
+ * @param reduce    associative function reducing two values of type @p Init into one
+ * @param transform function transforming an element into a value of type @p Init
+ *
+ * @return @p init reduced with the transformed elements of @p in
+ */
+template <typename In, typename Init, typename BinaryFn, typename UnaryFn>
+[[nodiscard]]
+auto transform_reduce(pool& p, std::type_identity_t<std::span<In const>> in, Init init, BinaryFn const& reduce, UnaryFn const& transform) -> Init;
+
+/**
+ * @brief Parallel sum.
+ *
+ * The summation is grouped by chunks as is that of @ref transform_reduce.
+ *
+ * @tparam V element type, e.g. @c vec, @c mat, or @c quat
+ *
+ * @return the sum of elements of @p in, or a value-initialized @p V if it is empty
+ */
+template <typename V>
+[[nodiscard]]
+auto sum(pool& p, std::type_identity_t<std::span<V const>> in) -> V;
+
+/**
+ * @brief Parallel component-wise minimum of vectors.
+ *
+ * @warning Behavior is undefined if @p in is empty.
+ *
+ * @return the vector whose components are the least of the respective components of vectors of @p in
+ */
+template <std::size_t N, typename T>
+[[nodiscard]]
+auto minimum(pool& p, std::type_identity_t<std::span<vec<N, T> const>> in) -> vec<N, T>;
+
+/**
+ * @brief Parallel component-wise maximum of vectors.
+ *
+ * @warning Behavior is undefined if @p in is empty.
+ *
+ * @return the vector whose components are the greatest of the respective components of vectors of @p in
+ */
+template <std::size_t N, typename T>
+[[nodiscard]]
+auto maximum(pool& p, std::type_identity_t<std::span<vec<N, T> const>> in) -> vec<N, T>;
+
+/**
+ * @brief Parallel axis-aligned bounding box of points.
+ *
+ * Same as @ref minimum and @ref maximum in a single pass over @p in.
+ *
+ * @warning Behavior is undefined if @p in is empty.
+ *
+ * @return the least axis-aligned bounding box of points of @p in
+ */
+template <typename T>
+[[nodiscard]]
+auto bounds(pool& p, std::type_identity_t<std::span<vec<3, T> const>> in) -> aabb<T>;
+
+/**
+ * @brief Parallel centroid of points.
+ *
+ * The summation is grouped by chunks as is that of @ref transform_reduce.
+ *
+ * @warning Behavior is undefined if @p in is empty.
+ *
+ * @return the mean of points of @p in
+ */
+template <std::size_t N, typename T>
+[[nodiscard]]
+auto centroid(pool& p, std::type_identity_t<std::span<vec<N, T> const>> in) -> vec<N, T>;
+
+/**
+ * @brief Parallel composition of a chain of transformations.
+ *
+ * This calculates the product of transformations of @p chain in order, i.e. the transformation applying the last of them first,
+ * as does @c ndml::compose. The multiplication is grouped by chunks as is the reduction of @ref transform_reduce.
+ *
+ * @tparam M transformation type, e.g. @c mat, @c affine, @c quat, or @c dual_quat
+ *
+ * @warning Behavior is undefined if @p chain is empty.
+ *
+ * @return the composition of transformations of @p chain
+ */
+template <typename M>
+[[nodiscard]]
+auto compose(pool& p, std::type_identity_t<std::span<M const>> chain) -> M;
+
+/**
+ * @brief Parallel batch composition of transformations.
+ *
+ * Calculates the product of each transformation of @p lhs and the respective one of @p rhs,
+ * and stores the results to the respective transformations of @p out.
+ *
+ * @tparam M transformation type, e.g. @c mat, @c affine, @c quat, or @c dual_quat
+ *
+ * @warning Behavior is undefined if @p rhs or @p out is shorter than @p lhs.
+ *
+ * @return the first @c lhs.size() transformations of @p out
+ */
+template <typename M>
+auto compose(pool& p, std::type_identity_t<std::span<M const>> lhs, std::type_identity_t<std::span<M const>> rhs, std::type_identity_t<std::span<M>> out)
+	-> std::span<M>;
+}
+
+#include "algorithm.inl"
+
+#endif
@@ -0,0 +1,244 @@
+#include "ndml/meta/unroll.hpp"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace ndml::parallel
+{
+namespace detail
+{
+/**
+ * @brief Number of elements of type @p In per chunk.
+ */
+template <typename In>
+constexpr std::size_t chunk_length = std::max<std::size_t>(block_size / sizeof(In), 1);
+
+/**
+ * @brief Runs @p f with the offset and length of each chunk of @p count elements of type @p In across the threads of @p p.
+ */
+template <typename In, typename BlockFn>
+auto for_each_block(pool& p, std::size_t count, BlockFn const& f) -> void
+{
+	constexpr auto length = chunk_length<In>;
+
+	p.run((count + length - 1) / length, [&f, count, length](std::size_t chunk) { f(chunk * length, std::min(length, count - chunk * length)); });
+}
+
+/**
+ * @brief Reduces the results of @p transform for each element of @p in with @p reduce, chunk by chunk.
+ *
+ * @warning Behavior is undefined if @p in is empty.
+ */
+template <typename In, typename BinaryFn, typename UnaryFn>
+auto fold(pool& p, std::span<In const> in, BinaryFn const& reduce, UnaryFn const& transform)
+{
+	using result_type = std::remove_cvref_t<std::invoke_result_t<UnaryFn const&, In const&>>;
+
+	constexpr auto length = chunk_length<In>;
+
+	// partials are reduced in order of chunks after all of them are done, so that the grouping is that of the split alone
+	std::vector<result_type> partials((in.size() + length - 1) / length);
+
+	for_each_block<In>(
+		p,
+		in.size(),
+		[&](std::size_t offset, std::size_t count)
+		{
+			result_type partial = transform(in[offset]);
+			for (std::size_t i = offset + 1; i < offset + count; ++i)
+			{
+				partial = reduce(std::move(partial), transform(in[i]));
+			}
+
+			partials[offset / length] = std::move(partial);
+		}
+	);
+
+	auto result = std::move(partials.front());
+	for (std::size_t chunk = 1; chunk < partials.size(); ++chunk)
+	{
+		result = reduce(std::move(result), std::move(partials[chunk]));
+	}
+
+	return result;
+}
+
+/**
+ * @brief Function object returning its argument.
+ */
+inline constexpr auto identity = [](auto const& x) -> decltype(auto) { return x; };
+
+/**
+ * @brief Component-wise minimum of two vectors.
+ */
+template <std::size_t N, typename T>
+constexpr auto lower(vec<N, T> const& lhs, vec<N, T> const& rhs) noexcept -> vec<N, T>
+{
+	vec<N, T> v;
+	meta::unroll<N>([&](auto... i) { ((get<i>(v) = get<i>(rhs) < get<i>(lhs) ? get<i>(rhs) : get<i>(lhs)), ...); });
+
+	return v;
+}
+
+/**
+ * @brief Component-wise maximum of two vectors.
+ */
+template <std::size_t N, typename T>
+constexpr auto upper(vec<N, T> const& lhs, vec<N, T> const& rhs) noexcept -> vec<N, T>
+{
+	vec<N, T> v;
+	meta::unroll<N>([&](auto... i) { ((get<i>(v) = get<i>(lhs) < get<i>(rhs) ? get<i>(rhs) : get<i>(lhs)), ...); });
+
+	return v;
+}
+}
+
+template <std::size_t N, std::size_t M, typename T>
+auto transform(pool& p, mat<N, M, T> const& m, std::type_identity_t<std::span<vec<M, T> const>> in, std::type_identity_t<std::span<vec<N, T>>> out)
+	-> std::span<vec<N, T>>
+{
+	detail::for_each_block<vec<M, T>>(p, in.size(), [&](std::size_t offset, std::size_t count) { ndml::transform(m, in.subspan(offset, count), out.subspan(offset, count)); });
+
+	return out.first(in.size());
+}
+
+template <std::size_t N, std::size_t M, typename T>
+auto transform(
+	pool&                                                          p,
+	mat<N, M, T> const&                                            m,
+	std::type_identity_t<std::array<std::span<T const>, M>> const& in,
+	std::type_identity_t<std::array<std::span<T>, N>> const&       out
+) -> void
+{
+	detail::for_each_block<vec<M, T>>(
+		p,
+		in[0].size(),
+		[&](std::size_t offset, std::size_t count)
+		{
+			std::array<std::span<T const>, M> block_in;
+			std::array<std::span<T>, N>       block_out;
+			meta::unroll<M>([&](auto... k) { ((block_in[k] = in[k].subspan(offset, count)), ...); });
+			meta::unroll<N>([&](auto... r) { ((block_out[r] = out[r].subspan(offset, count)), ...); });
+
+			ndml::transform(m, block_in, block_out);
+		}
+	);
+}
+
+template <typename T>
+auto transform(pool& p, quat<T> const& q, std::type_identity_t<std::span<vec<3, T> const>> in, std::type_identity_t<std::span<vec<3, T>>> out)
+	-> std::span<vec<3, T>>
+{
+	detail::for_each_block<vec<3, T>>(p, in.size(), [&](std::size_t offset, std::size_t count) { ndml::transform(q, in.subspan(offset, count), out.subspan(offset, count)); });
+
+	return out.first(in.size());
+}
+
+template <typename T>
+auto transform(
+	pool&                                                          p,
+	quat<T> const&                                                 q,
+	std::type_identity_t<std::array<std::span<T const>, 3>> const& in,
+	std::type_identity_t<std::array<std::span<T>, 3>> const&       out
+) -> void
+{
+	detail::for_each_block<vec<3, T>>(
+		p,
+		in[0].size(),
+		[&](std::size_t offset, std::size_t count)
+		{
+			ndml::transform(
+				q,
+				{in[0].subspan(offset, count), in[1].subspan(offset, count), in[2].subspan(offset, count)},
+				{out[0].subspan(offset, count), out[1].subspan(offset, count), out[2].subspan(offset, count)}
+			);
+		}
+	);
+}
+
+template <std::size_t N, typename T>
+auto transform(pool& p, affine<N, T> const& a, std::type_identity_t<std::span<vec<N, T> const>> in, std::type_identity_t<std::span<vec<N, T>>> out)
+	-> std::span<vec<N, T>>
+{
+	detail::for_each_block<vec<N, T>>(p, in.size(), [&](std::size_t offset, std::size_t count) { ndml::transform(a, in.subspan(offset, count), out.subspan(offset, count)); });
+
+	return out.first(in.size());
+}
+
+template <typename In, typename Init, typename BinaryFn, typename UnaryFn>
+auto transform_reduce(pool& p, std::type_identity_t<std::span<In const>> in, Init init, BinaryFn const& reduce, UnaryFn const& transform) -> Init
+{
+	if (in.empty())
+	{
+		return init;
+	}
+
+	return reduce(std::move(init), detail::fold(p, in, reduce, [&transform](In const& x) -> Init { return transform(x); }));
+}
+
+template <typename V>
+auto sum(pool& p, std::type_identity_t<std::span<V const>> in) -> V
+{
+	if (in.empty())
+	{
+		return V{};
+	}
+
+	return detail::fold(p, in, [](V const& lhs, V const& rhs) -> V { return lhs + rhs; }, detail::identity);
+}
+
+template <std::size_t N, typename T>
+auto minimum(pool& p, std::type_identity_t<std::span<vec<N, T> const>> in) -> vec<N, T>
+{
+	return detail::fold(p, in, detail::lower<N, T>, detail::identity);
+}
+
+template <std::size_t N, typename T>
+auto maximum(pool& p, std::type_identity_t<std::span<vec<N, T> const>> in) -> vec<N, T>
+{
+	return detail::fold(p, in, detail::upper<N, T>, detail::identity);
+}
+
+template <typename T>
+auto bounds(pool& p, std::type_identity_t<std::span<vec<3, T> const>> in) -> aabb<T>
+{
+	return detail::fold(
+		p,
+		in,
+		[](aabb<T> const& lhs, aabb<T> const& rhs) -> aabb<T> { return {detail::lower(lhs.lower, rhs.lower), detail::upper(lhs.upper, rhs.upper)}; },
+		[](vec<3, T> const& q) -> aabb<T> { return {q, q}; }
+	);
+}
+
+template <std::size_t N, typename T>
+auto centroid(pool& p, std::type_identity_t<std::span<vec<N, T> const>> in) -> vec<N, T>
+{
+	return sum<vec<N, T>>(p, in) / static_cast<T>(in.size());
+}
+
+template <typename M>
+auto compose(pool& p, std::type_identity_t<std::span<M const>> chain) -> M
+{
+	return detail::fold(p, chain, [](M const& lhs, M const& rhs) -> M { return lhs * rhs; }, detail::identity);
+}
+
+template <typename M>
+auto compose(pool& p, std::type_identity_t<std::span<M const>> lhs, std::type_identity_t<std::span<M const>> rhs, std::type_identity_t<std::span<M>> out)
+	-> std::span<M>
+{
+	detail::for_each_block<M>(
+		p,
+		lhs.size(),
+		[&](std::size_t offset, std::size_t count)
+		{
+			for (std::size_t i = offset; i < offset + count; ++i)
+			{
+				out[i] = lhs[i] * rhs[i];
+			}
+		}
+	);
+
+	return out.first(lhs.size());
+}
+}
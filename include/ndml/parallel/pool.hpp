@@ -0,0 +1,119 @@
+#ifndef NDML_PARALLEL_POOL_HPP
+#define NDML_PARALLEL_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+namespace ndml::parallel
+{
+/**
+ * @brief Pool of threads running chunks of batch work.
+ *
+ * Work is submitted as a number of chunks, which the threads of the pool, joined by the submitting thread,
+ * claim one by one from a shared counter, so that threads finishing their chunks early take over the remaining ones.
+ * The pool is not a general task scheduler: it runs a single batch at a time, and returns once all of its chunks are done.
+ */
+struct pool
+{
+	/**
+	 * @brief Constructor from thread count.
+	 *
+	 * This starts @p thread_count less one threads, as the thread submitting work takes part in it.
+	 *
+	 * @param thread_count number of threads running chunks, which is at least one
+	 */
+	explicit pool(std::size_t thread_count = std::thread::hardware_concurrency());
+
+	pool(pool const&) = delete;
+
+	auto operator=(pool const&) -> pool& = delete;
+
+	/**
+	 * @brief Destructor.
+	 *
+	 * This stops and joins the threads of the pool.
+	 */
+	~pool();
+
+	/**
+	 * @brief Number of threads running chunks, including the submitting thread.
+	 */
+	[[nodiscard]]
+	auto thread_count(this pool const& self) noexcept -> std::size_t;
+
+	/**
+	 * @brief Runs @p f for each chunk index in range @f$ [0, chunk\_count) @f$ across the threads of the pool.
+	 *
+	 * This returns once all of the chunks are done. Chunks run in no particular order, possibly concurrently,
+	 * so that @p f must only write to data specific to its chunk. If called from a chunk of this pool,
+	 * e.g. by an algorithm nested in another one, the chunks run on the calling thread in order.
+	 *
+	 * @warning Behavior is undefined if @p f throws, as the exception cannot be propagated across threads.
+	 *
+	 * @param chunk_count number of chunks
+	 * @param f           function called with the index of each chunk
+	 */
+	template <typename ChunkFn>
+	auto run(std::size_t chunk_count, ChunkFn const& f) -> void;
+
+private:
+	/// Batch being run.
+	struct job
+	{
+		/// Function calling the chunk function with a chunk index.
+		void (*invoke)(void const* f, std::size_t chunk) noexcept;
+
+		/// Chunk function.
+		void const* f;
+
+		/// Number of chunks.
+		std::size_t chunk_count;
+
+		/// Index of the next chunk to claim.
+		std::atomic<std::size_t> next;
+	};
+
+	/**
+	 * @brief Claims and runs chunks of @p j until none are left.
+	 */
+	auto work(job& j) noexcept -> void;
+
+	/**
+	 * @brief Body of the threads of the pool, waiting for and working on batches until @p stop is requested.
+	 */
+	auto loop(std::stop_token stop) noexcept -> void;
+
+	/// Serializes submissions from different threads.
+	std::mutex submit_mutex_;
+
+	/// Guards the current batch and the numbers of workers.
+	std::mutex mutex_;
+
+	/// Notifies threads of the pool of a new batch.
+	std::condition_variable_any wake_;
+
+	/// Notifies the submitting thread of threads of the pool leaving the batch.
+	std::condition_variable done_;
+
+	/// Current batch, or null if there is none.
+	job* job_ = nullptr;
+
+	/// Number of batches submitted so far, so that each thread joins each batch at most once.
+	std::size_t generation_ = 0;
+
+	/// Number of threads of the pool working on the current batch.
+	std::size_t active_ = 0;
+
+	/// Threads of the pool.
+	std::vector<std::jthread> threads_;
+};
+}
+
+#include "pool.inl"
+
+#endif
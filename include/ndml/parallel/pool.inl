@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <utility>
+
+namespace ndml::parallel
+{
+namespace detail
+{
+/**
+ * @brief Pool whose chunk the calling thread is running, or null if there is none.
+ */
+inline thread_local pool const* current = nullptr;
+}
+
+inline pool::pool(std::size_t thread_count)
+{
+	thread_count = std::max<std::size_t>(thread_count, 1);
+
+	threads_.reserve(thread_count - 1);
+	for (std::size_t i = 1; i < thread_count; ++i)
+	{
+		threads_.emplace_back([this](std::stop_token stop) { loop(std::move(stop)); });
+	}
+}
+
+inline pool::~pool()
+{
+	for (auto& thread : threads_)
+	{
+		thread.request_stop();
+	}
+
+	// stop requests notify waiting threads themselves, joining is left to the destructors of the threads
+	threads_.clear();
+}
+
+inline auto pool::thread_count(this pool const& self) noexcept -> std::size_t
+{
+	return self.threads_.size() + 1;
+}
+
+template <typename ChunkFn>
+auto pool::run(std::size_t chunk_count, ChunkFn const& f) -> void
+{
+	if (chunk_count == 0)
+	{
+		return;
+	}
+
+	if (chunk_count == 1 || threads_.empty() || detail::current == this)
+	{
+		for (std::size_t chunk = 0; chunk < chunk_count; ++chunk)
+		{
+			f(chunk);
+		}
+
+		return;
+	}
+
+	job j{
+		.invoke      = [](void const* f, std::size_t chunk) noexcept { (*static_cast<ChunkFn const*>(f))(chunk); },
+		.f           = &f,
+		.chunk_count = chunk_count,
+		.next        = 0,
+	};
+
+	std::scoped_lock const submit{submit_mutex_};
+
+	{
+		std::scoped_lock const lock{mutex_};
+
+		job_ = &j;
+		++generation_;
+	}
+
+	wake_.notify_all();
+
+	work(j);
+
+	// all of the chunks are claimed, so the batch is done once the threads which claimed some of them leave it
+	std::unique_lock lock{mutex_};
+
+	job_ = nullptr;
+	done_.wait(lock, [this] { return active_ == 0; });
+}
+
+inline auto pool::work(job& j) noexcept -> void
+{
+	auto const* const previous = std::exchange(detail::current, this);
+
+	for (auto chunk = j.next.fetch_add(1, std::memory_order_relaxed); chunk < j.chunk_count; chunk = j.next.fetch_add(1, std::memory_order_relaxed))
+	{
+		j.invoke(j.f, chunk);
+	}
+
+	detail::current = previous;
+}
+
+inline auto pool::loop(std::stop_token stop) noexcept -> void
+{
+	std::size_t seen = 0;
+
+	while (true)
+	{
+		std::unique_lock lock{mutex_};
+
+		if (!wake_.wait(lock, stop, [this, &seen] { return generation_ != seen && job_ != nullptr; }))
+		{
+			return;
+		}
+
+		seen = generation_;
+
+		auto* const j = job_;
+		++active_;
+
+		lock.unlock();
+
+		work(*j);
+
+		lock.lock();
+
+		if (--active_ == 0)
+		{
+			done_.notify_one();
+		}
+	}
+}
+}
@@ -3,6 +3,14 @@
 
 #include "quat.hpp"
 
+#include "ndml/mat/mat.hpp"
+#include "ndml/mat/operation.hpp"
+#include "ndml/math/policy.hpp"
+
+#include <array>
+#include <span>
+#include <type_traits>
+
 namespace ndml
 {
 /**
@@ -40,6 +48,91 @@ template <typename T>
 [[nodiscard]]
 constexpr auto axis_angle(quat<T> const& q) noexcept -> std::pair<vec<3, T>, T>;
 
+/**
+ * @brief Normalized linear interpolation of versors.
+ *
+ * This linearly interpolates between @p from and @p to along the shortest path, i.e. negating @p to if their dot product is negative,
+ * and normalizes the result. Angular velocity is not constant, but the result is close to that of @ref slerp for nearby versors.
+ *
+ * @tparam T element type
+ * @tparam P math policy of the normalization
+ *
+ * @param from   versor at @p t equal to zero
+ * @param to     versor at @p t equal to one
+ * @param t      interpolation parameter, usually within @f$ [0, 1] @f$
+ * @param policy math policy
+ *
+ * @return the interpolated versor
+ */
+template <typename T, math::policy P = math::default_policy>
+[[nodiscard]]
+constexpr auto nlerp(quat<T> const& from, quat<T> const& to, typename quat<T>::value_type const& t, P policy = P{}) noexcept -> quat<T>;
+
+/**
+ * @brief Spherical linear interpolation of versors.
+ *
+ * This interpolates between @p from and @p to along the shortest great arc, i.e. negating @p to if their dot product is negative,
+ * at constant angular velocity. The precise policy evaluates @f$ \frac{\sin((1 - t) \theta)}{\sin \theta} @f$ and
+ * @f$ \frac{\sin(t \theta)}{\sin \theta} @f$ as weights of @p from and @p to, falling back to @ref nlerp for nearly equal versors.
+ * The fast policy approximates the weights by polynomials in @f$ \cos \theta @f$ and @p t, without inverse trigonometric functions,
+ * sines, or branches, as per D. Eberly, "A Fast and Accurate Algorithm for Computing SLERP". Absolute error of the weights is about
+ * @c 1e-7 for versors up to a right angle apart, i.e. for rotations up to a straight angle apart, and about @c 2e-5 in the worst case.
+ *
+ * @tparam T element type
+ * @tparam P math policy
+ *
+ * @param from   versor at @p t equal to zero
+ * @param to     versor at @p t equal to one
+ * @param t      interpolation parameter within @f$ [0, 1] @f$
+ * @param policy math policy
+ *
+ * @return the interpolated versor
+ */
+template <typename T, math::policy P = math::default_policy>
+[[nodiscard]]
+constexpr auto slerp(quat<T> const& from, quat<T> const& to, typename quat<T>::value_type const& t, P policy = P{}) noexcept -> quat<T>;
+
+/**
+ * @brief Batch normalized linear interpolation of versors.
+ *
+ * Interpolates between each versor of @p from and the respective versor of @p to by the respective parameter of @p t,
+ * as per @ref nlerp, and stores the results to the respective versors of @p out, e.g. for sampling keyframe pairs of animation tracks.
+ * @p out may refer to the same versors as @p from or @p to.
+ *
+ * @warning Behavior is undefined if any of @p to, @p t, or @p out is shorter than @p from.
+ *
+ * @return the first @c from.size() versors of @p out
+ */
+template <typename T, math::policy P = math::default_policy>
+constexpr auto nlerp(
+	std::type_identity_t<std::span<quat<T> const>> from,
+	std::type_identity_t<std::span<quat<T> const>> to,
+	std::type_identity_t<std::span<T const>>       t,
+	std::type_identity_t<std::span<quat<T>>>       out,
+	P                                              policy = P{}
+) noexcept -> std::span<quat<T>>;
+
+/**
+ * @brief Batch spherical linear interpolation of versors.
+ *
+ * Interpolates between each versor of @p from and the respective versor of @p to by the respective parameter of @p t,
+ * as per @ref slerp, and stores the results to the respective versors of @p out, e.g. for sampling keyframe pairs of animation tracks.
+ * Given the fast policy, no element is branched on, so the loop is amenable to vectorization.
+ * @p out may refer to the same versors as @p from or @p to.
+ *
+ * @warning Behavior is undefined if any of @p to, @p t, or @p out is shorter than @p from.
+ *
+ * @return the first @c from.size() versors of @p out
+ */
+template <typename T, math::policy P = math::default_policy>
+constexpr auto slerp(
+	std::type_identity_t<std::span<quat<T> const>> from,
+	std::type_identity_t<std::span<quat<T> const>> to,
+	std::type_identity_t<std::span<T const>>       t,
+	std::type_identity_t<std::span<quat<T>>>       out,
+	P                                              policy = P{}
+) noexcept -> std::span<quat<T>>;
+
 /**
  * @brief Quaternion Hamilton multiplication assignment operator.
  *
@@ -65,6 +158,38 @@ constexpr auto operator*(quat<T> const& lhs, quat<T> const& rhs) noexcept -> qua
 template <typename T>
 [[nodiscard]]
 constexpr auto operator*(quat<T> const& q, vec<3, T> const& v) noexcept -> vec<3, T>;
+
+/**
+ * @brief Batch conjugation of vectors by quaternion.
+ *
+ * Conjugates each vector of @p in by @p q and stores the results to the respective vectors of @p out.
+ * The rotation matrix of @p q is calculated once and applied to all vectors.
+ * @p in and @p out may refer to the same vectors.
+ *
+ * @warning Behavior is undefined if @p out is shorter than @p in.
+ *
+ * @return the first @c in.size() vectors of @p out
+ */
+template <typename T>
+constexpr auto transform(quat<T> const& q, std::type_identity_t<std::span<vec<3, T> const>> in, std::type_identity_t<std::span<vec<3, T>>> out) noexcept
+	-> std::span<vec<3, T>>;
+
+/**
+ * @brief Batch conjugation of vectors by quaternion in structure of arrays form.
+ *
+ * Conjugates each vector whose components are the respective elements of spans of @p in by @p q,
+ * and stores the components of the results to the respective elements of spans of @p out.
+ * The rotation matrix of @p q is calculated once and applied to all vectors.
+ * @p in and @p out may refer to the same elements.
+ *
+ * @warning Behavior is undefined if any of spans of @p in or @p out is shorter than the first span of @p in.
+ */
+template <typename T>
+constexpr auto transform(
+	quat<T> const&                                                 q,
+	std::type_identity_t<std::array<std::span<T const>, 3>> const& in,
+	std::type_identity_t<std::array<std::span<T>, 3>> const&       out
+) noexcept -> void;
 }
 
 #include "operation.inl"
@@ -1,5 +1,10 @@
+#include "ndml/instrument/zone.hpp"
+#include "ndml/math/function.hpp"
+#include "ndml/meta/unroll.hpp"
+
 #include <cmath>
 #include <limits>
+#include <utility>
 
 namespace ndml
 {
@@ -18,7 +23,9 @@ constexpr auto inverse(quat<T> const& q) noexcept -> quat<T>
 template <typename T>
 constexpr auto axis_angle(quat<T> const& q) noexcept -> std::pair<vec<3, T>, T>
 {
-	vec<3, T> const imag{q.x, q.y, q.z};
+	NDML_INSTRUMENT_ZONE(axis_angle);
+
+	auto const imag = q.xyz();
 
 	auto const imag_norm = norm(imag);
 
@@ -30,6 +37,128 @@ constexpr auto axis_angle(quat<T> const& q) noexcept -> std::pair<vec<3, T>, T>
 	return {imag / imag_norm, 2 * std::atan2(imag_norm, q.w)};
 }
 
+namespace detail
+{
+/**
+ * @brief Weights of spherical linear interpolation as polynomials.
+ *
+ * The weight of @p to is @f$ \frac{\sin(t \theta)}{\sin \theta} = t \prod_{i = 1}^{\infty} (1 + \frac{t^2 - i^2}{i (2 i + 1)} (x - 1)) @f$ in nested form,
+ * where @f$ x = \cos \theta @f$, and that of @p from is the same at @f$ 1 - t @f$.
+ * The last retained term is scaled to compensate for the truncated ones.
+ *
+ * @param t                 interpolation parameter
+ * @param cos_angle_minus_1 @f$ x - 1 @f$, within @f$ [-1, 0] @f$
+ *
+ * @return the weights of @p from and @p to, respectively
+ */
+template <typename T>
+constexpr auto slerp_weights(T const& t, T const& cos_angle_minus_1) noexcept -> std::pair<T, T>
+{
+	constexpr std::size_t term_count = 8;
+	constexpr T           correction(1.85298109240830);
+
+	auto const s = T{1} - t;
+
+	auto const t_squared = t * t;
+	auto const s_squared = s * s;
+
+	T t_product{1};
+	T s_product{1};
+
+	meta::unroll<term_count>([&](auto... k) {
+		(
+			[&] {
+				constexpr auto i     = term_count - decltype(k)::value;
+				constexpr auto scale = i == term_count ? correction : T{1};
+				constexpr auto u     = scale / static_cast<T>(i * (2 * i + 1));
+				constexpr auto v     = scale * static_cast<T>(i) / static_cast<T>(2 * i + 1);
+
+				t_product = T{1} + (u * t_squared - v) * cos_angle_minus_1 * t_product;
+				s_product = T{1} + (u * s_squared - v) * cos_angle_minus_1 * s_product;
+			}(),
+			...
+		);
+	});
+
+	return {s * s_product, t * t_product};
+}
+}
+
+template <typename T, math::policy P>
+constexpr auto nlerp(quat<T> const& from, quat<T> const& to, typename quat<T>::value_type const& t, P policy) noexcept -> quat<T>
+{
+	auto const sign = std::copysign(T{1}, dot(from, to));
+
+	return normal(from * (T{1} - t) + to * (sign * t), policy);
+}
+
+template <typename T, math::policy P>
+constexpr auto slerp(quat<T> const& from, quat<T> const& to, typename quat<T>::value_type const& t, P policy) noexcept -> quat<T>
+{
+	NDML_INSTRUMENT_ZONE(slerp);
+
+	auto const cos_angle = dot(from, to);
+	auto const sign      = std::copysign(T{1}, cos_angle);
+	auto const abs_cos   = sign * cos_angle;
+
+	if constexpr (std::same_as<P, math::fast_t>)
+	{
+		auto const [from_weight, to_weight] = detail::slerp_weights(t, abs_cos - T{1});
+
+		return from * from_weight + to * (sign * to_weight);
+	}
+	else
+	{
+		// weights are indeterminate for nearly equal versors, whereas linear interpolation is accurate for them
+		if (abs_cos >= T{1} - std::numeric_limits<T>::epsilon())
+		{
+			return nlerp(from, to, t, policy);
+		}
+
+		auto const angle         = std::acos(abs_cos);
+		auto const inv_sin_angle = T{1} / static_cast<T>(std::sin(angle));
+
+		auto const from_weight = static_cast<T>(std::sin((T{1} - t) * angle)) * inv_sin_angle;
+		auto const to_weight   = static_cast<T>(std::sin(t * angle)) * inv_sin_angle * sign;
+
+		return from * from_weight + to * to_weight;
+	}
+}
+
+template <typename T, math::policy P>
+constexpr auto nlerp(
+	std::type_identity_t<std::span<quat<T> const>> from,
+	std::type_identity_t<std::span<quat<T> const>> to,
+	std::type_identity_t<std::span<T const>>       t,
+	std::type_identity_t<std::span<quat<T>>>       out,
+	P                                              policy
+) noexcept -> std::span<quat<T>>
+{
+	for (std::size_t i = 0; i < from.size(); ++i)
+	{
+		out[i] = nlerp(from[i], to[i], t[i], policy);
+	}
+
+	return out.first(from.size());
+}
+
+template <typename T, math::policy P>
+constexpr auto slerp(
+	std::type_identity_t<std::span<quat<T> const>> from,
+	std::type_identity_t<std::span<quat<T> const>> to,
+	std::type_identity_t<std::span<T const>>       t,
+	std::type_identity_t<std::span<quat<T>>>       out,
+	P                                              policy
+) noexcept -> std::span<quat<T>>
+{
+	for (std::size_t i = 0; i < from.size(); ++i)
+	{
+		out[i] = slerp(from[i], to[i], t[i], policy);
+	}
+
+	return out.first(from.size());
+}
+
 template <typename T>
 constexpr auto operator*=(quat<T>& lhs, quat<T> const& rhs) noexcept -> quat<T>&
 {
@@ -51,9 +180,80 @@ constexpr auto operator*(quat<T> const& lhs, quat<T> const& rhs) noexcept -> qua
 template <typename T>
 constexpr auto operator*(quat<T> const& q, vec<3, T> const& v) noexcept -> vec<3, T>
 {
-	vec<3, T> const imag{q.x, q.y, q.z};
+	auto const imag = q.xyz();
 	vec<3, T> const ort{cross(imag, v)};
 
 	return v + static_cast<T>(2) * (q.w * ort + cross(imag, ort));
 }
+
+namespace detail
+{
+/**
+ * @brief Matrix of conjugation by a quaternion.
+ *
+ * Expands @f$ v + s (w (u \times v) + u \times (u \times v)) @f$, where @f$ u @f$ is the imaginary part of @p q
+ * and @f$ s @f$ is equal to @p scale, into a linear map so that it is calculated once for any number of vectors.
+ * Matrices of four rows have the remaining row and column of the identity matrix.
+ */
+template <std::size_t N, typename T>
+constexpr auto conjugation_matrix(quat<T> const& q, T const& scale) noexcept -> mat<N, N, T>
+{
+	auto const x = q.x * scale;
+	auto const y = q.y * scale;
+	auto const z = q.z * scale;
+
+	auto const xx = q.x * x;
+	auto const yy = q.y * y;
+	auto const zz = q.z * z;
+	auto const xy = q.x * y;
+	auto const xz = q.x * z;
+	auto const yz = q.y * z;
+	auto const wx = q.w * x;
+	auto const wy = q.w * y;
+	auto const wz = q.w * z;
+
+	auto const m00 = T{1} - (yy + zz);
+	auto const m11 = T{1} - (xx + zz);
+	auto const m22 = T{1} - (xx + yy);
+
+	if constexpr (N == 3)
+	{
+		return {
+			vec<3, T>{    m00, xy + wz, xz - wy},
+			vec<3, T>{xy - wz,     m11, yz + wx},
+			vec<3, T>{xz + wy, yz - wx,     m22},
+		};
+	}
+	else
+	{
+		return {
+			vec<4, T>{    m00, xy + wz, xz - wy, T{0}},
+			vec<4, T>{xy - wz,     m11, yz + wx, T{0}},
+			vec<4, T>{xz + wy, yz - wx,     m22, T{0}},
+			vec<4, T>{   T{0},    T{0},    T{0}, T{1}},
+		};
+	}
+}
+}
+
+template <typename T>
+constexpr auto transform(quat<T> const& q, std::type_identity_t<std::span<vec<3, T> const>> in, std::type_identity_t<std::span<vec<3, T>>> out) noexcept
+	-> std::span<vec<3, T>>
+{
+	NDML_INSTRUMENT_ZONE(quat_transform);
+
+	return transform(detail::conjugation_matrix<3>(q, T{2}), in, out);
+}
+
+template <typename T>
+constexpr auto transform(
+	quat<T> const&                                                 q,
+	std::type_identity_t<std::array<std::span<T const>, 3>> const& in,
+	std::type_identity_t<std::array<std::span<T>, 3>> const&       out
+) noexcept -> void
+{
+	NDML_INSTRUMENT_ZONE(quat_transform);
+
+	transform(detail::conjugation_matrix<3>(q, T{2}), in, out);
+}
 }
@@ -2,6 +2,11 @@
 #define NDML_QUAT_TRANSFORM_HPP
 
 #include "quat.hpp"
+#include "operation.hpp"
+
+#include "ndml/math/policy.hpp"
+
+#include <cstddef>
 
 namespace ndml
 {
@@ -11,21 +16,43 @@ namespace ndml
  * This initializes a quaternion equal to @f$ \cos \frac \theta 2 + u \sin \frac \theta 2 @f$,
  * where @f$ u @f$ is equal to @p axis and @f$ \theta @f$ is equal to @p angle.
  *
- * @param axis  versor axis
- * @param angle angle in radians
+ * @param axis   versor axis
+ * @param angle  angle in radians
+ * @param policy math policy of sine and cosine calculation
+ */
+template <typename T, math::policy P = math::default_policy>
+[[nodiscard]]
+constexpr auto versor(vec<3, T> const& axis, typename vec<3, T>::value_type const& angle, P policy = P{}) noexcept -> quat<T>;
+
+/**
+ * @brief Versor from rotation matrix.
+ *
+ * This calculates the versor of the rotation given by the upper-left three-by-three block of @p m,
+ * which has to be orthonormal with a positive determinant, via Shepperd's method:
+ * the greatest of the diagonal sums determines which component is extracted from a square root,
+ * with the rest following from sums and differences of the off-diagonal elements.
+ *
+ * @tparam N number of rows and columns, either three or four
+ *
+ * @param m rotation matrix
  */
-template <typename T>
+template <std::size_t N, typename T>
 [[nodiscard]]
-constexpr auto versor(vec<3, T> const& axis, typename vec<3, T>::value_type const& angle) noexcept -> quat<T>;
+constexpr auto versor(mat<N, N, T> const& m) noexcept -> quat<T>
+	requires (N == 3 || N == 4);
 
 /**
  * @brief Quaternion to matrix conversion.
  *
- * This extracts axis and angle from @p q and creates a rotation matrix from them.
+ * This calculates the rotation matrix of @p q directly from products of its components,
+ * normalizing @p q on the way. Zero quaternion results in identity matrix.
+ *
+ * @tparam N number of rows and columns, either three or four
  */
-template <typename T>
+template <std::size_t N = 4, typename T>
 [[nodiscard]]
-constexpr auto rotation(quat<T> const& q) noexcept -> mat<4, 4, T>;
+constexpr auto rotation(quat<T> const& q) noexcept -> mat<N, N, T>
+	requires (N == 3 || N == 4);
 }
 
 #include "transform.inl"
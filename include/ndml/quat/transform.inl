@@ -1,25 +1,63 @@
-#include <limits>
+#include "ndml/instrument/zone.hpp"
+#include "ndml/math/function.hpp"
 
 namespace ndml
 {
-template <typename T>
-constexpr auto versor(vec<3, T> const& axis, typename vec<3, T>::value_type const& angle) noexcept -> quat<T>
+template <typename T, math::policy P>
+constexpr auto versor(vec<3, T> const& axis, typename vec<3, T>::value_type const& angle, P policy) noexcept -> quat<T>
 {
-	static constexpr auto half{static_cast<T>(1) / static_cast<T>(2)};
+	NDML_INSTRUMENT_ZONE(versor);
 
-	auto const half_angle = half * angle;
-	return {axis * std::sin(half_angle), std::cos(half_angle)};
+	constexpr auto half{static_cast<T>(1) / static_cast<T>(2)};
+
+	auto const [sin_half_angle, cos_half_angle] = math::sin_cos(half * angle, policy);
+	return {axis * sin_half_angle, cos_half_angle};
 }
 
-template <typename T>
-constexpr auto rotation(quat<T> const& q) noexcept -> mat<4, 4, T>
+template <std::size_t N, typename T>
+constexpr auto versor(mat<N, N, T> const& m) noexcept -> quat<T>
+	requires (N == 3 || N == 4)
 {
-	auto const [axis, angle] = axis_angle(q);
-	if (angle <= std::numeric_limits<T>::epsilon())
+	NDML_INSTRUMENT_ZONE(versor);
+
+	constexpr auto quarter{static_cast<T>(1) / static_cast<T>(4)};
+
+	auto const m00 = m[0, 0];
+	auto const m11 = m[1, 1];
+	auto const m22 = m[2, 2];
+
+	auto const trace = m00 + m11 + m22;
+
+	if (trace > T{0})
+	{
+		auto const s = 2 * math::sqrt(T{1} + trace, math::precise);
+		return {(m[1, 2] - m[2, 1]) / s, (m[2, 0] - m[0, 2]) / s, (m[0, 1] - m[1, 0]) / s, quarter * s};
+	}
+
+	if (m00 > m11 && m00 > m22)
 	{
-		return mat<4, 4, T>{1};
+		auto const s = 2 * math::sqrt(T{1} + m00 - m11 - m22, math::precise);
+		return {quarter * s, (m[0, 1] + m[1, 0]) / s, (m[2, 0] + m[0, 2]) / s, (m[1, 2] - m[2, 1]) / s};
 	}
 
-	return rotation(axis, angle);
+	if (m11 > m22)
+	{
+		auto const s = 2 * math::sqrt(T{1} + m11 - m00 - m22, math::precise);
+		return {(m[0, 1] + m[1, 0]) / s, quarter * s, (m[1, 2] + m[2, 1]) / s, (m[2, 0] - m[0, 2]) / s};
+	}
+
+	auto const s = 2 * math::sqrt(T{1} + m22 - m00 - m11, math::precise);
+	return {(m[2, 0] + m[0, 2]) / s, (m[1, 2] + m[2, 1]) / s, quarter * s, (m[0, 1] - m[1, 0]) / s};
+}
+
+template <std::size_t N, typename T>
+constexpr auto rotation(quat<T> const& q) noexcept -> mat<N, N, T>
+	requires (N == 3 || N == 4)
+{
+	NDML_INSTRUMENT_ZONE(quat_rotation);
+
+	auto const n = norm_squared(q);
+
+	return detail::conjugation_matrix<N>(q, n > T{0} ? T{2} / n : T{0});
 }
 }
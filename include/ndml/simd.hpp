@@ -0,0 +1,11 @@
+#ifndef NDML_SIMD_HPP
+#define NDML_SIMD_HPP
+
+#include "simd/simd.hpp"
+#include "simd/vec.hpp"
+#include "simd/mat.hpp"
+#include "simd/batch.hpp"
+#include "simd/geometry.hpp"
+#include "simd/convert.hpp"
+
+#endif
@@ -0,0 +1,69 @@
+#ifndef NDML_SIMD_BATCH_HPP
+#define NDML_SIMD_BATCH_HPP
+
+#include "mat.hpp"
+
+#include <array>
+#include <cstddef>
+#include <span>
+
+namespace ndml::simd
+{
+#if NDML_SIMD_SSE || NDML_SIMD_NEON
+/**
+ * @brief SIMD batch kernels for four-by-four single-precision matrices.
+ *
+ * Matrix columns are loaded into registers once per batch.
+ */
+template <>
+struct batch<mat<4, 4, float>>
+{
+	using mat_type    = mat<4, 4, float>;
+	using column_type = mat_type::column_type;
+	using value_type  = mat_type::value_type;
+
+	/**
+	 * @brief Matrix-vector multiplication of every vector of @p in, stored to @p out.
+	 */
+	static auto transform(mat_type const& m, std::span<column_type const> in, std::span<column_type> out) noexcept -> void;
+
+	/**
+	 * @brief Matrix-vector multiplication of every vector of structure of arrays @p in, stored to @p out.
+	 */
+	static auto transform(mat_type const& m, std::array<std::span<value_type const>, 4> const& in, std::array<std::span<value_type>, 4> const& out) noexcept -> void;
+};
+
+template <>
+inline constexpr bool batch_enabled<mat<4, 4, float>> = true;
+
+/**
+ * @brief SIMD batch kernels for three-by-three single-precision matrices.
+ *
+ * Four vectors are processed at a time, transposed in registers into a structure of arrays.
+ */
+template <>
+struct batch<mat<3, 3, float>>
+{
+	using mat_type    = mat<3, 3, float>;
+	using column_type = mat_type::column_type;
+	using value_type  = mat_type::value_type;
+
+	/**
+	 * @brief Matrix-vector multiplication of every vector of @p in, stored to @p out.
+	 */
+	static auto transform(mat_type const& m, std::span<column_type const> in, std::span<column_type> out) noexcept -> void;
+
+	/**
+	 * @brief Matrix-vector multiplication of every vector of structure of arrays @p in, stored to @p out.
+	 */
+	static auto transform(mat_type const& m, std::array<std::span<value_type const>, 3> const& in, std::array<std::span<value_type>, 3> const& out) noexcept -> void;
+};
+
+template <>
+inline constexpr bool batch_enabled<mat<3, 3, float>> = true;
+#endif
+}
+
+#include "batch.inl"
+
+#endif
@@ -0,0 +1,210 @@
+namespace ndml::simd
+{
+#if NDML_SIMD_SSE || NDML_SIMD_NEON
+namespace detail
+{
+/**
+ * @brief Register with all lanes set to @p s.
+ */
+inline auto broadcast(float s) noexcept -> column_kernel::register_type
+{
+#	if NDML_SIMD_SSE
+	return _mm_set1_ps(s);
+#	else
+	return vdupq_n_f32(s);
+#	endif
+}
+
+/**
+ * @brief Loads four consecutive scalars starting at @p p.
+ */
+inline auto load(float const* p) noexcept -> column_kernel::register_type
+{
+#	if NDML_SIMD_SSE
+	return _mm_loadu_ps(p);
+#	else
+	return vld1q_f32(p);
+#	endif
+}
+
+/**
+ * @brief Stores the lanes of @p r to four consecutive scalars starting at @p p.
+ */
+inline auto store(float* p, column_kernel::register_type r) noexcept -> void
+{
+#	if NDML_SIMD_SSE
+	_mm_storeu_ps(p, r);
+#	else
+	vst1q_f32(p, r);
+#	endif
+}
+
+/**
+ * @brief Linear combination of @p K registers with broadcast weights, i.e. @f$ \sum_k w_k v_k @f$.
+ */
+template <std::size_t K>
+inline auto combine(column_kernel::register_type const (&weights)[K], column_kernel::register_type const (&v)[K]) noexcept -> column_kernel::register_type
+{
+#	if NDML_SIMD_SSE
+	auto p = _mm_mul_ps(weights[0], v[0]);
+	for (std::size_t k = 1; k < K; ++k)
+	{
+		p = _mm_add_ps(p, _mm_mul_ps(weights[k], v[k]));
+	}
+#	else
+	auto p = vmulq_f32(weights[0], v[0]);
+	for (std::size_t k = 1; k < K; ++k)
+	{
+		p = vaddq_f32(p, vmulq_f32(weights[k], v[k]));
+	}
+#	endif
+
+	return p;
+}
+
+/**
+ * @brief Multiplies @p m by vectors given in structure of arrays form, four at a time.
+ *
+ * Elements of @p m are broadcast into registers once, remaining elements are processed one by one.
+ */
+template <std::size_t N>
+inline auto transform(mat<N, N, float> const& m, std::array<std::span<float const>, N> const& in, std::array<std::span<float>, N> const& out) noexcept -> void
+{
+	auto const count = in[0].size();
+
+	column_kernel::register_type weights[N][N];
+	for (std::size_t r = 0; r < N; ++r)
+	{
+		for (std::size_t k = 0; k < N; ++k)
+		{
+			weights[r][k] = broadcast(m[k, r]);
+		}
+	}
+
+	std::size_t i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		column_kernel::register_type v[N];
+		for (std::size_t k = 0; k < N; ++k)
+		{
+			v[k] = load(in[k].data() + i);
+		}
+
+		for (std::size_t r = 0; r < N; ++r)
+		{
+			store(out[r].data() + i, combine(weights[r], v));
+		}
+	}
+
+	for (; i < count; ++i)
+	{
+		float v[N];
+		for (std::size_t k = 0; k < N; ++k)
+		{
+			v[k] = in[k][i];
+		}
+
+		for (std::size_t r = 0; r < N; ++r)
+		{
+			float p = m[0, r] * v[0];
+			for (std::size_t k = 1; k < N; ++k)
+			{
+				p += m[k, r] * v[k];
+			}
+
+			out[r][i] = p;
+		}
+	}
+}
+}
+
+inline auto batch<mat<4, 4, float>>::transform(mat_type const& m, std::span<column_type const> in, std::span<column_type> out) noexcept -> void
+{
+	using detail::column_kernel;
+
+	column_kernel::register_type const columns[4]{
+		column_kernel::load(m[0]),
+		column_kernel::load(m[1]),
+		column_kernel::load(m[2]),
+		column_kernel::load(m[3]),
+	};
+
+	for (std::size_t i = 0; i < in.size(); ++i)
+	{
+		detail::store(out[i].data(), detail::combine(columns, column_kernel::load(in[i])));
+	}
+}
+
+inline auto batch<mat<4, 4, float>>::transform(mat_type const& m, std::array<std::span<value_type const>, 4> const& in, std::array<std::span<value_type>, 4> const& out) noexcept -> void
+{
+	detail::transform(m, in, out);
+}
+
+inline auto batch<mat<3, 3, float>>::transform(mat_type const& m, std::span<column_type const> in, std::span<column_type> out) noexcept -> void
+{
+	using detail::column_kernel;
+
+	column_kernel::register_type weights[3][3];
+	for (std::size_t r = 0; r < 3; ++r)
+	{
+		for (std::size_t k = 0; k < 3; ++k)
+		{
+			weights[r][k] = detail::broadcast(m[k, r]);
+		}
+	}
+
+	std::size_t i = 0;
+	for (; i + 4 <= in.size(); i += 4)
+	{
+		auto const* src = in[i].data();
+		auto*       dst = out[i].data();
+
+#	if NDML_SIMD_SSE
+		// x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3
+		auto const a = _mm_loadu_ps(src);
+		auto const b = _mm_loadu_ps(src + 4);
+		auto const c = _mm_loadu_ps(src + 8);
+
+		auto const ab = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1));
+		auto const bc = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3));
+
+		column_kernel::register_type const v[3]{
+			_mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0)),
+			_mm_shuffle_ps(ab, bc, _MM_SHUFFLE(2, 0, 2, 0)),
+			_mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 3, 0)), _MM_SHUFFLE(1, 0, 2, 0)),
+		};
+
+		auto const x = detail::combine(weights[0], v);
+		auto const y = detail::combine(weights[1], v);
+		auto const z = detail::combine(weights[2], v);
+
+		_mm_storeu_ps(dst, _mm_shuffle_ps(_mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0)));
+		_mm_storeu_ps(dst + 4, _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0)));
+		_mm_storeu_ps(dst + 8, _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
+#	else
+		auto const xyz = vld3q_f32(src);
+
+		column_kernel::register_type const v[3]{xyz.val[0], xyz.val[1], xyz.val[2]};
+
+		vst3q_f32(dst, {{detail::combine(weights[0], v), detail::combine(weights[1], v), detail::combine(weights[2], v)}});
+#	endif
+	}
+
+	for (; i < in.size(); ++i)
+	{
+		auto const v = in[i];
+
+		out[i] = {
+			m[0, 0] * v.x + m[1, 0] * v.y + m[2, 0] * v.z,
+			m[0, 1] * v.x + m[1, 1] * v.y + m[2, 1] * v.z,
+			m[0, 2] * v.x + m[1, 2] * v.y + m[2, 2] * v.z,
+		};
+	}
+}
+
+inline auto batch<mat<3, 3, float>>::transform(mat_type const& m, std::array<std::span<value_type const>, 3> const& in, std::array<std::span<value_type>, 3> const& out) noexcept -> void
+{
+	detail::transform(m, in, out);
+}
+#endif
+}
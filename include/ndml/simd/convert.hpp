@@ -0,0 +1,65 @@
+#ifndef NDML_SIMD_CONVERT_HPP
+#define NDML_SIMD_CONVERT_HPP
+
+#include "vec.hpp"
+
+#include "ndml/math/precision.hpp"
+
+#include <span>
+
+namespace ndml::simd
+{
+#if defined(__STDCPP_FLOAT16_T__) && (NDML_SIMD_F16C || NDML_SIMD_NEON)
+/**
+ * @brief SIMD batch kernels for half-precision elements.
+ *
+ * Elements are converted to and from single precision by the conversion instructions of F16C or NEON,
+ * eight or four at a time respectively, rounding to nearest even.
+ */
+template <>
+struct batch<std::float16_t>
+{
+	/**
+	 * @brief Conversion of every element of @p in to single precision, stored to @p out.
+	 */
+	static auto convert(std::span<std::float16_t const> in, std::span<float> out) noexcept -> void;
+
+	/**
+	 * @brief Conversion of every element of @p in to half precision, stored to @p out.
+	 */
+	static auto convert(std::span<float const> in, std::span<std::float16_t> out) noexcept -> void;
+};
+
+template <>
+inline constexpr bool batch_enabled<std::float16_t> = true;
+#endif
+
+#if defined(__STDCPP_BFLOAT16_T__) && (NDML_SIMD_SSE || NDML_SIMD_NEON)
+/**
+ * @brief SIMD batch kernels for brain floating-point elements.
+ *
+ * As these are the upper halves of single-precision elements, they are widened by shifting them into place,
+ * and narrowed by rounding to nearest even and shifting them back, preserving NaNs, eight at a time.
+ */
+template <>
+struct batch<std::bfloat16_t>
+{
+	/**
+	 * @brief Conversion of every element of @p in to single precision, stored to @p out.
+	 */
+	static auto convert(std::span<std::bfloat16_t const> in, std::span<float> out) noexcept -> void;
+
+	/**
+	 * @brief Conversion of every element of @p in to brain floating-point, stored to @p out.
+	 */
+	static auto convert(std::span<float const> in, std::span<std::bfloat16_t> out) noexcept -> void;
+};
+
+template <>
+inline constexpr bool batch_enabled<std::bfloat16_t> = true;
+#endif
+}
+
+#include "convert.inl"
+
+#endif
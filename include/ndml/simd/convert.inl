@@ -0,0 +1,150 @@
+#include <cstddef>
+#include <cstdint>
+
+namespace ndml::simd
+{
+#if defined(__STDCPP_FLOAT16_T__) && (NDML_SIMD_F16C || NDML_SIMD_NEON)
+inline auto batch<std::float16_t>::convert(std::span<std::float16_t const> in, std::span<float> out) noexcept -> void
+{
+	auto const* const bits = reinterpret_cast<std::uint16_t const*>(in.data());
+
+	std::size_t i = 0;
+#	if NDML_SIMD_F16C
+	for (; i + 8 <= in.size(); i += 8)
+	{
+		_mm256_storeu_ps(out.data() + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<__m128i const*>(bits + i))));
+	}
+#	else
+	for (; i + 4 <= in.size(); i += 4)
+	{
+		vst1q_f32(out.data() + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(bits + i))));
+	}
+#	endif
+
+	for (; i < in.size(); ++i)
+	{
+		out[i] = static_cast<float>(in[i]);
+	}
+}
+
+inline auto batch<std::float16_t>::convert(std::span<float const> in, std::span<std::float16_t> out) noexcept -> void
+{
+	auto* const bits = reinterpret_cast<std::uint16_t*>(out.data());
+
+	std::size_t i = 0;
+#	if NDML_SIMD_F16C
+	for (; i + 8 <= in.size(); i += 8)
+	{
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(bits + i), _mm256_cvtps_ph(_mm256_loadu_ps(in.data() + i), _MM_FROUND_TO_NEAREST_INT));
+	}
+#	else
+	for (; i + 4 <= in.size(); i += 4)
+	{
+		vst1_u16(bits + i, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(in.data() + i))));
+	}
+#	endif
+
+	for (; i < in.size(); ++i)
+	{
+		out[i] = static_cast<std::float16_t>(in[i]);
+	}
+}
+#endif
+
+#if defined(__STDCPP_BFLOAT16_T__) && (NDML_SIMD_SSE || NDML_SIMD_NEON)
+namespace detail
+{
+#	if NDML_SIMD_SSE
+/**
+ * @brief Rounds single-precision elements of @p f to their upper halves, sign-extended to 32 bits.
+ *
+ * Half of the least significant bit of the result, less one, is added to the bits of each element,
+ * plus that bit itself so that ties round to even. NaNs are quieted instead, as that could overflow them into infinities.
+ */
+inline auto round_to_bfloat16(__m128 f) noexcept -> __m128i
+{
+	auto const bits = _mm_castps_si128(f);
+	auto const lsb  = _mm_and_si128(_mm_srli_epi32(bits, 16), _mm_set1_epi32(1));
+	auto const nan  = _mm_castps_si128(_mm_cmpunord_ps(f, f));
+
+	auto const rounded = _mm_add_epi32(bits, _mm_add_epi32(_mm_set1_epi32(0x7FFF), lsb));
+	auto const quiet   = _mm_or_si128(bits, _mm_set1_epi32(0x00400000));
+
+	return _mm_srai_epi32(_mm_or_si128(_mm_and_si128(nan, quiet), _mm_andnot_si128(nan, rounded)), 16);
+}
+#	else
+/**
+ * @brief Rounds single-precision elements of @p f to their upper halves.
+ *
+ * Half of the least significant bit of the result, less one, is added to the bits of each element,
+ * plus that bit itself so that ties round to even. NaNs are quieted instead, as that could overflow them into infinities.
+ */
+inline auto round_to_bfloat16(float32x4_t f) noexcept -> uint16x4_t
+{
+	auto const bits = vreinterpretq_u32_f32(f);
+	auto const lsb  = vandq_u32(vshrq_n_u32(bits, 16), vdupq_n_u32(1));
+	auto const real = vceqq_f32(f, f);
+
+	auto const rounded = vaddq_u32(bits, vaddq_u32(vdupq_n_u32(0x7FFF), lsb));
+	auto const quiet   = vorrq_u32(bits, vdupq_n_u32(0x00400000));
+
+	return vshrn_n_u32(vbslq_u32(real, rounded, quiet), 16);
+}
+#	endif
+}
+
+inline auto batch<std::bfloat16_t>::convert(std::span<std::bfloat16_t const> in, std::span<float> out) noexcept -> void
+{
+	auto const* const bits = reinterpret_cast<std::uint16_t const*>(in.data());
+
+	std::size_t i = 0;
+	for (; i + 8 <= in.size(); i += 8)
+	{
+#	if NDML_SIMD_SSE
+		auto const h    = _mm_loadu_si128(reinterpret_cast<__m128i const*>(bits + i));
+		auto const zero = _mm_setzero_si128();
+
+		_mm_storeu_ps(out.data() + i, _mm_castsi128_ps(_mm_unpacklo_epi16(zero, h)));
+		_mm_storeu_ps(out.data() + i + 4, _mm_castsi128_ps(_mm_unpackhi_epi16(zero, h)));
+#	else
+		auto const h = vld1q_u16(bits + i);
+
+		vst1q_f32(out.data() + i, vreinterpretq_f32_u32(vshll_n_u16(vget_low_u16(h), 16)));
+		vst1q_f32(out.data() + i + 4, vreinterpretq_f32_u32(vshll_n_u16(vget_high_u16(h), 16)));
+#	endif
+	}
+
+	for (; i < in.size(); ++i)
+	{
+		out[i] = static_cast<float>(in[i]);
+	}
+}
+
+inline auto batch<std::bfloat16_t>::convert(std::span<float const> in, std::span<std::bfloat16_t> out) noexcept -> void
+{
+	auto* const bits = reinterpret_cast<std::uint16_t*>(out.data());
+
+	std::size_t i = 0;
+	for (; i + 8 <= in.size(); i += 8)
+	{
+#	if NDML_SIMD_SSE
+		auto const lo = detail::round_to_bfloat16(_mm_loadu_ps(in.data() + i));
+		auto const hi = detail::round_to_bfloat16(_mm_loadu_ps(in.data() + i + 4));
+
+		// the halves are sign-extended, so that signed saturation keeps them intact
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(bits + i), _mm_packs_epi32(lo, hi));
+#	else
+		auto const lo = detail::round_to_bfloat16(vld1q_f32(in.data() + i));
+		auto const hi = detail::round_to_bfloat16(vld1q_f32(in.data() + i + 4));
+
+		vst1q_u16(bits + i, vcombine_u16(lo, hi));
+#	endif
+	}
+
+	for (; i < in.size(); ++i)
+	{
+		out[i] = static_cast<std::bfloat16_t>(in[i]);
+	}
+}
+#endif
+}
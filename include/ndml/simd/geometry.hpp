@@ -0,0 +1,139 @@
+#ifndef NDML_SIMD_GEOMETRY_HPP
+#define NDML_SIMD_GEOMETRY_HPP
+
+#include "batch.hpp"
+
+#include "ndml/geometry/packet.hpp"
+#include "ndml/geometry/shape.hpp"
+
+#include <array>
+#include <cstddef>
+#include <span>
+
+namespace ndml::simd
+{
+#if NDML_SIMD_SSE || NDML_SIMD_NEON
+/**
+ * @brief SIMD batch kernels for single-precision frustums.
+ *
+ * Four bounds are classified at a time against planes broadcast into registers once per batch,
+ * and the remaining planes are skipped as soon as all four are behind one of them.
+ */
+template <>
+struct batch<frustum<float>>
+{
+	using frustum_type = frustum<float>;
+	using value_type   = frustum_type::value_type;
+
+	/**
+	 * @brief Classification of every axis-aligned bounding box of structure of arrays @p centers and @p extents, stored to @p out.
+	 */
+	static auto classify(
+		frustum_type const&                               f,
+		std::array<std::span<value_type const>, 3> const& centers,
+		std::array<std::span<value_type const>, 3> const& extents,
+		std::span<containment>                            out
+	) noexcept -> void;
+
+	/**
+	 * @brief Classification of every sphere of structure of arrays @p centers and @p radii, stored to @p out.
+	 */
+	static auto classify(
+		frustum_type const&                               f,
+		std::array<std::span<value_type const>, 3> const& centers,
+		std::span<value_type const>                       radii,
+		std::span<containment>                            out
+	) noexcept -> void;
+};
+
+template <>
+inline constexpr bool batch_enabled<frustum<float>> = true;
+
+/**
+ * @brief SIMD batch kernels for single-precision packets of four or eight rays.
+ *
+ * Each lane of a register holds a ray and primitives are broadcast, eight lanes occupying a 256-bit register with AVX and two 128-bit ones otherwise.
+ */
+template <std::size_t W>
+	requires (W == 4 || W == 8)
+struct batch<ray_packet<float, W>>
+{
+	using packet_type = ray_packet<float, W>;
+	using value_type  = packet_type::value_type;
+
+	/**
+	 * @brief Intersection of every ray of @p rays and triangle @p t, updating the lanes of @p hit it is nearer for.
+	 */
+	static auto intersect(packet_type const& rays, triangle<value_type> const& t, triangle_hit_packet<value_type, W>& hit) noexcept -> lane_mask;
+
+	/**
+	 * @brief Intersection of every ray of @p rays and box @p box, storing entry distances to @p entry.
+	 */
+	static auto intersect(
+		packet_type const&               rays,
+		aabb<value_type> const&          box,
+		std::array<value_type, W> const& max_distance,
+		std::array<value_type, W>&       entry
+	) noexcept -> lane_mask;
+};
+
+template <>
+inline constexpr bool batch_enabled<ray_packet<float, 4>> = true;
+
+template <>
+inline constexpr bool batch_enabled<ray_packet<float, 8>> = true;
+
+/**
+ * @brief SIMD batch kernels for single-precision packets of four or eight triangles.
+ *
+ * Each lane of a register holds a triangle and the ray is broadcast, as by @c batch<ray_packet<float,W>>.
+ */
+template <std::size_t W>
+	requires (W == 4 || W == 8)
+struct batch<triangle_packet<float, W>>
+{
+	using packet_type = triangle_packet<float, W>;
+	using value_type  = packet_type::value_type;
+
+	/**
+	 * @brief Intersection of ray @p r and every triangle of @p triangles, updating the lanes of @p hit they are nearer for.
+	 */
+	static auto intersect(ray<value_type> const& r, packet_type const& triangles, triangle_hit_packet<value_type, W>& hit) noexcept -> lane_mask;
+};
+
+template <>
+inline constexpr bool batch_enabled<triangle_packet<float, 4>> = true;
+
+template <>
+inline constexpr bool batch_enabled<triangle_packet<float, 8>> = true;
+
+/**
+ * @brief SIMD batch kernels for single-precision packets of four or eight axis-aligned bounding boxes.
+ *
+ * Each lane of a register holds a box and the ray is broadcast, as by @c batch<ray_packet<float,W>>.
+ */
+template <std::size_t W>
+	requires (W == 4 || W == 8)
+struct batch<aabb_packet<float, W>>
+{
+	using packet_type = aabb_packet<float, W>;
+	using value_type  = packet_type::value_type;
+
+	/**
+	 * @brief Intersection of ray @p r and every box of @p boxes, storing entry distances to @p entry.
+	 */
+	static auto intersect(ray<value_type> const& r, packet_type const& boxes, value_type max_distance, std::array<value_type, W>& entry) noexcept
+		-> lane_mask;
+};
+
+template <>
+inline constexpr bool batch_enabled<aabb_packet<float, 4>> = true;
+
+template <>
+inline constexpr bool batch_enabled<aabb_packet<float, 8>> = true;
+#endif
+}
+
+#include "geometry.inl"
+
+#endif
@@ -0,0 +1,743 @@
+#include <cmath>
+#include <limits>
+
+namespace ndml::simd
+{
+#if NDML_SIMD_SSE || NDML_SIMD_NEON
+namespace detail
+{
+/**
+ * @brief Plane broadcast into registers.
+ */
+struct plane_registers
+{
+	column_kernel::register_type normal[3];
+	column_kernel::register_type offset;
+	column_kernel::register_type absolute_normal[3];
+};
+
+/**
+ * @brief Classifies bounds given in structure of arrays form against @p f, four at a time.
+ *
+ * @p radius is called with the index of the first of four bounds and returns a function which maps the registers of a plane
+ * to the distances from their centers to their boundaries along the normal of that plane, so that their data are loaded once.
+ * @p scalar_radius is its counterpart for a single bound, mapping a plane and the index of the bound to the distance.
+ */
+template <typename Radius, typename ScalarRadius>
+inline auto classify(
+	frustum<float> const&                        f,
+	std::array<std::span<float const>, 3> const& centers,
+	std::span<containment>                       out,
+	Radius const&                                radius,
+	ScalarRadius const&                          scalar_radius
+) noexcept -> void
+{
+	plane_registers planes[6];
+	for (std::size_t p = 0; p < 6; ++p)
+	{
+		auto const& pl = f.planes[p];
+
+		for (std::size_t k = 0; k < 3; ++k)
+		{
+			planes[p].normal[k]          = broadcast(pl.normal.data()[k]);
+			planes[p].absolute_normal[k] = broadcast(std::abs(pl.normal.data()[k]));
+		}
+
+		planes[p].offset = broadcast(pl.offset);
+	}
+
+	std::size_t i = 0;
+	for (; i + 4 <= out.size(); i += 4)
+	{
+		column_kernel::register_type const c[3]{load(centers[0].data() + i), load(centers[1].data() + i), load(centers[2].data() + i)};
+
+		auto const radius_of = radius(i);
+
+#	if NDML_SIMD_SSE
+		auto outside = _mm_setzero_ps();
+		auto partial = _mm_setzero_ps();
+
+		for (auto const& pl : planes)
+		{
+			auto const d = _mm_add_ps(combine(pl.normal, c), pl.offset);
+			auto const r = radius_of(pl);
+
+			outside = _mm_or_ps(outside, _mm_cmplt_ps(d, _mm_sub_ps(_mm_setzero_ps(), r)));
+			partial = _mm_or_ps(partial, _mm_cmplt_ps(d, r));
+
+			if (_mm_movemask_ps(outside) == 0xF)
+			{
+				break;
+			}
+		}
+
+		auto const outside_mask = static_cast<unsigned>(_mm_movemask_ps(outside));
+		auto const partial_mask = static_cast<unsigned>(_mm_movemask_ps(partial));
+#	else
+		auto outside = vdupq_n_u32(0);
+		auto partial = vdupq_n_u32(0);
+
+		for (auto const& pl : planes)
+		{
+			auto const d = vaddq_f32(combine(pl.normal, c), pl.offset);
+			auto const r = radius_of(pl);
+
+			outside = vorrq_u32(outside, vcltq_f32(d, vnegq_f32(r)));
+			partial = vorrq_u32(partial, vcltq_f32(d, r));
+
+			if (vminvq_u32(outside) != 0)
+			{
+				break;
+			}
+		}
+
+		uint32x4_t const bits{1, 2, 4, 8};
+
+		auto const outside_mask = vaddvq_u32(vandq_u32(outside, bits));
+		auto const partial_mask = vaddvq_u32(vandq_u32(partial, bits));
+#	endif
+
+		// inside unless partially behind a plane, and outside if entirely behind one, without branching on random lanes
+		for (std::size_t j = 0; j < 4; ++j)
+		{
+			auto const inside = (outside_mask >> j & 1) ^ 1;
+			auto const whole  = (partial_mask >> j & 1) ^ 1;
+
+			out[i + j] = static_cast<containment>(inside * (1 + whole));
+		}
+	}
+
+	for (; i < out.size(); ++i)
+	{
+		auto result = containment::inside;
+
+		for (auto const& pl : f.planes)
+		{
+			auto const d = pl.normal.x * centers[0][i] + pl.normal.y * centers[1][i] + pl.normal.z * centers[2][i] + pl.offset;
+			auto const r = scalar_radius(pl, i);
+
+			if (d < -r)
+			{
+				result = containment::outside;
+				break;
+			}
+
+			if (d < r)
+			{
+				result = containment::intersecting;
+			}
+		}
+
+		out[i] = result;
+	}
+}
+}
+
+inline auto batch<frustum<float>>::classify(
+	frustum_type const&                               f,
+	std::array<std::span<value_type const>, 3> const& centers,
+	std::array<std::span<value_type const>, 3> const& extents,
+	std::span<containment>                            out
+) noexcept -> void
+{
+	detail::classify(
+		f,
+		centers,
+		out,
+		[&extents](std::size_t i)
+		{
+			detail::column_kernel::register_type const e[3]{
+				detail::load(extents[0].data() + i),
+				detail::load(extents[1].data() + i),
+				detail::load(extents[2].data() + i),
+			};
+
+			return [e](detail::plane_registers const& pl) { return detail::combine(pl.absolute_normal, e); };
+		},
+		[&extents](plane<float> const& pl, std::size_t i)
+		{
+			return std::abs(pl.normal.x) * extents[0][i] + std::abs(pl.normal.y) * extents[1][i] + std::abs(pl.normal.z) * extents[2][i];
+		}
+	);
+}
+
+inline auto batch<frustum<float>>::classify(
+	frustum_type const&                               f,
+	std::array<std::span<value_type const>, 3> const& centers,
+	std::span<value_type const>                       radii,
+	std::span<containment>                            out
+) noexcept -> void
+{
+	detail::classify(
+		f,
+		centers,
+		out,
+		[radii](std::size_t i) { return [r = detail::load(radii.data() + i)](detail::plane_registers const&) { return r; }; },
+		[radii](plane<float> const&, std::size_t i) { return radii[i]; }
+	);
+}
+
+namespace detail
+{
+/**
+ * @brief @p W single-precision lanes in SIMD registers.
+ */
+template <std::size_t W>
+struct float_lanes;
+
+/**
+ * @brief Results of comparisons of @p W single-precision lanes, all bits of a lane being set if it compared true.
+ */
+template <std::size_t W>
+struct mask_lanes;
+
+template <>
+struct float_lanes<4>
+{
+	column_kernel::register_type r;
+};
+
+template <>
+struct mask_lanes<4>
+{
+#	if NDML_SIMD_SSE
+	__m128 r;
+#	else
+	uint32x4_t r;
+#	endif
+};
+
+#	if NDML_SIMD_AVX
+template <>
+struct float_lanes<8>
+{
+	__m256 r;
+};
+
+template <>
+struct mask_lanes<8>
+{
+	__m256 r;
+};
+#	else
+template <>
+struct float_lanes<8>
+{
+	float_lanes<4> lo;
+	float_lanes<4> hi;
+};
+
+template <>
+struct mask_lanes<8>
+{
+	mask_lanes<4> lo;
+	mask_lanes<4> hi;
+};
+#	endif
+
+inline auto operator+(float_lanes<4> a, float_lanes<4> b) noexcept -> float_lanes<4>
+{
+#	if NDML_SIMD_SSE
+	return {_mm_add_ps(a.r, b.r)};
+#	else
+	return {vaddq_f32(a.r, b.r)};
+#	endif
+}
+
+inline auto operator-(float_lanes<4> a, float_lanes<4> b) noexcept -> float_lanes<4>
+{
+#	if NDML_SIMD_SSE
+	return {_mm_sub_ps(a.r, b.r)};
+#	else
+	return {vsubq_f32(a.r, b.r)};
+#	endif
+}
+
+inline auto operator*(float_lanes<4> a, float_lanes<4> b) noexcept -> float_lanes<4>
+{
+#	if NDML_SIMD_SSE
+	return {_mm_mul_ps(a.r, b.r)};
+#	else
+	return {vmulq_f32(a.r, b.r)};
+#	endif
+}
+
+inline auto operator/(float_lanes<4> a, float_lanes<4> b) noexcept -> float_lanes<4>
+{
+#	if NDML_SIMD_SSE
+	return {_mm_div_ps(a.r, b.r)};
+#	else
+	return {vdivq_f32(a.r, b.r)};
+#	endif
+}
+
+inline auto min(float_lanes<4> a, float_lanes<4> b) noexcept -> float_lanes<4>
+{
+#	if NDML_SIMD_SSE
+	return {_mm_min_ps(a.r, b.r)};
+#	else
+	return {vminq_f32(a.r, b.r)};
+#	endif
+}
+
+inline auto max(float_lanes<4> a, float_lanes<4> b) noexcept -> float_lanes<4>
+{
+#	if NDML_SIMD_SSE
+	return {_mm_max_ps(a.r, b.r)};
+#	else
+	return {vmaxq_f32(a.r, b.r)};
+#	endif
+}
+
+inline auto operator<(float_lanes<4> a, float_lanes<4> b) noexcept -> mask_lanes<4>
+{
+#	if NDML_SIMD_SSE
+	return {_mm_cmplt_ps(a.r, b.r)};
+#	else
+	return {vcltq_f32(a.r, b.r)};
+#	endif
+}
+
+inline auto operator<=(float_lanes<4> a, float_lanes<4> b) noexcept -> mask_lanes<4>
+{
+#	if NDML_SIMD_SSE
+	return {_mm_cmple_ps(a.r, b.r)};
+#	else
+	return {vcleq_f32(a.r, b.r)};
+#	endif
+}
+
+inline auto operator&(mask_lanes<4> a, mask_lanes<4> b) noexcept -> mask_lanes<4>
+{
+#	if NDML_SIMD_SSE
+	return {_mm_and_ps(a.r, b.r)};
+#	else
+	return {vandq_u32(a.r, b.r)};
+#	endif
+}
+
+inline auto operator|(mask_lanes<4> a, mask_lanes<4> b) noexcept -> mask_lanes<4>
+{
+#	if NDML_SIMD_SSE
+	return {_mm_or_ps(a.r, b.r)};
+#	else
+	return {vorrq_u32(a.r, b.r)};
+#	endif
+}
+
+/**
+ * @brief Lanes of @p a where @p m is set, and of @p b elsewhere.
+ */
+inline auto select(mask_lanes<4> m, float_lanes<4> a, float_lanes<4> b) noexcept -> float_lanes<4>
+{
+#	if NDML_SIMD_SSE
+	return {_mm_or_ps(_mm_and_ps(m.r, a.r), _mm_andnot_ps(m.r, b.r))};
+#	else
+	return {vbslq_f32(m.r, a.r, b.r)};
+#	endif
+}
+
+/**
+ * @brief Lane mask of the lanes set in @p m.
+ */
+inline auto bits(mask_lanes<4> m) noexcept -> lane_mask
+{
+#	if NDML_SIMD_SSE
+	return static_cast<lane_mask>(_mm_movemask_ps(m.r));
+#	else
+	uint32x4_t const weights{1, 2, 4, 8};
+	return vaddvq_u32(vandq_u32(m.r, weights));
+#	endif
+}
+
+#	if NDML_SIMD_AVX
+inline auto operator+(float_lanes<8> a, float_lanes<8> b) noexcept -> float_lanes<8>
+{
+	return {_mm256_add_ps(a.r, b.r)};
+}
+
+inline auto operator-(float_lanes<8> a, float_lanes<8> b) noexcept -> float_lanes<8>
+{
+	return {_mm256_sub_ps(a.r, b.r)};
+}
+
+inline auto operator*(float_lanes<8> a, float_lanes<8> b) noexcept -> float_lanes<8>
+{
+	return {_mm256_mul_ps(a.r, b.r)};
+}
+
+inline auto operator/(float_lanes<8> a, float_lanes<8> b) noexcept -> float_lanes<8>
+{
+	return {_mm256_div_ps(a.r, b.r)};
+}
+
+inline auto min(float_lanes<8> a, float_lanes<8> b) noexcept -> float_lanes<8>
+{
+	return {_mm256_min_ps(a.r, b.r)};
+}
+
+inline auto max(float_lanes<8> a, float_lanes<8> b) noexcept -> float_lanes<8>
+{
+	return {_mm256_max_ps(a.r, b.r)};
+}
+
+inline auto operator<(float_lanes<8> a, float_lanes<8> b) noexcept -> mask_lanes<8>
+{
+	return {_mm256_cmp_ps(a.r, b.r, _CMP_LT_OQ)};
+}
+
+inline auto operator<=(float_lanes<8> a, float_lanes<8> b) noexcept -> mask_lanes<8>
+{
+	return {_mm256_cmp_ps(a.r, b.r, _CMP_LE_OQ)};
+}
+
+inline auto operator&(mask_lanes<8> a, mask_lanes<8> b) noexcept -> mask_lanes<8>
+{
+	return {_mm256_and_ps(a.r, b.r)};
+}
+
+inline auto operator|(mask_lanes<8> a, mask_lanes<8> b) noexcept -> mask_lanes<8>
+{
+	return {_mm256_or_ps(a.r, b.r)};
+}
+
+inline auto select(mask_lanes<8> m, float_lanes<8> a, float_lanes<8> b) noexcept -> float_lanes<8>
+{
+	return {_mm256_blendv_ps(b.r, a.r, m.r)};
+}
+
+inline auto bits(mask_lanes<8> m) noexcept -> lane_mask
+{
+	return static_cast<lane_mask>(_mm256_movemask_ps(m.r));
+}
+#	else
+inline auto operator+(float_lanes<8> const& a, float_lanes<8> const& b) noexcept -> float_lanes<8>
+{
+	return {a.lo + b.lo, a.hi + b.hi};
+}
+
+inline auto operator-(float_lanes<8> const& a, float_lanes<8> const& b) noexcept -> float_lanes<8>
+{
+	return {a.lo - b.lo, a.hi - b.hi};
+}
+
+inline auto operator*(float_lanes<8> const& a, float_lanes<8> const& b) noexcept -> float_lanes<8>
+{
+	return {a.lo * b.lo, a.hi * b.hi};
+}
+
+inline auto operator/(float_lanes<8> const& a, float_lanes<8> const& b) noexcept -> float_lanes<8>
+{
+	return {a.lo / b.lo, a.hi / b.hi};
+}
+
+inline auto min(float_lanes<8> const& a, float_lanes<8> const& b) noexcept -> float_lanes<8>
+{
+	return {min(a.lo, b.lo), min(a.hi, b.hi)};
+}
+
+inline auto max(float_lanes<8> const& a, float_lanes<8> const& b) noexcept -> float_lanes<8>
+{
+	return {max(a.lo, b.lo), max(a.hi, b.hi)};
+}
+
+inline auto operator<(float_lanes<8> const& a, float_lanes<8> const& b) noexcept -> mask_lanes<8>
+{
+	return {a.lo < b.lo, a.hi < b.hi};
+}
+
+inline auto operator<=(float_lanes<8> const& a, float_lanes<8> const& b) noexcept -> mask_lanes<8>
+{
+	return {a.lo <= b.lo, a.hi <= b.hi};
+}
+
+inline auto operator&(mask_lanes<8> const& a, mask_lanes<8> const& b) noexcept -> mask_lanes<8>
+{
+	return {a.lo & b.lo, a.hi & b.hi};
+}
+
+inline auto operator|(mask_lanes<8> const& a, mask_lanes<8> const& b) noexcept -> mask_lanes<8>
+{
+	return {a.lo | b.lo, a.hi | b.hi};
+}
+
+inline auto select(mask_lanes<8> const& m, float_lanes<8> const& a, float_lanes<8> const& b) noexcept -> float_lanes<8>
+{
+	return {select(m.lo, a.lo, b.lo), select(m.hi, a.hi, b.hi)};
+}
+
+inline auto bits(mask_lanes<8> const& m) noexcept -> lane_mask
+{
+	return bits(m.lo) | bits(m.hi) << 4;
+}
+#	endif
+
+/**
+ * @brief Lanes loaded from @p W consecutive scalars starting at @p p.
+ */
+template <std::size_t W>
+inline auto load_lanes(float const* p) noexcept -> float_lanes<W>
+{
+	if constexpr (W == 4)
+	{
+		return {load(p)};
+	}
+	else
+	{
+#	if NDML_SIMD_AVX
+		return {_mm256_loadu_ps(p)};
+#	else
+		return {load_lanes<4>(p), load_lanes<4>(p + 4)};
+#	endif
+	}
+}
+
+/**
+ * @brief Lanes all set to @p s.
+ */
+template <std::size_t W>
+inline auto broadcast_lanes(float s) noexcept -> float_lanes<W>
+{
+	if constexpr (W == 4)
+	{
+		return {broadcast(s)};
+	}
+	else
+	{
+#	if NDML_SIMD_AVX
+		return {_mm256_set1_ps(s)};
+#	else
+		return {broadcast_lanes<4>(s), broadcast_lanes<4>(s)};
+#	endif
+	}
+}
+
+/**
+ * @brief Stores @p l to @p W consecutive scalars starting at @p p.
+ */
+template <std::size_t W>
+inline auto store_lanes(float* p, float_lanes<W> const& l) noexcept -> void
+{
+	if constexpr (W == 4)
+	{
+		store(p, l.r);
+	}
+	else
+	{
+#	if NDML_SIMD_AVX
+		_mm256_storeu_ps(p, l.r);
+#	else
+		store_lanes<4>(p, l.lo);
+		store_lanes<4>(p + 4, l.hi);
+#	endif
+	}
+}
+
+/**
+ * @brief Three-dimensional vectors, one per lane, in structure of arrays form.
+ */
+template <std::size_t W>
+using vec_lanes = std::array<float_lanes<W>, 3>;
+
+/**
+ * @brief Vectors of a packet, indexed by axis and then by lane.
+ */
+template <std::size_t W>
+inline auto load_lanes(std::array<std::array<float, W>, 3> const& v) noexcept -> vec_lanes<W>
+{
+	return {load_lanes<W>(v[0].data()), load_lanes<W>(v[1].data()), load_lanes<W>(v[2].data())};
+}
+
+/**
+ * @brief Vector @p v in every lane.
+ */
+template <std::size_t W>
+inline auto broadcast_lanes(vec<3, float> const& v) noexcept -> vec_lanes<W>
+{
+	return {broadcast_lanes<W>(v.x), broadcast_lanes<W>(v.y), broadcast_lanes<W>(v.z)};
+}
+
+template <std::size_t W>
+inline auto dot(vec_lanes<W> const& a, vec_lanes<W> const& b) noexcept -> float_lanes<W>
+{
+	return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+template <std::size_t W>
+inline auto cross(vec_lanes<W> const& a, vec_lanes<W> const& b) noexcept -> vec_lanes<W>
+{
+	return {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0]};
+}
+
+template <std::size_t W>
+inline auto operator-(vec_lanes<W> const& a, vec_lanes<W> const& b) noexcept -> vec_lanes<W>
+{
+	return {a[0] - b[0], a[1] - b[1], a[2] - b[2]};
+}
+
+/**
+ * @brief Intersections of rays with origins @p o and directions @p d and triangles with first vertices @p a and edges @p e1 and @p e2 from them.
+ *
+ * This follows the scalar test, and returns as soon as all lanes missed, before calculating the remaining coordinates.
+ */
+template <std::size_t W>
+inline auto moller_trumbore(
+	vec_lanes<W> const&           o,
+	vec_lanes<W> const&           d,
+	vec_lanes<W> const&           a,
+	vec_lanes<W> const&           e1,
+	vec_lanes<W> const&           e2,
+	triangle_hit_packet<float, W>& hit
+) noexcept -> lane_mask
+{
+	auto const zero = broadcast_lanes<W>(0.0f);
+	auto const one  = broadcast_lanes<W>(1.0f);
+
+	auto const p       = cross(d, e2);
+	auto const det     = dot(e1, p);
+	auto const inv_det = one / det;
+
+	auto const s = o - a;
+	auto const u = dot(s, p) * inv_det;
+
+	// lanes of zero determinants have infinite or undefined coordinates, and are masked out explicitly
+	auto valid = ((det < zero) | (zero < det)) & (zero <= u) & (u <= one);
+	if (bits(valid) == 0)
+	{
+		return 0;
+	}
+
+	auto const q = cross(s, e1);
+	auto const v = dot(d, q) * inv_det;
+
+	valid = valid & (zero <= v) & (u + v <= one);
+	if (bits(valid) == 0)
+	{
+		return 0;
+	}
+
+	auto const t        = dot(e2, q) * inv_det;
+	auto const distance = load_lanes<W>(hit.distance.data());
+
+	valid = valid & (zero <= t) & (t < distance);
+
+	auto const mask = bits(valid);
+	if (mask != 0)
+	{
+		store_lanes<W>(hit.distance.data(), select(valid, t, distance));
+		store_lanes<W>(hit.u.data(), select(valid, u, load_lanes<W>(hit.u.data())));
+		store_lanes<W>(hit.v.data(), select(valid, v, load_lanes<W>(hit.v.data())));
+	}
+
+	return mask;
+}
+
+/**
+ * @brief Intersections of rays with origins @p o and reciprocals of directions @p inv_d and boxes with corners @p lower and @p upper.
+ *
+ * Slabs parallel to rays are clipped to by infinite distances, and the far distance is kept finite, so that rays outside of them miss.
+ * Unlike the scalar test, a ray parallel to a slab whose origin lies exactly on one of its planes may miss.
+ */
+template <std::size_t W>
+inline auto slab(
+	vec_lanes<W> const&   o,
+	vec_lanes<W> const&   inv_d,
+	vec_lanes<W> const&   lower,
+	vec_lanes<W> const&   upper,
+	float_lanes<W> const& max_distance,
+	float*                entry
+) noexcept -> lane_mask
+{
+	auto near = broadcast_lanes<W>(0.0f);
+	auto far  = min(max_distance, broadcast_lanes<W>(std::numeric_limits<float>::max()));
+
+	for (std::size_t k = 0; k < 3; ++k)
+	{
+		auto const t1 = (lower[k] - o[k]) * inv_d[k];
+		auto const t2 = (upper[k] - o[k]) * inv_d[k];
+
+		near = max(near, min(t1, t2));
+		far  = min(far, max(t1, t2));
+	}
+
+	store_lanes<W>(entry, near);
+
+	return bits(near <= far);
+}
+}
+
+template <std::size_t W>
+	requires (W == 4 || W == 8)
+inline auto batch<ray_packet<float, W>>::intersect(packet_type const& rays, triangle<value_type> const& t, triangle_hit_packet<value_type, W>& hit) noexcept
+	-> lane_mask
+{
+	auto const& [a, b, c] = t.vertices;
+
+	return detail::moller_trumbore<W>(
+		detail::load_lanes(rays.origin()),
+		detail::load_lanes(rays.direction()),
+		detail::broadcast_lanes<W>(a),
+		detail::broadcast_lanes<W>(b - a),
+		detail::broadcast_lanes<W>(c - a),
+		hit
+	);
+}
+
+template <std::size_t W>
+	requires (W == 4 || W == 8)
+inline auto batch<ray_packet<float, W>>::intersect(
+	packet_type const&               rays,
+	aabb<value_type> const&          box,
+	std::array<value_type, W> const& max_distance,
+	std::array<value_type, W>&       entry
+) noexcept -> lane_mask
+{
+	return detail::slab<W>(
+		detail::load_lanes(rays.origin()),
+		detail::load_lanes(rays.inverse_direction()),
+		detail::broadcast_lanes<W>(box.lower),
+		detail::broadcast_lanes<W>(box.upper),
+		detail::load_lanes<W>(max_distance.data()),
+		entry.data()
+	);
+}
+
+template <std::size_t W>
+	requires (W == 4 || W == 8)
+inline auto batch<triangle_packet<float, W>>::intersect(ray<value_type> const& r, packet_type const& triangles, triangle_hit_packet<value_type, W>& hit) noexcept
+	-> lane_mask
+{
+	auto const& edges = triangles.edges();
+
+	return detail::moller_trumbore<W>(
+		detail::broadcast_lanes<W>(r.origin),
+		detail::broadcast_lanes<W>(r.direction),
+		detail::load_lanes(triangles.vertex()),
+		detail::load_lanes(edges[0]),
+		detail::load_lanes(edges[1]),
+		hit
+	);
+}
+
+template <std::size_t W>
+	requires (W == 4 || W == 8)
+inline auto batch<aabb_packet<float, W>>::intersect(ray<value_type> const& r, packet_type const& boxes, value_type max_distance, std::array<value_type, W>& entry) noexcept
+	-> lane_mask
+{
+	vec<3, float> const inv_d{
+		ndml::detail::reciprocal(r.direction.x),
+		ndml::detail::reciprocal(r.direction.y),
+		ndml::detail::reciprocal(r.direction.z),
+	};
+
+	return detail::slab<W>(
+		detail::broadcast_lanes<W>(r.origin),
+		detail::broadcast_lanes<W>(inv_d),
+		detail::load_lanes(boxes.lower),
+		detail::load_lanes(boxes.upper),
+		detail::broadcast_lanes<W>(max_distance),
+		entry.data()
+	);
+}
+#endif
+}
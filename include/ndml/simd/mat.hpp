@@ -0,0 +1,42 @@
+#ifndef NDML_SIMD_MAT_HPP
+#define NDML_SIMD_MAT_HPP
+
+#include "vec.hpp"
+
+#include "ndml/mat/mat.hpp"
+
+namespace ndml::simd
+{
+#if NDML_SIMD_SSE || NDML_SIMD_NEON
+/**
+ * @brief SIMD kernels for four-by-four single-precision matrices.
+ *
+ * Each column occupies a single 128-bit register.
+ */
+template <>
+struct kernel<mat<4, 4, float>>
+{
+	using mat_type    = mat<4, 4, float>;
+	using column_type = mat_type::column_type;
+
+	/**
+	 * @brief Matrix-vector multiplication.
+	 */
+	[[nodiscard]]
+	static auto multiply(mat_type const& m, column_type const& v) noexcept -> column_type;
+
+	/**
+	 * @brief Matrix multiplication.
+	 */
+	[[nodiscard]]
+	static auto multiply(mat_type const& lhs, mat_type const& rhs) noexcept -> mat_type;
+};
+
+template <>
+inline constexpr bool enabled<mat<4, 4, float>> = true;
+#endif
+}
+
+#include "mat.inl"
+
+#endif
@@ -0,0 +1,62 @@
+namespace ndml::simd
+{
+#if NDML_SIMD_SSE || NDML_SIMD_NEON
+namespace detail
+{
+using column_kernel = kernel<vec<4, float>>;
+
+/**
+ * @brief Linear combination of four columns with weights given by the lanes of @p v.
+ */
+inline auto combine(column_kernel::register_type const (&columns)[4], column_kernel::register_type v) noexcept -> column_kernel::register_type
+{
+#	if NDML_SIMD_SSE
+	auto p = _mm_mul_ps(columns[0], _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)));
+	p      = _mm_add_ps(p, _mm_mul_ps(columns[1], _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1))));
+	p      = _mm_add_ps(p, _mm_mul_ps(columns[2], _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2))));
+	p      = _mm_add_ps(p, _mm_mul_ps(columns[3], _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3))));
+#	else
+	auto p = vmulq_laneq_f32(columns[0], v, 0);
+	p      = vaddq_f32(p, vmulq_laneq_f32(columns[1], v, 1));
+	p      = vaddq_f32(p, vmulq_laneq_f32(columns[2], v, 2));
+	p      = vaddq_f32(p, vmulq_laneq_f32(columns[3], v, 3));
+#	endif
+
+	return p;
+}
+}
+
+inline auto kernel<mat<4, 4, float>>::multiply(mat_type const& m, column_type const& v) noexcept -> column_type
+{
+	using detail::column_kernel;
+
+	column_kernel::register_type const columns[4]{
+		column_kernel::load(m[0]),
+		column_kernel::load(m[1]),
+		column_kernel::load(m[2]),
+		column_kernel::load(m[3]),
+	};
+
+	return column_kernel::store(detail::combine(columns, column_kernel::load(v)));
+}
+
+inline auto kernel<mat<4, 4, float>>::multiply(mat_type const& lhs, mat_type const& rhs) noexcept -> mat_type
+{
+	using detail::column_kernel;
+
+	column_kernel::register_type const columns[4]{
+		column_kernel::load(lhs[0]),
+		column_kernel::load(lhs[1]),
+		column_kernel::load(lhs[2]),
+		column_kernel::load(lhs[3]),
+	};
+
+	return {
+		column_kernel::store(detail::combine(columns, column_kernel::load(rhs[0]))),
+		column_kernel::store(detail::combine(columns, column_kernel::load(rhs[1]))),
+		column_kernel::store(detail::combine(columns, column_kernel::load(rhs[2]))),
+		column_kernel::store(detail::combine(columns, column_kernel::load(rhs[3]))),
+	};
+}
+#endif
+}
@@ -0,0 +1,91 @@
+#ifndef NDML_SIMD_SIMD_HPP
+#define NDML_SIMD_SIMD_HPP
+
+#include "ndml/fwd.hpp"
+
+/**
+ * @def NDML_SIMD
+ *
+ * @brief Opt-in switch for SIMD kernels.
+ *
+ * When defined, operations on the hot types, i.e. @c vec<4,float>, @c vec<4,double>, and @c mat<4,4,float>,
+ * are dispatched to SIMD kernels outside of constant evaluation. The instruction set is selected from the target:
+ * SSE2 or AVX on x86 (@c NDML_SIMD_SSE, @c NDML_SIMD_AVX) and NEON on AArch64 (@c NDML_SIMD_NEON).
+ * Conversions between half and single precision additionally use F16C on x86 where available (@c NDML_SIMD_F16C),
+ * i.e. when it is enabled itself, as AVX2 does not imply it in GCC and Clang, or with AVX2 in MSVC, which has no flag for it.
+ *
+ * @note Kernels may group additions differently from their scalar counterparts,
+ *       so results of reductions such as @c dot may differ in the last bits.
+ */
+#if defined(NDML_SIMD)
+#	if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#		define NDML_SIMD_SSE 1
+#	endif
+#	if defined(__AVX__)
+#		define NDML_SIMD_AVX 1
+#	endif
+#	if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+#		define NDML_SIMD_F16C 1
+#	endif
+#	if defined(__aarch64__) || defined(_M_ARM64)
+#		define NDML_SIMD_NEON 1
+#	endif
+#endif
+
+#ifndef NDML_SIMD_SSE
+#	define NDML_SIMD_SSE 0
+#endif
+
+#ifndef NDML_SIMD_AVX
+#	define NDML_SIMD_AVX 0
+#endif
+
+#ifndef NDML_SIMD_F16C
+#	define NDML_SIMD_F16C 0
+#endif
+
+#ifndef NDML_SIMD_NEON
+#	define NDML_SIMD_NEON 0
+#endif
+
+namespace ndml::simd
+{
+/**
+ * @brief SIMD kernels for type @p V.
+ *
+ * It is only defined for types with SIMD kernels available in the current configuration.
+ *
+ * @tparam V vector or matrix type
+ */
+template <typename V>
+struct kernel;
+
+/**
+ * @brief Whether operations on type @p V are dispatched to @c kernel<V>.
+ *
+ * @tparam V vector or matrix type
+ */
+template <typename V>
+inline constexpr bool enabled = false;
+
+/**
+ * @brief SIMD batch kernels for type @p V.
+ *
+ * Batch kernels apply an operation involving type @p V to spans of values.
+ * It is only defined for types with batch kernels available in the current configuration.
+ *
+ * @tparam V vector, matrix, or quaternion type
+ */
+template <typename V>
+struct batch;
+
+/**
+ * @brief Whether batch operations involving type @p V are dispatched to @c batch<V>.
+ *
+ * @tparam V vector, matrix, or quaternion type
+ */
+template <typename V>
+inline constexpr bool batch_enabled = false;
+}
+
+#endif
@@ -0,0 +1,208 @@
+#ifndef NDML_SIMD_VEC_HPP
+#define NDML_SIMD_VEC_HPP
+
+#include "simd.hpp"
+
+#include "ndml/vec/vec.hpp"
+
+#if NDML_SIMD_SSE || NDML_SIMD_AVX
+#	include <immintrin.h>
+#endif
+
+#if NDML_SIMD_NEON
+#	include <arm_neon.h>
+#endif
+
+namespace ndml::simd
+{
+#if NDML_SIMD_SSE || NDML_SIMD_NEON
+/**
+ * @brief SIMD kernels for four-dimensional single-precision vectors.
+ *
+ * A vector occupies a single 128-bit register.
+ */
+template <>
+struct kernel<vec<4, float>>
+{
+	using vec_type   = vec<4, float>;
+	using value_type = vec_type::value_type;
+
+#	if NDML_SIMD_SSE
+	using register_type = __m128;
+#	else
+	using register_type = float32x4_t;
+#	endif
+
+	/**
+	 * @brief Loads the components of @p v into a register.
+	 */
+	[[nodiscard]]
+	static auto load(vec_type const& v) noexcept -> register_type;
+
+	/**
+	 * @brief Stores the lanes of @p r into a vector.
+	 */
+	[[nodiscard]]
+	static auto store(register_type r) noexcept -> vec_type;
+
+	/**
+	 * @brief Component-wise addition.
+	 */
+	[[nodiscard]]
+	static auto add(vec_type const& lhs, vec_type const& rhs) noexcept -> vec_type;
+
+	/**
+	 * @brief Component-wise subtraction.
+	 */
+	[[nodiscard]]
+	static auto subtract(vec_type const& lhs, vec_type const& rhs) noexcept -> vec_type;
+
+	/**
+	 * @brief Component-wise multiplication.
+	 */
+	[[nodiscard]]
+	static auto multiply(vec_type const& lhs, vec_type const& rhs) noexcept -> vec_type;
+
+	/**
+	 * @brief Vector-scalar multiplication.
+	 */
+	[[nodiscard]]
+	static auto multiply(vec_type const& v, value_type scale) noexcept -> vec_type;
+
+	/**
+	 * @brief Component-wise division.
+	 */
+	[[nodiscard]]
+	static auto divide(vec_type const& lhs, vec_type const& rhs) noexcept -> vec_type;
+
+	/**
+	 * @brief Vector-scalar division.
+	 */
+	[[nodiscard]]
+	static auto divide(vec_type const& v, value_type scale) noexcept -> vec_type;
+
+	/**
+	 * @brief Dot product.
+	 */
+	[[nodiscard]]
+	static auto dot(vec_type const& lhs, vec_type const& rhs) noexcept -> value_type;
+
+	/**
+	 * @brief Normalized vector.
+	 */
+	[[nodiscard]]
+	static auto normal(vec_type const& v) noexcept -> vec_type;
+
+	/**
+	 * @brief Vector of the components of @p v at indices @p I0, @p I1, @p I2, and @p I3.
+	 */
+	template <std::size_t I0, std::size_t I1, std::size_t I2, std::size_t I3>
+	[[nodiscard]]
+	static auto shuffle(vec_type const& v) noexcept -> vec_type;
+};
+
+template <>
+inline constexpr bool enabled<vec<4, float>> = true;
+#endif
+
+#if NDML_SIMD_SSE || NDML_SIMD_NEON
+/**
+ * @brief SIMD kernels for four-dimensional double-precision vectors.
+ *
+ * A vector occupies a single 256-bit register with AVX and a pair of 128-bit registers otherwise.
+ */
+template <>
+struct kernel<vec<4, double>>
+{
+	using vec_type   = vec<4, double>;
+	using value_type = vec_type::value_type;
+
+#	if NDML_SIMD_AVX
+	using register_type = __m256d;
+#	elif NDML_SIMD_SSE
+	/// Pair of registers holding the X and Y, and the Z and W components.
+	struct register_type
+	{
+		__m128d lo;
+		__m128d hi;
+	};
+#	else
+	using register_type = float64x2x2_t;
+#	endif
+
+	/**
+	 * @brief Loads the components of @p v into a register.
+	 */
+	[[nodiscard]]
+	static auto load(vec_type const& v) noexcept -> register_type;
+
+	/**
+	 * @brief Stores the lanes of @p r into a vector.
+	 */
+	[[nodiscard]]
+	static auto store(register_type r) noexcept -> vec_type;
+
+	/**
+	 * @brief Component-wise addition.
+	 */
+	[[nodiscard]]
+	static auto add(vec_type const& lhs, vec_type const& rhs) noexcept -> vec_type;
+
+	/**
+	 * @brief Component-wise subtraction.
+	 */
+	[[nodiscard]]
+	static auto subtract(vec_type const& lhs, vec_type const& rhs) noexcept -> vec_type;
+
+	/**
+	 * @brief Component-wise multiplication.
+	 */
+	[[nodiscard]]
+	static auto multiply(vec_type const& lhs, vec_type const& rhs) noexcept -> vec_type;
+
+	/**
+	 * @brief Vector-scalar multiplication.
+	 */
+	[[nodiscard]]
+	static auto multiply(vec_type const& v, value_type scale) noexcept -> vec_type;
+
+	/**
+	 * @brief Component-wise division.
+	 */
+	[[nodiscard]]
+	static auto divide(vec_type const& lhs, vec_type const& rhs) noexcept -> vec_type;
+
+	/**
+	 * @brief Vector-scalar division.
+	 */
+	[[nodiscard]]
+	static auto divide(vec_type const& v, value_type scale) noexcept -> vec_type;
+
+	/**
+	 * @brief Dot product.
+	 */
+	[[nodiscard]]
+	static auto dot(vec_type const& lhs, vec_type const& rhs) noexcept -> value_type;
+
+	/**
+	 * @brief Normalized vector.
+	 */
+	[[nodiscard]]
+	static auto normal(vec_type const& v) noexcept -> vec_type;
+
+	/**
+	 * @brief Vector of the components of @p v at indices @p I0, @p I1, @p I2, and @p I3.
+	 */
+	template <std::size_t I0, std::size_t I1, std::size_t I2, std::size_t I3>
+	[[nodiscard]]
+	static auto shuffle(vec_type const& v) noexcept -> vec_type;
+};
+
+template <>
+inline constexpr bool enabled<vec<4, double>> = true;
+#endif
+}
+
+#include "vec.inl"
+
+#endif
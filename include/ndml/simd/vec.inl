@@ -0,0 +1,277 @@
+#include <cmath>
+
+namespace ndml::simd
+{
+#if NDML_SIMD_SSE || NDML_SIMD_NEON
+inline auto kernel<vec<4, float>>::load(vec_type const& v) noexcept -> register_type
+{
+#	if NDML_SIMD_SSE
+	return _mm_loadu_ps(v.data());
+#	else
+	return vld1q_f32(v.data());
+#	endif
+}
+
+inline auto kernel<vec<4, float>>::store(register_type r) noexcept -> vec_type
+{
+	vec_type v;
+
+#	if NDML_SIMD_SSE
+	_mm_storeu_ps(v.data(), r);
+#	else
+	vst1q_f32(v.data(), r);
+#	endif
+
+	return v;
+}
+
+inline auto kernel<vec<4, float>>::add(vec_type const& lhs, vec_type const& rhs) noexcept -> vec_type
+{
+#	if NDML_SIMD_SSE
+	return store(_mm_add_ps(load(lhs), load(rhs)));
+#	else
+	return store(vaddq_f32(load(lhs), load(rhs)));
+#	endif
+}
+
+inline auto kernel<vec<4, float>>::subtract(vec_type const& lhs, vec_type const& rhs) noexcept -> vec_type
+{
+#	if NDML_SIMD_SSE
+	return store(_mm_sub_ps(load(lhs), load(rhs)));
+#	else
+	return store(vsubq_f32(load(lhs), load(rhs)));
+#	endif
+}
+
+inline auto kernel<vec<4, float>>::multiply(vec_type const& lhs, vec_type const& rhs) noexcept -> vec_type
+{
+#	if NDML_SIMD_SSE
+	return store(_mm_mul_ps(load(lhs), load(rhs)));
+#	else
+	return store(vmulq_f32(load(lhs), load(rhs)));
+#	endif
+}
+
+inline auto kernel<vec<4, float>>::multiply(vec_type const& v, value_type scale) noexcept -> vec_type
+{
+#	if NDML_SIMD_SSE
+	return store(_mm_mul_ps(load(v), _mm_set1_ps(scale)));
+#	else
+	return store(vmulq_n_f32(load(v), scale));
+#	endif
+}
+
+inline auto kernel<vec<4, float>>::divide(vec_type const& lhs, vec_type const& rhs) noexcept -> vec_type
+{
+#	if NDML_SIMD_SSE
+	return store(_mm_div_ps(load(lhs), load(rhs)));
+#	else
+	return store(vdivq_f32(load(lhs), load(rhs)));
+#	endif
+}
+
+inline auto kernel<vec<4, float>>::divide(vec_type const& v, value_type scale) noexcept -> vec_type
+{
+#	if NDML_SIMD_SSE
+	return store(_mm_div_ps(load(v), _mm_set1_ps(scale)));
+#	else
+	return store(vdivq_f32(load(v), vdupq_n_f32(scale)));
+#	endif
+}
+
+inline auto kernel<vec<4, float>>::dot(vec_type const& lhs, vec_type const& rhs) noexcept -> value_type
+{
+#	if NDML_SIMD_SSE
+	auto const p = _mm_mul_ps(load(lhs), load(rhs));
+	auto const s = _mm_add_ps(p, _mm_movehl_ps(p, p));
+
+	return _mm_cvtss_f32(_mm_add_ss(s, _mm_shuffle_ps(s, s, _MM_SHUFFLE(1, 1, 1, 1))));
+#	else
+	return vaddvq_f32(vmulq_f32(load(lhs), load(rhs)));
+#	endif
+}
+
+inline auto kernel<vec<4, float>>::normal(vec_type const& v) noexcept -> vec_type
+{
+	return divide(v, std::sqrt(dot(v, v)));
+}
+
+template <std::size_t I0, std::size_t I1, std::size_t I2, std::size_t I3>
+inline auto kernel<vec<4, float>>::shuffle(vec_type const& v) noexcept -> vec_type
+{
+	auto const r = load(v);
+
+#	if NDML_SIMD_SSE
+	return store(_mm_shuffle_ps(r, r, _MM_SHUFFLE(I3, I2, I1, I0)));
+#	else
+	return store(__builtin_shufflevector(r, r, I0, I1, I2, I3));
+#	endif
+}
+#endif
+
+#if NDML_SIMD_SSE || NDML_SIMD_NEON
+inline auto kernel<vec<4, double>>::load(vec_type const& v) noexcept -> register_type
+{
+#	if NDML_SIMD_AVX
+	return _mm256_loadu_pd(v.data());
+#	elif NDML_SIMD_SSE
+	return {_mm_loadu_pd(v.data()), _mm_loadu_pd(v.data() + 2)};
+#	else
+	return vld1q_f64_x2(v.data());
+#	endif
+}
+
+inline auto kernel<vec<4, double>>::store(register_type r) noexcept -> vec_type
+{
+	vec_type v;
+
+#	if NDML_SIMD_AVX
+	_mm256_storeu_pd(v.data(), r);
+#	elif NDML_SIMD_SSE
+	_mm_storeu_pd(v.data(), r.lo);
+	_mm_storeu_pd(v.data() + 2, r.hi);
+#	else
+	vst1q_f64_x2(v.data(), r);
+#	endif
+
+	return v;
+}
+
+inline auto kernel<vec<4, double>>::add(vec_type const& lhs, vec_type const& rhs) noexcept -> vec_type
+{
+	auto const l = load(lhs);
+	auto const r = load(rhs);
+
+#	if NDML_SIMD_AVX
+	return store(_mm256_add_pd(l, r));
+#	elif NDML_SIMD_SSE
+	return store({_mm_add_pd(l.lo, r.lo), _mm_add_pd(l.hi, r.hi)});
+#	else
+	return store({{vaddq_f64(l.val[0], r.val[0]), vaddq_f64(l.val[1], r.val[1])}});
+#	endif
+}
+
+inline auto kernel<vec<4, double>>::subtract(vec_type const& lhs, vec_type const& rhs) noexcept -> vec_type
+{
+	auto const l = load(lhs);
+	auto const r = load(rhs);
+
+#	if NDML_SIMD_AVX
+	return store(_mm256_sub_pd(l, r));
+#	elif NDML_SIMD_SSE
+	return store({_mm_sub_pd(l.lo, r.lo), _mm_sub_pd(l.hi, r.hi)});
+#	else
+	return store({{vsubq_f64(l.val[0], r.val[0]), vsubq_f64(l.val[1], r.val[1])}});
+#	endif
+}
+
+inline auto kernel<vec<4, double>>::multiply(vec_type const& lhs, vec_type const& rhs) noexcept -> vec_type
+{
+	auto const l = load(lhs);
+	auto const r = load(rhs);
+
+#	if NDML_SIMD_AVX
+	return store(_mm256_mul_pd(l, r));
+#	elif NDML_SIMD_SSE
+	return store({_mm_mul_pd(l.lo, r.lo), _mm_mul_pd(l.hi, r.hi)});
+#	else
+	return store({{vmulq_f64(l.val[0], r.val[0]), vmulq_f64(l.val[1], r.val[1])}});
+#	endif
+}
+
+inline auto kernel<vec<4, double>>::multiply(vec_type const& v, value_type scale) noexcept -> vec_type
+{
+	auto const l = load(v);
+
+#	if NDML_SIMD_AVX
+	return store(_mm256_mul_pd(l, _mm256_set1_pd(scale)));
+#	elif NDML_SIMD_SSE
+	auto const s = _mm_set1_pd(scale);
+	return store({_mm_mul_pd(l.lo, s), _mm_mul_pd(l.hi, s)});
+#	else
+	return store({{vmulq_n_f64(l.val[0], scale), vmulq_n_f64(l.val[1], scale)}});
+#	endif
+}
+
+inline auto kernel<vec<4, double>>::divide(vec_type const& lhs, vec_type const& rhs) noexcept -> vec_type
+{
+	auto const l = load(lhs);
+	auto const r = load(rhs);
+
+#	if NDML_SIMD_AVX
+	return store(_mm256_div_pd(l, r));
+#	elif NDML_SIMD_SSE
+	return store({_mm_div_pd(l.lo, r.lo), _mm_div_pd(l.hi, r.hi)});
+#	else
+	return store({{vdivq_f64(l.val[0], r.val[0]), vdivq_f64(l.val[1], r.val[1])}});
+#	endif
+}
+
+inline auto kernel<vec<4, double>>::divide(vec_type const& v, value_type scale) noexcept -> vec_type
+{
+	auto const l = load(v);
+
+#	if NDML_SIMD_AVX
+	return store(_mm256_div_pd(l, _mm256_set1_pd(scale)));
+#	elif NDML_SIMD_SSE
+	auto const s = _mm_set1_pd(scale);
+	return store({_mm_div_pd(l.lo, s), _mm_div_pd(l.hi, s)});
+#	else
+	auto const s = vdupq_n_f64(scale);
+	return store({{vdivq_f64(l.val[0], s), vdivq_f64(l.val[1], s)}});
+#	endif
+}
+
+inline auto kernel<vec<4, double>>::dot(vec_type const& lhs, vec_type const& rhs) noexcept -> value_type
+{
+	auto const l = load(lhs);
+	auto const r = load(rhs);
+
+#	if NDML_SIMD_AVX
+	auto const p = _mm256_mul_pd(l, r);
+	auto const s = _mm_add_pd(_mm256_castpd256_pd128(p), _mm256_extractf128_pd(p, 1));
+
+	return _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+#	elif NDML_SIMD_SSE
+	auto const s = _mm_add_pd(_mm_mul_pd(l.lo, r.lo), _mm_mul_pd(l.hi, r.hi));
+
+	return _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+#	else
+	return vaddvq_f64(vaddq_f64(vmulq_f64(l.val[0], r.val[0]), vmulq_f64(l.val[1], r.val[1])));
+#	endif
+}
+
+inline auto kernel<vec<4, double>>::normal(vec_type const& v) noexcept -> vec_type
+{
+	return divide(v, std::sqrt(dot(v, v)));
+}
+
+template <std::size_t I0, std::size_t I1, std::size_t I2, std::size_t I3>
+inline auto kernel<vec<4, double>>::shuffle(vec_type const& v) noexcept -> vec_type
+{
+	auto const r = load(v);
+
+#	if NDML_SIMD_AVX || NDML_SIMD_SSE
+#		if NDML_SIMD_AVX
+	auto const lo = _mm256_castpd256_pd128(r);
+	auto const hi = _mm256_extractf128_pd(r, 1);
+#		else
+	auto const lo = r.lo;
+	auto const hi = r.hi;
+#		endif
+
+	// each half of the result takes its first component from the half of its first index, and its second one from that of its second index
+	auto const xy = _mm_shuffle_pd(I0 < 2 ? lo : hi, I1 < 2 ? lo : hi, _MM_SHUFFLE2(I1 % 2, I0 % 2));
+	auto const zw = _mm_shuffle_pd(I2 < 2 ? lo : hi, I3 < 2 ? lo : hi, _MM_SHUFFLE2(I3 % 2, I2 % 2));
+
+#		if NDML_SIMD_AVX
+	return store(_mm256_insertf128_pd(_mm256_castpd128_pd256(xy), zw, 1));
+#		else
+	return store({xy, zw});
+#		endif
+#	else
+	return store({{__builtin_shufflevector(r.val[0], r.val[1], I0, I1), __builtin_shufflevector(r.val[0], r.val[1], I2, I3)}});
+#	endif
+}
+#endif
+}
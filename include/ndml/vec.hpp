@@ -3,5 +3,8 @@
 
 #include "vec/vec.hpp"
 #include "vec/operation.hpp"
+#include "vec/view.hpp"
+#include "vec/convert.hpp"
+#include "vec/swizzle.hpp"
 
 #endif
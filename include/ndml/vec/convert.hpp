@@ -0,0 +1,55 @@
+#ifndef NDML_VEC_CONVERT_HPP
+#define NDML_VEC_CONVERT_HPP
+
+#include "vec.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+namespace ndml
+{
+/**
+ * @brief Batch conversion of elements.
+ *
+ * Converts each element of @p in to @p To and stores the results to the respective elements of @p out.
+ * Conversions between @c float and half-precision types, i.e. @c std::float16_t and @c std::bfloat16_t where supported,
+ * are dispatched to SIMD kernels outside of constant evaluation, which round to nearest even as does @c static_cast.
+ *
+ * @tparam From element type of @p in
+ * @tparam To   element type of @p out
+ *
+ * @warning Behavior is undefined if @p out is shorter than @p in, or if they overlap.
+ *
+ * @return the first @c in.size() elements of @p out
+ */
+template <typename From, typename To>
+constexpr auto convert(std::type_identity_t<std::span<From const>> in, std::type_identity_t<std::span<To>> out) noexcept -> std::span<To>
+	requires std::constructible_from<To, From const&>;
+
+/**
+ * @brief Batch conversion of vectors.
+ *
+ * Converts each vector of @p in to element type @p To and stores the results to the respective vectors of @p out.
+ * As vectors are laid out as arrays, their components are converted as contiguous elements, e.g. by SIMD kernels.
+ *
+ * @tparam N    size of vectors
+ * @tparam From element type of @p in
+ * @tparam To   element type of @p out
+ *
+ * @warning Behavior is undefined if @p out is shorter than @p in, or if they overlap.
+ *
+ * @return the first @c in.size() vectors of @p out
+ *
+ * @sa ndml::convert(std::span<From const>, std::span<To>)
+ */
+template <std::size_t N, typename From, typename To>
+constexpr auto convert(std::type_identity_t<std::span<vec<N, From> const>> in, std::type_identity_t<std::span<vec<N, To>>> out) noexcept
+	-> std::span<vec<N, To>>
+	requires std::constructible_from<To, From const&>;
+}
+
+#include "convert.inl"
+
+#endif
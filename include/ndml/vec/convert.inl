@@ -0,0 +1,73 @@
+#include "ndml/simd/convert.hpp"
+
+namespace ndml
+{
+namespace detail
+{
+/**
+ * @brief Whether conversions from @p From to @p To are dispatched to a SIMD batch kernel of either type.
+ */
+template <typename From, typename To>
+concept batch_convertible = requires(std::span<From const> in, std::span<To> out) { simd::batch<From>::convert(in, out); }
+                         || requires(std::span<From const> in, std::span<To> out) { simd::batch<To>::convert(in, out); };
+}
+
+template <typename From, typename To>
+constexpr auto convert(std::type_identity_t<std::span<From const>> in, std::type_identity_t<std::span<To>> out) noexcept -> std::span<To>
+	requires std::constructible_from<To, From const&>
+{
+	out = out.first(in.size());
+
+	if constexpr (detail::batch_convertible<From, To>)
+	{
+		if !consteval
+		{
+			if constexpr (requires { simd::batch<From>::convert(in, out); })
+			{
+				simd::batch<From>::convert(in, out);
+			}
+			else
+			{
+				simd::batch<To>::convert(in, out);
+			}
+
+			return out;
+		}
+	}
+
+	for (std::size_t i = 0; i < in.size(); ++i)
+	{
+		out[i] = static_cast<To>(in[i]);
+	}
+
+	return out;
+}
+
+template <std::size_t N, typename From, typename To>
+constexpr auto convert(std::type_identity_t<std::span<vec<N, From> const>> in, std::type_identity_t<std::span<vec<N, To>>> out) noexcept
+	-> std::span<vec<N, To>>
+	requires std::constructible_from<To, From const&>
+{
+	out = out.first(in.size());
+
+	if constexpr (detail::batch_convertible<From, To>)
+	{
+		if !consteval
+		{
+			if (!in.empty())
+			{
+				convert<From, To>(std::span{in.front().data(), in.size() * N}, std::span{out.front().data(), out.size() * N});
+			}
+
+			return out;
+		}
+	}
+
+	for (std::size_t i = 0; i < in.size(); ++i)
+	{
+		out[i] = vec<N, To>{in[i]};
+	}
+
+	return out;
+}
+}
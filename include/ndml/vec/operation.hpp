@@ -2,6 +2,12 @@
 #define NDML_VEC_OPERATION_HPP
 
 #include "vec.hpp"
+#include "view.hpp"
+
+#include "ndml/math/function.hpp"
+
+#include <concepts>
+#include <type_traits>
 
 namespace ndml
 {
@@ -20,7 +26,7 @@ namespace ndml
  * @return reference to @p v
  */
 template <std::size_t N, typename T, typename UnaryFn>
-constexpr auto transform(vec<N, T>& v, UnaryFn const& f) noexcept(noexcept(std::ranges::for_each(v, f))) -> vec<N, T>&;
+constexpr auto transform(vec<N, T>& v, UnaryFn const& f) noexcept(noexcept(f(get<0>(v)))) -> vec<N, T>&;
 
 /**
  * @brief Zip-transforms the components of a vector with the components of another vector.
@@ -38,12 +44,13 @@ constexpr auto transform(vec<N, T>& v, UnaryFn const& f) noexcept(noexcept(std::
  * @return reference to @p v
  */
 template <std::size_t N, typename T, typename BinaryFn>
-constexpr auto zip_transform(vec<N, T>& lhs, vec<N, T> const& rhs, BinaryFn const& f) noexcept(noexcept(f(lhs[0], rhs[0]))) -> vec<N, T>&;
+constexpr auto zip_transform(vec<N, T>& lhs, vec<N, T> const& rhs, BinaryFn const& f) noexcept(noexcept(f(get<0>(lhs), get<0>(rhs)))) -> vec<N, T>&;
 
 /**
  * @brief Dot product of two vectors.
  *
- * This calculates the dot product of two vectors.
+ * This calculates the dot product of two vectors. Products are summed in @c math::accumulator_t<T>,
+ * e.g. in @c float for half-precision elements, and only the result is rounded to @p T.
  *
  * @tparam N dimension
  * @tparam T element type
@@ -90,22 +97,25 @@ constexpr auto norm_squared(vec<N, T> const& v) noexcept -> vec<N, T>::value_typ
  * @brief Norm of vector.
  *
  * This calculates the norm of @p v, which is equal to the square root of the dot product of @p v with itself.
+ * For elements accumulated in another type, the square root is taken of the accumulated dot product.
+ * For custom numeric types, it is calculated in @p T, e.g. by integer arithmetic for fixed-point types.
  *
  * @tparam N dimension
  * @tparam T element type
  *
  * @param v vector
  *
- * @return the square root of the dot product of @p v with itself.
+ * @return the square root of the dot product of @p v with itself, of type @c math::real_t<T>
  */
 template <std::size_t N, typename T>
 [[nodiscard]]
-constexpr auto norm(vec<N, T> const& v) noexcept -> double;
+constexpr auto norm(vec<N, T> const& v) noexcept -> math::real_t<T>;
 
 /**
  * @brief Normalized vector.
  *
- * This calculates the unit vector facing in the same direction as @p v by dividing @v by its norm.
+ * This calculates the unit vector facing in the same direction as @p v by dividing @v by its norm,
+ * under @c math::default_policy.
  *
  * @tparam N dimension
  * @tparam T element type
@@ -118,6 +128,44 @@ template <std::size_t N, typename T>
 [[nodiscard]]
 constexpr auto normal(vec<N, T> const& v) noexcept -> vec<N, T>;
 
+/**
+ * @brief Norm of vector under a math policy.
+ *
+ * Unlike @c norm(v), this calculates the norm of @p v in its element type, without conversions to and from @c double.
+ *
+ * @tparam N dimension
+ * @tparam T element type
+ * @tparam P math policy
+ *
+ * @param v      vector
+ * @param policy math policy
+ *
+ * @return the square root of the dot product of @p v with itself.
+ */
+template <std::size_t N, typename T, math::policy P>
+[[nodiscard]]
+constexpr auto norm(vec<N, T> const& v, P policy) noexcept -> vec<N, T>::value_type;
+
+/**
+ * @brief Normalized vector under a math policy.
+ *
+ * Given @c math::fast and a floating-point @p T, this multiplies @p v by the approximate reciprocal of its norm
+ * instead of dividing it by the norm, so that there is neither a square root nor a division.
+ * For elements accumulated in another type, @p v is normalized in that type and rounded back to @p T.
+ *
+ * @tparam N dimension
+ * @tparam T element type
+ * @tparam P math policy
+ *
+ * @param v      vector
+ * @param policy math policy
+ *
+ * @return @p v divided by its norm
+ */
+template <std::size_t N, typename T, math::policy P>
+[[nodiscard]]
+constexpr auto normal(vec<N, T> const& v, P policy) noexcept -> vec<N, T>;
+
 /**
  * @brief Projection of a vector onto given axis.
  *
@@ -304,6 +352,230 @@ constexpr auto operator*(typename vec<N, T>::value_type const& scale, vec<N, T>
 template <std::size_t N, typename T>
 [[nodiscard]]
 constexpr auto operator/(vec<N, T> const& v, typename vec<N, T>::value_type const& scale) noexcept -> vec<N, T>;
+
+/**
+ * @brief Dot product of vectors at least one of which is a view.
+ *
+ * This loads viewed components and calculates the dot product of the resulting vectors.
+ */
+template <typename L, typename R>
+[[nodiscard]]
+constexpr auto dot(L const& lhs, R const& rhs) noexcept -> detail::loaded_t<L>::value_type
+	requires viewed_vectors<L, R>;
+
+/**
+ * @brief Cross product of vectors at least one of which is a view.
+ *
+ * This loads viewed components and calculates the cross product of the resulting vectors.
+ */
+template <typename L, typename R>
+[[nodiscard]]
+constexpr auto cross(L const& lhs, R const& rhs) noexcept -> detail::loaded_t<L>
+	requires (viewed_vectors<L, R> && detail::loaded_t<L>::dimension == 3);
+
+/**
+ * @brief Squared norm of a vector view.
+ */
+template <std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto norm_squared(vec_view<N, T> const& v) noexcept -> vec_view<N, T>::value_type;
+
+/**
+ * @brief Norm of a vector view.
+ */
+template <std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto norm(vec_view<N, T> const& v) noexcept -> math::real_t<T>;
+
+/**
+ * @brief Normalized vector view.
+ *
+ * @return the viewed vector divided by its norm
+ */
+template <std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto normal(vec_view<N, T> const& v) noexcept -> vec_view<N, T>::vec_type;
+
+/**
+ * @brief Projection of vectors at least one of which is a view.
+ *
+ * @return @p v projected onto @p axis
+ */
+template <typename L, typename R>
+[[nodiscard]]
+constexpr auto projection(L const& v, R const& axis) noexcept -> detail::loaded_t<L>
+	requires viewed_vectors<L, R>;
+
+/**
+ * @brief Reciprocal of a vector view.
+ *
+ * @warning Behavior is undefined if any of the viewed components are zero.
+ */
+template <std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto reciprocal(vec_view<N, T> const& v) noexcept -> vec_view<N, T>::vec_type;
+
+/**
+ * @brief Vector addition assignment operator for a viewed right side.
+ */
+template <std::size_t N, typename T, typename R>
+constexpr auto operator+=(vec<N, T>& lhs, R const& rhs) noexcept -> vec<N, T>&
+	requires viewed_vectors<vec<N, T>, R>;
+
+/**
+ * @brief Vector subtraction assignment operator for a viewed right side.
+ */
+template <std::size_t N, typename T, typename R>
+constexpr auto operator-=(vec<N, T>& lhs, R const& rhs) noexcept -> vec<N, T>&
+	requires viewed_vectors<vec<N, T>, R>;
+
+/**
+ * @brief Vector multiplication assignment operator for a viewed right side.
+ */
+template <std::size_t N, typename T, typename R>
+constexpr auto operator*=(vec<N, T>& lhs, R const& rhs) noexcept -> vec<N, T>&
+	requires viewed_vectors<vec<N, T>, R>;
+
+/**
+ * @brief Vector division assignment operator for a viewed right side.
+ */
+template <std::size_t N, typename T, typename R>
+constexpr auto operator/=(vec<N, T>& lhs, R const& rhs) noexcept -> vec<N, T>&
+	requires viewed_vectors<vec<N, T>, R>;
+
+/**
+ * @brief Vector view addition assignment operator.
+ *
+ * Adds components of @p rhs to respective viewed components.
+ *
+ * @return @p lhs
+ */
+template <std::size_t N, typename T, typename R>
+constexpr auto operator+=(vec_view<N, T> const& lhs, R const& rhs) noexcept -> vec_view<N, T>
+	requires (!std::is_const_v<T> && std::same_as<detail::loaded_t<R>, typename vec_view<N, T>::vec_type>);
+
+/**
+ * @brief Vector view subtraction assignment operator.
+ *
+ * Subtracts components of @p rhs from respective viewed components.
+ *
+ * @return @p lhs
+ */
+template <std::size_t N, typename T, typename R>
+constexpr auto operator-=(vec_view<N, T> const& lhs, R const& rhs) noexcept -> vec_view<N, T>
+	requires (!std::is_const_v<T> && std::same_as<detail::loaded_t<R>, typename vec_view<N, T>::vec_type>);
+
+/**
+ * @brief Vector view multiplication assignment operator.
+ *
+ * Multiplies viewed components by respective components of @p rhs.
+ *
+ * @return @p lhs
+ */
+template <std::size_t N, typename T, typename R>
+constexpr auto operator*=(vec_view<N, T> const& lhs, R const& rhs) noexcept -> vec_view<N, T>
+	requires (!std::is_const_v<T> && std::same_as<detail::loaded_t<R>, typename vec_view<N, T>::vec_type>);
+
+/**
+ * @brief Vector view division assignment operator.
+ *
+ * Divides viewed components by respective components of @p rhs.
+ *
+ * @return @p lhs
+ */
+template <std::size_t N, typename T, typename R>
+constexpr auto operator/=(vec_view<N, T> const& lhs, R const& rhs) noexcept -> vec_view<N, T>
+	requires (!std::is_const_v<T> && std::same_as<detail::loaded_t<R>, typename vec_view<N, T>::vec_type>);
+
+/**
+ * @brief Vector view-scalar multiplication assignment operator.
+ *
+ * Multiplies viewed components by @p scale.
+ *
+ * @return @p v
+ */
+template <std::size_t N, typename T>
+constexpr auto operator*=(vec_view<N, T> const& v, typename vec_view<N, T>::value_type const& scale) noexcept -> vec_view<N, T>
+	requires (!std::is_const_v<T>);
+
+/**
+ * @brief Vector view-scalar division assignment operator.
+ *
+ * Divides viewed components by @p scale.
+ *
+ * @return @p v
+ */
+template <std::size_t N, typename T>
+constexpr auto operator/=(vec_view<N, T> const& v, typename vec_view<N, T>::value_type const& scale) noexcept -> vec_view<N, T>
+	requires (!std::is_const_v<T>);
+
+/**
+ * @brief Equality comparison operator for vectors at least one of which is a view.
+ */
+template <typename L, typename R>
+[[nodiscard]]
+constexpr auto operator==(L const& lhs, R const& rhs) noexcept -> bool
+	requires viewed_vectors<L, R>;
+
+/**
+ * @brief Vector view negation operator.
+ */
+template <std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto operator-(vec_view<N, T> const& v) noexcept -> vec_view<N, T>::vec_type;
+
+/**
+ * @brief Addition operator for vectors at least one of which is a view.
+ */
+template <typename L, typename R>
+[[nodiscard]]
+constexpr auto operator+(L const& lhs, R const& rhs) noexcept -> detail::loaded_t<L>
+	requires viewed_vectors<L, R>;
+
+/**
+ * @brief Subtraction operator for vectors at least one of which is a view.
+ */
+template <typename L, typename R>
+[[nodiscard]]
+constexpr auto operator-(L const& lhs, R const& rhs) noexcept -> detail::loaded_t<L>
+	requires viewed_vectors<L, R>;
+
+/**
+ * @brief Multiplication operator for vectors at least one of which is a view.
+ */
+template <typename L, typename R>
+[[nodiscard]]
+constexpr auto operator*(L const& lhs, R const& rhs) noexcept -> detail::loaded_t<L>
+	requires viewed_vectors<L, R>;
+
+/**
+ * @brief Division operator for vectors at least one of which is a view.
+ */
+template <typename L, typename R>
+[[nodiscard]]
+constexpr auto operator/(L const& lhs, R const& rhs) noexcept -> detail::loaded_t<L>
+	requires viewed_vectors<L, R>;
+
+/**
+ * @brief Vector view-scalar multiplication operator.
+ */
+template <std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto operator*(vec_view<N, T> const& v, typename vec_view<N, T>::value_type const& scale) noexcept -> vec_view<N, T>::vec_type;
+
+/**
+ * @brief Scalar-vector view multiplication operator.
+ */
+template <std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto operator*(typename vec_view<N, T>::value_type const& scale, vec_view<N, T> const& v) noexcept -> vec_view<N, T>::vec_type;
+
+/**
+ * @brief Vector view-scalar division operator.
+ */
+template <std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto operator/(vec_view<N, T> const& v, typename vec_view<N, T>::value_type const& scale) noexcept -> vec_view<N, T>::vec_type;
 }
 
 #include "operation.inl"
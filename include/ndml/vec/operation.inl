@@ -1,39 +1,55 @@
+#include "ndml/math/precision.hpp"
 #include "ndml/meta/functional.hpp"
+#include "ndml/meta/unroll.hpp"
+#include "ndml/simd/vec.hpp"
 
-#include <algorithm>
-#include <cmath>
+#include <type_traits>
 
 namespace ndml
 {
+namespace detail
+{
+/**
+ * @brief Dot product of two vectors accumulated in @c math::accumulator_t<T>.
+ */
+template <std::size_t N, typename T>
+constexpr auto accumulated_dot(vec<N, T> const& lhs, vec<N, T> const& rhs) noexcept -> math::accumulator_t<T>
+{
+	using accumulator_type = math::accumulator_t<T>;
+
+	accumulator_type s{};
+	meta::unroll<N>([&s, &lhs, &rhs](auto... i) { ((s += static_cast<accumulator_type>(get<i>(lhs)) * static_cast<accumulator_type>(get<i>(rhs))), ...); });
+
+	return s;
+}
+}
+
 template <std::size_t N, typename T, typename UnaryFn>
-constexpr auto transform(vec<N, T>& v, UnaryFn const& f) noexcept(noexcept(std::ranges::for_each(v, f))) -> vec<N, T>&
+constexpr auto transform(vec<N, T>& v, UnaryFn const& f) noexcept(noexcept(f(get<0>(v)))) -> vec<N, T>&
 {
-	std::ranges::for_each(v, f);
+	meta::unroll<N>([&v, &f](auto... i) { (static_cast<void>(f(get<i>(v))), ...); });
 	return v;
 }
 
 template <std::size_t N, typename T, typename BinaryFn>
-constexpr auto zip_transform(vec<N, T>& lhs, vec<N, T> const& rhs, BinaryFn const& f) noexcept(noexcept(f(lhs[0], rhs[0]))) -> vec<N, T>&
+constexpr auto zip_transform(vec<N, T>& lhs, vec<N, T> const& rhs, BinaryFn const& f) noexcept(noexcept(f(get<0>(lhs), get<0>(rhs)))) -> vec<N, T>&
 {
-	for (std::size_t i = 0; i < N; ++i)
-	{
-		f(lhs[i], rhs[i]);
-	}
-
+	meta::unroll<N>([&lhs, &rhs, &f](auto... i) { (static_cast<void>(f(get<i>(lhs), get<i>(rhs))), ...); });
 	return lhs;
 }
 
 template <std::size_t N, typename T>
 constexpr auto dot(vec<N, T> const& lhs, vec<N, T> const& rhs) noexcept -> vec<N, T>::value_type
 {
-	typename vec<N, T>::value_type s{};
-
-	for (std::size_t i = 0; i < N; ++i)
+	if constexpr (simd::enabled<vec<N, T>>)
 	{
-		s += lhs[i] * rhs[i];
+		if !consteval
+		{
+			return simd::kernel<vec<N, T>>::dot(lhs, rhs);
+		}
 	}
 
-	return s;
+	return static_cast<T>(detail::accumulated_dot(lhs, rhs));
 }
 
 template <typename T>
@@ -53,15 +69,67 @@ constexpr auto norm_squared(vec<N, T> const& v) noexcept -> vec<N, T>::value_typ
 }
 
 template <std::size_t N, typename T>
-constexpr auto norm(vec<N, T> const& v) noexcept -> double
+constexpr auto norm(vec<N, T> const& v) noexcept -> math::real_t<T>
 {
-	return std::sqrt(norm_squared(v));
+	using accumulator_type = math::accumulator_t<T>;
+	using sqrt_type        = std::conditional_t<std::floating_point<accumulator_type>, accumulator_type, double>;
+
+	if constexpr (math::custom_numeric<T>)
+	{
+		return math::sqrt(norm_squared(v), math::precise);
+	}
+	else if constexpr (math::widened<T>)
+	{
+		return math::sqrt(static_cast<sqrt_type>(detail::accumulated_dot(v, v)), math::precise);
+	}
+	else
+	{
+		return math::sqrt(static_cast<sqrt_type>(norm_squared(v)), math::precise);
+	}
 }
 
 template <std::size_t N, typename T>
 constexpr auto normal(vec<N, T> const& v) noexcept -> vec<N, T>
 {
-	return v / norm(v);
+	return normal(v, math::default_policy{});
+}
+
+template <std::size_t N, typename T, math::policy P>
+constexpr auto norm(vec<N, T> const& v, P policy) noexcept -> vec<N, T>::value_type
+{
+	if constexpr (math::widened<T>)
+	{
+		return static_cast<T>(math::sqrt(detail::accumulated_dot(v, v), policy));
+	}
+	else
+	{
+		return math::sqrt(norm_squared(v), policy);
+	}
+}
+
+template <std::size_t N, typename T, math::policy P>
+constexpr auto normal(vec<N, T> const& v, P policy) noexcept -> vec<N, T>
+{
+	if constexpr (math::widened<T>)
+	{
+		return vec<N, T>{normal(vec<N, math::accumulator_t<T>>{v}, policy)};
+	}
+	else if constexpr (std::same_as<P, math::fast_t> && std::floating_point<T>)
+	{
+		return v * math::rsqrt(norm_squared(v), policy);
+	}
+	else
+	{
+		if constexpr (simd::enabled<vec<N, T>>)
+		{
+			if !consteval
+			{
+				return simd::kernel<vec<N, T>>::normal(v);
+			}
+		}
+
+		return v / norm(v);
+	}
 }
 
 template <std::size_t N, typename T>
@@ -82,43 +150,91 @@ constexpr auto reciprocal(vec<N, T> const& v) noexcept -> vec<N, T>
 template <std::size_t N, typename T>
 constexpr auto operator+=(vec<N, T>& lhs, vec<N, T> const& rhs) noexcept -> vec<N, T>&
 {
+	if constexpr (simd::enabled<vec<N, T>>)
+	{
+		if !consteval
+		{
+			return lhs = simd::kernel<vec<N, T>>::add(lhs, rhs);
+		}
+	}
+
 	return zip_transform(lhs, rhs, meta::addition_assignment<T>{});
 }
 
 template <std::size_t N, typename T>
 constexpr auto operator-=(vec<N, T>& lhs, vec<N, T> const& rhs) noexcept -> vec<N, T>&
 {
+	if constexpr (simd::enabled<vec<N, T>>)
+	{
+		if !consteval
+		{
+			return lhs = simd::kernel<vec<N, T>>::subtract(lhs, rhs);
+		}
+	}
+
 	return zip_transform(lhs, rhs, meta::subtraction_assignment<T>{});
 }
 
 template <std::size_t N, typename T>
 constexpr auto operator*=(vec<N, T>& lhs, vec<N, T> const& rhs) noexcept -> vec<N, T>&
 {
+	if constexpr (simd::enabled<vec<N, T>>)
+	{
+		if !consteval
+		{
+			return lhs = simd::kernel<vec<N, T>>::multiply(lhs, rhs);
+		}
+	}
+
 	return zip_transform(lhs, rhs, meta::multiplication_assignment<T>{});
 }
 
 template <std::size_t N, typename T>
 constexpr auto operator/=(vec<N, T>& lhs, vec<N, T> const& rhs) noexcept -> vec<N, T>&
 {
+	if constexpr (simd::enabled<vec<N, T>>)
+	{
+		if !consteval
+		{
+			return lhs = simd::kernel<vec<N, T>>::divide(lhs, rhs);
+		}
+	}
+
 	return zip_transform(lhs, rhs, meta::division_assignment<T>{});
 }
 
 template <std::size_t N, typename T>
 constexpr auto operator*=(vec<N, T>& v, typename vec<N, T>::value_type const& scale) noexcept -> vec<N, T>&
 {
+	if constexpr (simd::enabled<vec<N, T>>)
+	{
+		if !consteval
+		{
+			return v = simd::kernel<vec<N, T>>::multiply(v, scale);
+		}
+	}
+
 	return transform(v, [&scale](auto& component) { return component *= scale; });
 }
 
 template <std::size_t N, typename T>
 constexpr auto operator/=(vec<N, T>& v, typename vec<N, T>::value_type const& scale) noexcept -> vec<N, T>&
 {
+	if constexpr (simd::enabled<vec<N, T>>)
+	{
+		if !consteval
+		{
+			return v = simd::kernel<vec<N, T>>::divide(v, scale);
+		}
+	}
+
 	return transform(v, [&scale](auto& component) { return component /= scale; });
 }
 
 template <std::size_t N, typename T>
 constexpr auto operator==(vec<N, T> const& lhs, vec<N, T> const& rhs) noexcept -> bool
 {
-	return std::ranges::equal(lhs, rhs);
+	return meta::unroll<N>([&lhs, &rhs](auto... i) { return ((get<i>(lhs) == get<i>(rhs)) && ...); });
 }
 
 template <std::size_t N, typename T>
@@ -188,4 +304,196 @@ constexpr auto operator/(vec<N, T> const& v, typename vec<N, T>::value_type cons
 	auto tmp{v};
 	return tmp /= scale;
 }
+
+template <typename L, typename R>
+constexpr auto dot(L const& lhs, R const& rhs) noexcept -> detail::loaded_t<L>::value_type
+	requires viewed_vectors<L, R>
+{
+	return dot(detail::load(lhs), detail::load(rhs));
+}
+
+template <typename L, typename R>
+constexpr auto cross(L const& lhs, R const& rhs) noexcept -> detail::loaded_t<L>
+	requires (viewed_vectors<L, R> && detail::loaded_t<L>::dimension == 3)
+{
+	return cross(detail::load(lhs), detail::load(rhs));
+}
+
+template <std::size_t N, typename T>
+constexpr auto norm_squared(vec_view<N, T> const& v) noexcept -> vec_view<N, T>::value_type
+{
+	return norm_squared(v.load());
+}
+
+template <std::size_t N, typename T>
+constexpr auto norm(vec_view<N, T> const& v) noexcept -> math::real_t<T>
+{
+	return norm(v.load());
+}
+
+template <std::size_t N, typename T>
+constexpr auto normal(vec_view<N, T> const& v) noexcept -> vec_view<N, T>::vec_type
+{
+	return normal(v.load());
+}
+
+template <typename L, typename R>
+constexpr auto projection(L const& v, R const& axis) noexcept -> detail::loaded_t<L>
+	requires viewed_vectors<L, R>
+{
+	return projection(detail::load(v), detail::load(axis));
+}
+
+template <std::size_t N, typename T>
+constexpr auto reciprocal(vec_view<N, T> const& v) noexcept -> vec_view<N, T>::vec_type
+{
+	return reciprocal(v.load());
+}
+
+template <std::size_t N, typename T, typename R>
+constexpr auto operator+=(vec<N, T>& lhs, R const& rhs) noexcept -> vec<N, T>&
+	requires viewed_vectors<vec<N, T>, R>
+{
+	return lhs += rhs.load();
+}
+
+template <std::size_t N, typename T, typename R>
+constexpr auto operator-=(vec<N, T>& lhs, R const& rhs) noexcept -> vec<N, T>&
+	requires viewed_vectors<vec<N, T>, R>
+{
+	return lhs -= rhs.load();
+}
+
+template <std::size_t N, typename T, typename R>
+constexpr auto operator*=(vec<N, T>& lhs, R const& rhs) noexcept -> vec<N, T>&
+	requires viewed_vectors<vec<N, T>, R>
+{
+	return lhs *= rhs.load();
+}
+
+template <std::size_t N, typename T, typename R>
+constexpr auto operator/=(vec<N, T>& lhs, R const& rhs) noexcept -> vec<N, T>&
+	requires viewed_vectors<vec<N, T>, R>
+{
+	return lhs /= rhs.load();
+}
+
+template <std::size_t N, typename T, typename R>
+constexpr auto operator+=(vec_view<N, T> const& lhs, R const& rhs) noexcept -> vec_view<N, T>
+	requires (!std::is_const_v<T> && std::same_as<detail::loaded_t<R>, typename vec_view<N, T>::vec_type>)
+{
+	auto tmp{lhs.load()};
+	lhs.store(tmp += detail::load(rhs));
+
+	return lhs;
+}
+
+template <std::size_t N, typename T, typename R>
+constexpr auto operator-=(vec_view<N, T> const& lhs, R const& rhs) noexcept -> vec_view<N, T>
+	requires (!std::is_const_v<T> && std::same_as<detail::loaded_t<R>, typename vec_view<N, T>::vec_type>)
+{
+	auto tmp{lhs.load()};
+	lhs.store(tmp -= detail::load(rhs));
+
+	return lhs;
+}
+
+template <std::size_t N, typename T, typename R>
+constexpr auto operator*=(vec_view<N, T> const& lhs, R const& rhs) noexcept -> vec_view<N, T>
+	requires (!std::is_const_v<T> && std::same_as<detail::loaded_t<R>, typename vec_view<N, T>::vec_type>)
+{
+	auto tmp{lhs.load()};
+	lhs.store(tmp *= detail::load(rhs));
+
+	return lhs;
+}
+
+template <std::size_t N, typename T, typename R>
+constexpr auto operator/=(vec_view<N, T> const& lhs, R const& rhs) noexcept -> vec_view<N, T>
+	requires (!std::is_const_v<T> && std::same_as<detail::loaded_t<R>, typename vec_view<N, T>::vec_type>)
+{
+	auto tmp{lhs.load()};
+	lhs.store(tmp /= detail::load(rhs));
+
+	return lhs;
+}
+
+template <std::size_t N, typename T>
+constexpr auto operator*=(vec_view<N, T> const& v, typename vec_view<N, T>::value_type const& scale) noexcept -> vec_view<N, T>
+	requires (!std::is_const_v<T>)
+{
+	auto tmp{v.load()};
+	v.store(tmp *= scale);
+
+	return v;
+}
+
+template <std::size_t N, typename T>
+constexpr auto operator/=(vec_view<N, T> const& v, typename vec_view<N, T>::value_type const& scale) noexcept -> vec_view<N, T>
+	requires (!std::is_const_v<T>)
+{
+	auto tmp{v.load()};
+	v.store(tmp /= scale);
+
+	return v;
+}
+
+template <typename L, typename R>
+constexpr auto operator==(L const& lhs, R const& rhs) noexcept -> bool
+	requires viewed_vectors<L, R>
+{
+	return detail::load(lhs) == detail::load(rhs);
+}
+
+template <std::size_t N, typename T>
+constexpr auto operator-(vec_view<N, T> const& v) noexcept -> vec_view<N, T>::vec_type
+{
+	return -v.load();
+}
+
+template <typename L, typename R>
+constexpr auto operator+(L const& lhs, R const& rhs) noexcept -> detail::loaded_t<L>
+	requires viewed_vectors<L, R>
+{
+	return detail::load(lhs) + detail::load(rhs);
+}
+
+template <typename L, typename R>
+constexpr auto operator-(L const& lhs, R const& rhs) noexcept -> detail::loaded_t<L>
+	requires viewed_vectors<L, R>
+{
+	return detail::load(lhs) - detail::load(rhs);
+}
+
+template <typename L, typename R>
+constexpr auto operator*(L const& lhs, R const& rhs) noexcept -> detail::loaded_t<L>
+	requires viewed_vectors<L, R>
+{
+	return detail::load(lhs) * detail::load(rhs);
+}
+
+template <typename L, typename R>
+constexpr auto operator/(L const& lhs, R const& rhs) noexcept -> detail::loaded_t<L>
+	requires viewed_vectors<L, R>
+{
+	return detail::load(lhs) / detail::load(rhs);
+}
+
+template <std::size_t N, typename T>
+constexpr auto operator*(vec_view<N, T> const& v, typename vec_view<N, T>::value_type const& scale) noexcept -> vec_view<N, T>::vec_type
+{
+	return v.load() * scale;
+}
+
+template <std::size_t N, typename T>
+constexpr auto operator*(typename vec_view<N, T>::value_type const& scale, vec_view<N, T> const& v) noexcept -> vec_view<N, T>::vec_type
+{
+	return v * scale;
+}
+
+template <std::size_t N, typename T>
+constexpr auto operator/(vec_view<N, T> const& v, typename vec_view<N, T>::value_type const& scale) noexcept -> vec_view<N, T>::vec_type
+{
+	return v.load() / scale;
+}
 }
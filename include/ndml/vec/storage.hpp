@@ -0,0 +1,93 @@
+#ifndef NDML_VEC_STORAGE_HPP
+#define NDML_VEC_STORAGE_HPP
+
+#include "ndml/meta/burn.hpp"
+#include "ndml/meta/layout.hpp"
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+namespace ndml
+{
+/**
+ * @brief Type of a vector component at given index.
+ *
+ * This evaluates to @p T for @p I < @p N and to a burn type otherwise.
+ *
+ * @tparam I component index
+ * @tparam N vector size
+ * @tparam T element type
+ *
+ * @note For @p I >= @p N, this evaluates to different empty burn types to motivate empty member optimisation.
+ *
+ * @sa ndml::meta::burn_t
+ */
+template <std::size_t I, std::size_t N, typename T>
+using vec_component_t = std::conditional_t<I < N, T, meta::burn_t<std::integral_constant<std::size_t, I>>>;
+
+/**
+ * @brief Storage of vector components.
+ *
+ * Vectors of up to four components store them as member variables @c x, @c y, @c z, and @c w,
+ * members past the size of the vector being of empty burn types which occupy no storage.
+ *
+ * @tparam N size
+ * @tparam T element type
+ */
+template <std::size_t N, typename T>
+struct vec_storage
+{
+	/**
+	 * @brief The X component of the vector.
+	 *
+	 * It is usable for @p N > 0.
+	 */
+	NDML_NO_UNIQUE_ADDRESS
+	vec_component_t<0, N, T> x{};
+
+	/**
+	 * @brief The Y component of the vector.
+	 *
+	 * It is usable for @p N > 1.
+	 */
+	NDML_NO_UNIQUE_ADDRESS
+	vec_component_t<1, N, T> y{};
+
+	/**
+	 * @brief The Z component of the vector.
+	 *
+	 * It is usable for @p N > 2.
+	 */
+	NDML_NO_UNIQUE_ADDRESS
+	vec_component_t<2, N, T> z{};
+
+	/**
+	 * @brief The W component of the vector.
+	 *
+	 * It is usable for @p N > 3.
+	 */
+	NDML_NO_UNIQUE_ADDRESS
+	vec_component_t<3, N, T> w{};
+};
+
+/**
+ * @brief Storage of components of vectors of more than four components.
+ *
+ * Components are stored in a contiguous array, as there are no names for them.
+ *
+ * @tparam N size
+ * @tparam T element type
+ */
+template <std::size_t N, typename T>
+	requires (N > 4)
+struct vec_storage<N, T>
+{
+	/**
+	 * @brief Components of the vector.
+	 */
+	std::array<T, N> components{};
+};
+}
+
+#endif
@@ -0,0 +1,147 @@
+#ifndef NDML_VEC_SWIZZLE_HPP
+#define NDML_VEC_SWIZZLE_HPP
+
+#include "vec.hpp"
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+namespace ndml
+{
+namespace detail
+{
+/**
+ * @brief Whether indices @p I are pairwise distinct.
+ */
+template <std::size_t... I>
+inline constexpr bool distinct_indices = [] {
+	constexpr std::array<std::size_t, sizeof...(I)> indices{I...};
+
+	for (std::size_t i = 0; i < indices.size(); ++i)
+	{
+		for (std::size_t j = i + 1; j < indices.size(); ++j)
+		{
+			if (indices[i] == indices[j])
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}();
+}
+
+/**
+ * @brief Swizzle of a vector.
+ *
+ * This creates a vector of the components of @p v at indices @p I, in order, e.g. @c swizzle<2,1,0>(v) reverses
+ * a three-dimensional vector and @c swizzle<0,0>(v) repeats its first component.
+ * Components are read at compile-time indices, without the branches of the subscript operator.
+ * With @c NDML_SIMD, swizzles of four components of four-dimensional vectors with SIMD kernels are a single shuffle.
+ *
+ * @tparam I component indices of @p v
+ * @tparam N dimension
+ * @tparam T element type
+ *
+ * @sa ndml::swizzled for a view writing through to @p v
+ */
+template <std::size_t... I, std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto swizzle(vec<N, T> const& v) noexcept -> vec<sizeof...(I), T>
+	requires (sizeof...(I) > 0 && ((I < N) && ...));
+
+/**
+ * @brief Non-owning swizzled view of a vector.
+ *
+ * It refers to the components of a vector at indices @p I, in order, e.g. those of @c swizzled<2,0>(v) are @c v.z and @c v.x,
+ * so that they are written to in place without staging copies.
+ *
+ * @tparam N size of the viewed vector
+ * @tparam T element type, const-qualified for read-only views
+ * @tparam I component indices of the viewed vector, pairwise distinct for writes
+ */
+template <std::size_t N, typename T, std::size_t... I>
+struct swizzle_view
+{
+	static_assert(sizeof...(I) > 0 && ((I < N) && ...));
+
+	using element_type = T;
+	using value_type   = std::remove_cv_t<T>;
+	using vec_type     = vec<sizeof...(I), value_type>;
+	using viewed_type  = std::conditional_t<std::is_const_v<element_type>, vec<N, value_type> const, vec<N, value_type>>;
+
+	/**
+	 * @brief Number of components.
+	 */
+	static constexpr auto dimension = sizeof...(I);
+
+	/**
+	 * @brief Constructor from a vector.
+	 *
+	 * The view refers to the components of @p v at indices @p I.
+	 */
+	constexpr explicit swizzle_view(viewed_type& v) noexcept;
+
+	/**
+	 * @brief Size of view.
+	 *
+	 * @return the number of components
+	 */
+	[[nodiscard]]
+	static consteval auto size() noexcept -> std::size_t;
+
+	/**
+	 * @brief Component at a compile-time index.
+	 *
+	 * @tparam J component index in the view
+	 */
+	template <std::size_t J>
+	[[nodiscard]]
+	constexpr auto get(this swizzle_view const& self) noexcept -> element_type&
+		requires (J < sizeof...(I));
+
+	/**
+	 * @brief Copy of the viewed components.
+	 */
+	[[nodiscard]]
+	constexpr auto load(this swizzle_view const& self) noexcept -> vec_type;
+
+	/**
+	 * @brief Stores components of @p v to the viewed ones.
+	 *
+	 * With @c NDML_SIMD, stores to all four components of four-dimensional vectors with SIMD kernels are a single shuffle.
+	 */
+	constexpr auto store(this swizzle_view const& self, vec_type const& v) noexcept -> void
+		requires (!std::is_const_v<element_type> && detail::distinct_indices<I...>);
+
+private:
+	/// Viewed vector.
+	viewed_type* v_;
+};
+
+/**
+ * @brief Swizzled view of a vector.
+ *
+ * @tparam I component indices of @p v
+ * @tparam N dimension
+ * @tparam T element type
+ *
+ * @return view of the components of @p v at indices @p I
+ */
+template <std::size_t... I, std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto swizzled(vec<N, T>& v) noexcept -> swizzle_view<N, T, I...>;
+
+/**
+ * @copydoc swizzled(vec<N, T>&)
+ */
+template <std::size_t... I, std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto swizzled(vec<N, T> const& v) noexcept -> swizzle_view<N, T const, I...>;
+}
+
+#include "swizzle.inl"
+
+#endif
@@ -0,0 +1,96 @@
+#include "ndml/meta/unroll.hpp"
+#include "ndml/simd/vec.hpp"
+
+namespace ndml
+{
+namespace detail
+{
+/**
+ * @brief Inverse of the permutation of indices @p I.
+ *
+ * Its component at index @c I...[k] is @c k, so that swizzling by it undoes swizzling by @p I.
+ */
+template <std::size_t... I>
+consteval auto inverse_permutation() noexcept -> std::array<std::size_t, sizeof...(I)>
+{
+	std::array<std::size_t, sizeof...(I)> inverse{};
+
+	std::size_t k = 0;
+	((inverse[I] = k++), ...);
+
+	return inverse;
+}
+}
+
+template <std::size_t... I, std::size_t N, typename T>
+constexpr auto swizzle(vec<N, T> const& v) noexcept -> vec<sizeof...(I), T>
+	requires (sizeof...(I) > 0 && ((I < N) && ...))
+{
+	if constexpr (N == 4 && sizeof...(I) == 4 && simd::enabled<vec<4, T>>)
+	{
+		if !consteval
+		{
+			return simd::kernel<vec<4, T>>::template shuffle<I...>(v);
+		}
+	}
+
+	return {v.template get<I>()...};
+}
+
+template <std::size_t N, typename T, std::size_t... I>
+constexpr swizzle_view<N, T, I...>::swizzle_view(viewed_type& v) noexcept
+	: v_{&v}
+{
+}
+
+template <std::size_t N, typename T, std::size_t... I>
+consteval auto swizzle_view<N, T, I...>::size() noexcept -> std::size_t
+{
+	return sizeof...(I);
+}
+
+template <std::size_t N, typename T, std::size_t... I>
+template <std::size_t J>
+constexpr auto swizzle_view<N, T, I...>::get(this swizzle_view const& self) noexcept -> element_type&
+	requires (J < sizeof...(I))
+{
+	constexpr std::array<std::size_t, sizeof...(I)> indices{I...};
+
+	return self.v_->template get<indices[J]>();
+}
+
+template <std::size_t N, typename T, std::size_t... I>
+constexpr auto swizzle_view<N, T, I...>::load(this swizzle_view const& self) noexcept -> vec_type
+{
+	return swizzle<I...>(*self.v_);
+}
+
+template <std::size_t N, typename T, std::size_t... I>
+constexpr auto swizzle_view<N, T, I...>::store(this swizzle_view const& self, vec_type const& v) noexcept -> void
+	requires (!std::is_const_v<element_type> && detail::distinct_indices<I...>)
+{
+	if constexpr (N == 4 && sizeof...(I) == 4)
+	{
+		// a permutation of all of the components, undone by swizzling by its inverse
+		constexpr auto inverse = detail::inverse_permutation<I...>();
+
+		*self.v_ = swizzle<inverse[0], inverse[1], inverse[2], inverse[3]>(v);
+	}
+	else
+	{
+		meta::unroll<sizeof...(I)>([&self, &v](auto... j) { ((self.v_->template get<I>() = v.template get<j>()), ...); });
+	}
+}
+
+template <std::size_t... I, std::size_t N, typename T>
+constexpr auto swizzled(vec<N, T>& v) noexcept -> swizzle_view<N, T, I...>
+{
+	return swizzle_view<N, T, I...>{v};
+}
+
+template <std::size_t... I, std::size_t N, typename T>
+constexpr auto swizzled(vec<N, T> const& v) noexcept -> swizzle_view<N, T const, I...>
+{
+	return swizzle_view<N, T const, I...>{v};
+}
+}
@@ -1,24 +1,36 @@
 #ifndef NDML_VEC_VEC_HPP
 #define NDML_VEC_VEC_HPP
 
-#include "ndml/meta/burn.hpp"
+#include "storage.hpp"
+
+#include "ndml/meta/layout.hpp"
+#include "ndml/meta/unroll.hpp"
 
 #include <concepts>
 #include <cstddef>
 #include <type_traits>
+#include <utility>
 
 namespace ndml
 {
 /**
  * @brief Algebraic vector.
  *
- * @tparam N size, a positive integer not greater than 4
+ * Vectors of up to four components have them accessible via member variables @c x, @c y, @c z, and @c w,
+ * while larger ones store them in a contiguous array, @c components.
+ * Either way, a vector is laid out exactly as an array of @p N elements of type @p T.
+ *
+ * @tparam N size, a positive integer
  * @tparam T element type
+ *
+ * @sa ndml::vec_storage
+ * @sa ndml::meta::array_layout
  */
 template <std::size_t N, typename T>
-struct vec
+struct vec : vec_storage<N, T>
 {
-	static_assert(0 < N && N <= 4);
+	static_assert(0 < N);
+	static_assert(meta::array_layout<vec_storage<N, T>, T, N>, "vector components must be laid out as an array");
 
 	/**
 	 * @brief Iterator.
@@ -37,16 +49,12 @@ struct vec
 	/**
 	 * @brief Type of a vector component at given index.
 	 *
-	 * This evaluates to @c value_type for @p I < @p N and to a burn type otherwise.
-	 *
 	 * @tparam I component index
 	 *
-	 * @note For @p I >= @p N, this evaluates to different empty burn types to motivate empty member optimisation.
-	 *
-	 * @sa ndml::meta::burn_t
+	 * @sa ndml::vec_component_t
 	 */
 	template <std::size_t I>
-	using component_type = std::conditional_t<I < N, value_type, meta::burn_t<std::integral_constant<std::size_t, I>>>;
+	using component_type = vec_component_t<I, N, value_type>;
 
 	/**
 	 * @brief Type of a subscript operator evaluation result for a given cv-qualified vector type.
@@ -59,7 +67,7 @@ struct vec
 	/**
 	 * @brief Number of components.
 	 *
-	 * It is a positive integer not greater than 4.
+	 * It is a positive integer.
 	 */
 	static constexpr auto dimension = N;
 
@@ -71,38 +79,6 @@ struct vec
 	[[nodiscard]]
 	static consteval auto size() noexcept -> std::size_t;
 
-	/**
-	 * @brief The X component of the vector.
-	 *
-	 * It is usable for @p N > 0.
-	 */
-	[[no_unique_address]]
-	component_type<0> x{};
-
-	/**
-	 * @brief The Y component of the vector.
-	 *
-	 * It is usable for @p N > 1.
-	 */
-	[[no_unique_address]]
-	component_type<1> y{};
-
-	/**
-	 * @brief The Z component of the vector.
-	 *
-	 * It is usable for @p N > 2.
-	 */
-	[[no_unique_address]]
-	component_type<2> z{};
-
-	/**
-	 * @brief The W component of the vector.
-	 *
-	 * It is usable for @p N > 3.
-	 */
-	[[no_unique_address]]
-	component_type<3> w{};
-
 	/**
 	 * @brief Default constructor.
 	 *
@@ -144,7 +120,7 @@ struct vec
 	 */
 	template <typename FromT>
 	constexpr explicit vec(FromT const& scale) noexcept
-		requires std::convertible_to<FromT, value_type>;
+		requires std::constructible_from<value_type, FromT const&>;
 
 	/**
 	 * @brief Converting copy constructor from a vector of another type.
@@ -159,7 +135,7 @@ struct vec
 	 */
 	template <std::size_t FromN, typename FromT>
 	constexpr explicit vec(vec<FromN, FromT> const& v) noexcept
-		requires (FromN <= N && std::convertible_to<FromT, value_type>);
+		requires (FromN <= N && std::constructible_from<value_type, FromT const&>);
 
 	/**
 	 * @brief Converting move constructor from a vector of another type.
@@ -174,7 +150,7 @@ struct vec
 	 */
 	template <std::size_t FromN, typename FromT>
 	constexpr explicit vec(vec<FromN, FromT>&& v) noexcept
-		requires (FromN <= N && std::convertible_to<FromT, value_type>);
+		requires (FromN <= N && std::constructible_from<value_type, FromT>);
 
 	/**
 	 * @brief Copy-assignment operator.
@@ -193,7 +169,7 @@ struct vec
 	/**
 	 * @brief Subscript operator.
 	 *
-	 * This retrieves the component, or a burn instance thereof, at index @p i.
+	 * This retrieves the component, or a burn instance thereof for vectors of up to four components, at index @p i.
 	 *
 	 * @tparam V cv-qualified vector type
 	 *
@@ -202,11 +178,66 @@ struct vec
 	 * @return component at index @p i, including a burn instance
 	 *
 	 * @throws @c std::out_of_range when @p i >= @p N
+	 *
+	 * @sa get for access at a compile-time index without the range check
 	 */
 	template <typename V>
 	[[nodiscard]]
 	constexpr auto operator[](this V&& self, std::size_t i) -> subscript_result<V>;
 
+	/**
+	 * @brief Component at a compile-time index.
+	 *
+	 * This retrieves the component at index @p I with the value category of the vector preserved.
+	 * Unlike the subscript operator, it involves neither a runtime branch nor a range check.
+	 *
+	 * @tparam I component index
+	 *
+	 * @return reference to the component at index @p I
+	 */
+	template <std::size_t I>
+	[[nodiscard]]
+	constexpr auto get(this auto&& self) noexcept -> decltype(auto)
+		requires (I < N);
+
+	/**
+	 * @brief First two components.
+	 *
+	 * @return vector of the X and Y components
+	 *
+	 * @sa ndml::swizzle for components at other indices
+	 */
+	[[nodiscard]]
+	constexpr auto xy(this vec const& self) noexcept -> vec<2, value_type>
+		requires (N >= 2);
+
+	/**
+	 * @brief First three components.
+	 *
+	 * This is e.g. the imaginary part of a quaternion, or the Cartesian part of homogeneous coordinates.
+	 *
+	 * @return vector of the X, Y, and Z components
+	 *
+	 * @sa ndml::swizzle for components at other indices
+	 */
+	[[nodiscard]]
+	constexpr auto xyz(this vec const& self) noexcept -> vec<3, value_type>
+		requires (N >= 3);
+
+	/**
+	 * @brief Pointer to the components.
+	 *
+	 * This retrieves the pointer to the first component, components being laid out contiguously in order.
+	 * Access through it is unchecked.
+	 *
+	 * @return pointer to the first component
+	 *
+	 * @warning For vectors of up to four components, access to components other than the first one
+	 *          through the returned pointer is not allowed in constant evaluation, use @c get instead.
+	 */
+	[[nodiscard]]
+	constexpr auto data(this auto&& self) noexcept -> decltype(auto);
+
 	/**
 	 * @brief Conversion operator to boolean.
 	 *
@@ -269,6 +300,42 @@ vec(FromTs const&... components) -> vec<sizeof...(FromTs), std::common_type_t<Fr
 template <std::size_t N, typename T>
 constexpr auto swap(vec<N, T>& lhs, vec<N, T>& rhs) noexcept -> void;
 
+/**
+ * @brief Component of a vector at a compile-time index.
+ *
+ * @tparam I component index
+ * @tparam N dimension
+ * @tparam T element type
+ *
+ * @param v vector
+ *
+ * @return reference to the component of @p v at index @p I
+ */
+template <std::size_t I, std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto get(vec<N, T>& v) noexcept -> T&;
+
+/**
+ * @copydoc get(vec<N, T>&)
+ */
+template <std::size_t I, std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto get(vec<N, T> const& v) noexcept -> T const&;
+
+/**
+ * @copydoc get(vec<N, T>&)
+ */
+template <std::size_t I, std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto get(vec<N, T>&& v) noexcept -> T&&;
+
+/**
+ * @copydoc get(vec<N, T>&)
+ */
+template <std::size_t I, std::size_t N, typename T>
+[[nodiscard]]
+constexpr auto get(vec<N, T> const&& v) noexcept -> T const&&;
+
 template <std::size_t N, typename T>
 template <typename V>
 struct vec<N, T>::iterator
@@ -388,6 +455,27 @@ private:
 };
 }
 
+/**
+ * @brief Tuple size of a vector.
+ *
+ * It makes vectors usable with structured bindings.
+ */
+template <std::size_t N, typename T>
+struct std::tuple_size<ndml::vec<N, T>> : std::integral_constant<std::size_t, N>
+{
+};
+
+/**
+ * @brief Tuple element type of a vector.
+ */
+template <std::size_t I, std::size_t N, typename T>
+struct std::tuple_element<I, ndml::vec<N, T>>
+{
+	static_assert(I < N);
+
+	using type = T;
+};
+
 #include "vec.inl"
 
 #endif
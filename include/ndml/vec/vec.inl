@@ -9,14 +9,13 @@ template <typename... FromTs>
 constexpr vec<N, T>::vec(FromTs... components) noexcept
 	requires (sizeof...(FromTs) <= N && (std::convertible_to<FromTs, value_type> && ...))
 {
-	std::size_t i = 0;
-	(((*this)[i++] = std::move(components)), ...);
+	meta::unroll<sizeof...(FromTs)>([this, &components...](auto... i) { ((this->template get<i>() = std::move(components)), ...); });
 }
 
 template <std::size_t N, typename T>
 template <typename FromT>
 constexpr vec<N, T>::vec(FromT const& scale) noexcept
-	requires std::convertible_to<FromT, value_type>
+	requires std::constructible_from<value_type, FromT const&>
 {
 	std::ranges::fill(*this, static_cast<value_type>(scale));
 }
@@ -24,23 +23,17 @@ constexpr vec<N, T>::vec(FromT const& scale) noexcept
 template <std::size_t N, typename T>
 template <std::size_t FromN, typename FromT>
 constexpr vec<N, T>::vec(vec<FromN, FromT> const& v) noexcept
-	requires (FromN <= N && std::convertible_to<FromT, value_type>)
+	requires (FromN <= N && std::constructible_from<value_type, FromT const&>)
 {
-	for (std::size_t i = 0; i < FromN; ++i)
-	{
-		(*this)[i] = static_cast<value_type>(v[i]);
-	}
+	meta::unroll<FromN>([this, &v](auto... i) { ((this->template get<i>() = static_cast<value_type>(v.template get<i>())), ...); });
 }
 
 template <std::size_t N, typename T>
 template <std::size_t FromN, typename FromT>
 constexpr vec<N, T>::vec(vec<FromN, FromT>&& v) noexcept
-	requires (FromN <= N && std::convertible_to<FromT, value_type>)
+	requires (FromN <= N && std::constructible_from<value_type, FromT>)
 {
-	for (std::size_t i = 0; i < FromN; ++i)
-	{
-		(*this)[i] = static_cast<value_type>(std::move(v[i]));
-	}
+	meta::unroll<FromN>([this, &v](auto... i) { ((this->template get<i>() = static_cast<value_type>(std::move(v).template get<i>())), ...); });
 }
 
 template <std::size_t N, typename T>
@@ -53,57 +46,127 @@ template <std::size_t N, typename T>
 template <typename V>
 constexpr auto vec<N, T>::operator[](this V&& self, std::size_t i) -> subscript_result<V>
 {
-	switch (i)
+	if constexpr (N > 4)
 	{
-	case 0:
-		if constexpr (0 < N)
+		if (i >= N)
 		{
-			return self.x;
-		}
-		else
-		{
-			[[fallthrough]];
+			throw std::out_of_range("index out of range in call to vec subscript operator");
 		}
 
-	case 1:
-		if constexpr (1 < N)
-		{
-			return self.y;
-		}
-		else
+		return self.components[i];
+	}
+	else
+	{
+		switch (i)
 		{
-			[[fallthrough]];
-		}
+		case 0:
+			if constexpr (0 < N)
+			{
+				return self.x;
+			}
+			else
+			{
+				[[fallthrough]];
+			}
 
-	case 2:
-		if constexpr (2 < N)
-		{
-			return self.z;
-		}
-		else
-		{
-			[[fallthrough]];
-		}
+		case 1:
+			if constexpr (1 < N)
+			{
+				return self.y;
+			}
+			else
+			{
+				[[fallthrough]];
+			}
 
-	case 3:
-		if constexpr (3 < N)
-		{
-			return self.w;
-		}
-		else
-		{
-			[[fallthrough]];
+		case 2:
+			if constexpr (2 < N)
+			{
+				return self.z;
+			}
+			else
+			{
+				[[fallthrough]];
+			}
+
+		case 3:
+			if constexpr (3 < N)
+			{
+				return self.w;
+			}
+			else
+			{
+				[[fallthrough]];
+			}
+
+		default:
+			throw std::out_of_range("index out of range in call to vec subscript operator");
 		}
+	}
+}
+
+template <std::size_t N, typename T>
+template <std::size_t I>
+constexpr auto vec<N, T>::get(this auto&& self) noexcept -> decltype(auto)
+	requires (I < N)
+{
+	using self_type = decltype(self);
 
-	default:
-		throw std::out_of_range("index out of range in call to vec subscript operator");
+	if constexpr (N > 4)
+	{
+		return std::get<I>(std::forward<self_type>(self).components);
+	}
+	else if constexpr (I == 0)
+	{
+		return (std::forward<self_type>(self).x);
+	}
+	else if constexpr (I == 1)
+	{
+		return (std::forward<self_type>(self).y);
+	}
+	else if constexpr (I == 2)
+	{
+		return (std::forward<self_type>(self).z);
+	}
+	else
+	{
+		return (std::forward<self_type>(self).w);
+	}
+}
+
+template <std::size_t N, typename T>
+constexpr auto vec<N, T>::xy(this vec const& self) noexcept -> vec<2, value_type>
+	requires (N >= 2)
+{
+	return {self.template get<0>(), self.template get<1>()};
+}
+
+template <std::size_t N, typename T>
+constexpr auto vec<N, T>::xyz(this vec const& self) noexcept -> vec<3, value_type>
+	requires (N >= 3)
+{
+	return {self.template get<0>(), self.template get<1>(), self.template get<2>()};
+}
+
+template <std::size_t N, typename T>
+constexpr auto vec<N, T>::data(this auto&& self) noexcept -> decltype(auto)
+{
+	static_assert(meta::array_layout<vec, value_type, N>, "vector components must be laid out as an array");
+
+	if constexpr (N > 4)
+	{
+		return self.components.data();
+	}
+	else
+	{
+		return &self.x;
 	}
 }
 
 template <std::size_t N, typename T>
 constexpr vec<N, T>::operator bool(this auto const& self) noexcept
 {
-	return std::ranges::any_of(self, std::identity{});
+	return meta::unroll<N>([&self](auto... i) { return (static_cast<bool>(self.template get<i>()) || ...); });
 }
 
 template <std::size_t N, typename T>
@@ -133,7 +196,32 @@ constexpr auto vec<N, T>::cend(this auto const& self) noexcept -> decltype(auto)
 template <std::size_t N, typename T>
 constexpr auto swap(vec<N, T>& lhs, vec<N, T>& rhs) noexcept -> void
 {
-	std::ranges::swap_ranges(lhs, rhs);
+	using std::swap;
+	meta::unroll<N>([&lhs, &rhs](auto... i) { (swap(get<i>(lhs), get<i>(rhs)), ...); });
+}
+
+template <std::size_t I, std::size_t N, typename T>
+constexpr auto get(vec<N, T>& v) noexcept -> T&
+{
+	return v.template get<I>();
+}
+
+template <std::size_t I, std::size_t N, typename T>
+constexpr auto get(vec<N, T> const& v) noexcept -> T const&
+{
+	return v.template get<I>();
+}
+
+template <std::size_t I, std::size_t N, typename T>
+constexpr auto get(vec<N, T>&& v) noexcept -> T&&
+{
+	return std::move(v.template get<I>());
+}
+
+template <std::size_t I, std::size_t N, typename T>
+constexpr auto get(vec<N, T> const&& v) noexcept -> T const&&
+{
+	return std::move(v.template get<I>());
 }
 
 template <std::size_t N, typename T>
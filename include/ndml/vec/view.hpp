@@ -0,0 +1,214 @@
+#ifndef NDML_VEC_VIEW_HPP
+#define NDML_VEC_VIEW_HPP
+
+#include "vec.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+
+namespace ndml
+{
+/**
+ * @brief Non-owning strided view of a vector.
+ *
+ * It refers to @p N components of an external buffer, e.g. a GPU-mapped or file-mapped array of interleaved vertices,
+ * consecutive components being @c stride() elements apart, similarly to @c std::mdspan with @c std::layout_stride.
+ * Operations on vectors accept views in place of vectors, so that such buffers are operated on without staging copies.
+ *
+ * @tparam N size
+ * @tparam T element type, const-qualified for read-only views
+ */
+template <std::size_t N, typename T>
+struct vec_view
+{
+	static_assert(0 < N);
+
+	using element_type = T;
+	using value_type   = std::remove_cv_t<T>;
+	using vec_type     = vec<N, value_type>;
+
+	/**
+	 * @brief Number of components.
+	 */
+	static constexpr auto dimension = N;
+
+	/**
+	 * @brief Default constructor.
+	 *
+	 * The view refers to no components, and it is undefined behavior to access them.
+	 */
+	constexpr vec_view() noexcept = default;
+
+	/**
+	 * @brief Constructor from a pointer and stride.
+	 *
+	 * @param data   pointer to the first component
+	 * @param stride distance between consecutive components, in elements
+	 */
+	constexpr explicit vec_view(element_type* data, std::ptrdiff_t stride = 1) noexcept;
+
+	/**
+	 * @brief Constructor from a vector.
+	 *
+	 * The view refers to the components of @p v.
+	 */
+	constexpr vec_view(vec_type& v) noexcept;
+
+	/**
+	 * @brief Constructor from a constant vector.
+	 *
+	 * The view refers to the components of @p v.
+	 */
+	constexpr vec_view(vec_type const& v) noexcept
+		requires std::is_const_v<element_type>;
+
+	/**
+	 * @brief Converting constructor from a view of mutable components.
+	 */
+	template <typename FromT>
+	constexpr vec_view(vec_view<N, FromT> const& v) noexcept
+		requires (!std::same_as<FromT, element_type> && std::convertible_to<FromT (*)[], element_type (*)[]>);
+
+	/**
+	 * @brief Size of view.
+	 *
+	 * @return the number of components
+	 */
+	[[nodiscard]]
+	static consteval auto size() noexcept -> std::size_t;
+
+	/**
+	 * @brief Distance between consecutive components, in elements.
+	 */
+	[[nodiscard]]
+	constexpr auto stride(this vec_view const& self) noexcept -> std::ptrdiff_t;
+
+	/**
+	 * @brief Pointer to the first component.
+	 */
+	[[nodiscard]]
+	constexpr auto data(this vec_view const& self) noexcept -> element_type*;
+
+	/**
+	 * @brief Subscript operator.
+	 *
+	 * This retrieves the component at index @p i.
+	 *
+	 * @warning Behavior is undefined when @p i >= @p N.
+	 */
+	[[nodiscard]]
+	constexpr auto operator[](this vec_view const& self, std::size_t i) noexcept -> element_type&;
+
+	/**
+	 * @brief Component at a compile-time index.
+	 *
+	 * @tparam I component index
+	 */
+	template <std::size_t I>
+	[[nodiscard]]
+	constexpr auto get(this vec_view const& self) noexcept -> element_type&
+		requires (I < N);
+
+	/**
+	 * @brief Copy of the viewed components.
+	 */
+	[[nodiscard]]
+	constexpr auto load(this vec_view const& self) noexcept -> vec_type;
+
+	/**
+	 * @brief Stores components of @p v to the viewed ones.
+	 */
+	constexpr auto store(this vec_view const& self, vec_type const& v) noexcept -> void
+		requires (!std::is_const_v<element_type>);
+
+private:
+	/// Pointer to the first component.
+	element_type* data_{};
+
+	/// Distance between consecutive components.
+	std::ptrdiff_t stride_{1};
+};
+
+template <std::size_t N, typename T>
+vec_view(vec<N, T>&) -> vec_view<N, T>;
+
+template <std::size_t N, typename T>
+vec_view(vec<N, T> const&) -> vec_view<N, T const>;
+
+namespace detail
+{
+/**
+ * @brief Size and element type of a vector or of a vector view.
+ */
+template <typename V>
+struct vector_traits
+{
+};
+
+template <std::size_t N, typename T>
+struct vector_traits<vec<N, T>>
+{
+	static constexpr auto size = N;
+
+	using value_type = T;
+	using view       = std::false_type;
+};
+
+template <std::size_t N, typename T>
+struct vector_traits<vec_view<N, T>>
+{
+	static constexpr auto size = N;
+
+	using value_type = std::remove_cv_t<T>;
+	using view       = std::true_type;
+};
+
+/**
+ * @brief Vector type a vector or a vector view is loaded into.
+ */
+template <typename V>
+using loaded_t = vec<vector_traits<std::remove_cvref_t<V>>::size, typename vector_traits<std::remove_cvref_t<V>>::value_type>;
+
+/**
+ * @brief Vector itself.
+ */
+template <std::size_t N, typename T>
+constexpr auto load(vec<N, T> const& v) noexcept -> vec<N, T> const&
+{
+	return v;
+}
+
+/**
+ * @brief Copy of the components viewed by @p v.
+ */
+template <std::size_t N, typename T>
+constexpr auto load(vec_view<N, T> const& v) noexcept -> vec<N, std::remove_cv_t<T>>
+{
+	return v.load();
+}
+}
+
+/**
+ * @brief Vector or vector view.
+ */
+template <typename V>
+concept vector_like = requires { detail::vector_traits<std::remove_cvref_t<V>>::size; };
+
+/**
+ * @brief Vector operands at least one of which is a view.
+ *
+ * Operands must be of the same size and element type. Such operands are loaded into vectors,
+ * which are then operated on.
+ */
+template <typename L, typename R>
+concept viewed_vectors =
+	vector_like<L> && vector_like<R>
+	&& (detail::vector_traits<std::remove_cvref_t<L>>::view::value || detail::vector_traits<std::remove_cvref_t<R>>::view::value)
+	&& detail::vector_traits<std::remove_cvref_t<L>>::size == detail::vector_traits<std::remove_cvref_t<R>>::size
+	&& std::same_as<typename detail::vector_traits<std::remove_cvref_t<L>>::value_type, typename detail::vector_traits<std::remove_cvref_t<R>>::value_type>;
+}
+
+#include "view.inl"
+
+#endif
@@ -0,0 +1,77 @@
+#include "ndml/meta/unroll.hpp"
+
+namespace ndml
+{
+template <std::size_t N, typename T>
+constexpr vec_view<N, T>::vec_view(element_type* data, std::ptrdiff_t stride) noexcept
+	: data_{data}
+	, stride_{stride}
+{
+}
+
+template <std::size_t N, typename T>
+constexpr vec_view<N, T>::vec_view(vec_type& v) noexcept
+	: vec_view{v.data()}
+{
+}
+
+template <std::size_t N, typename T>
+constexpr vec_view<N, T>::vec_view(vec_type const& v) noexcept
+	requires std::is_const_v<element_type>
+	: vec_view{v.data()}
+{
+}
+
+template <std::size_t N, typename T>
+template <typename FromT>
+constexpr vec_view<N, T>::vec_view(vec_view<N, FromT> const& v) noexcept
+	requires (!std::same_as<FromT, element_type> && std::convertible_to<FromT (*)[], element_type (*)[]>)
+	: vec_view{v.data(), v.stride()}
+{
+}
+
+template <std::size_t N, typename T>
+consteval auto vec_view<N, T>::size() noexcept -> std::size_t
+{
+	return N;
+}
+
+template <std::size_t N, typename T>
+constexpr auto vec_view<N, T>::stride(this vec_view const& self) noexcept -> std::ptrdiff_t
+{
+	return self.stride_;
+}
+
+template <std::size_t N, typename T>
+constexpr auto vec_view<N, T>::data(this vec_view const& self) noexcept -> element_type*
+{
+	return self.data_;
+}
+
+template <std::size_t N, typename T>
+constexpr auto vec_view<N, T>::operator[](this vec_view const& self, std::size_t i) noexcept -> element_type&
+{
+	return self.data_[static_cast<std::ptrdiff_t>(i) * self.stride_];
+}
+
+template <std::size_t N, typename T>
+template <std::size_t I>
+constexpr auto vec_view<N, T>::get(this vec_view const& self) noexcept -> element_type&
+	requires (I < N)
+{
+	return self.data_[static_cast<std::ptrdiff_t>(I) * self.stride_];
+}
+
+template <std::size_t N, typename T>
+constexpr auto vec_view<N, T>::load(this vec_view const& self) noexcept -> vec_type
+{
+	return meta::unroll<N>([&self](auto... i) { return vec_type{self.template get<i>()...}; });
+}
+
+template <std::size_t N, typename T>
+constexpr auto vec_view<N, T>::store(this vec_view const& self, vec_type const& v) noexcept -> void
+	requires (!std::is_const_v<element_type>)
+{
+	meta::unroll<N>([&self, &v](auto... i) { ((self.template get<i>() = v.template get<i>()), ...); });
+}
+}